@@ -0,0 +1,857 @@
+/* ==================================== JUCER_BINARY_RESOURCE ====================================
+
+   This is an auto-generated file: Any edits you make may be overwritten!
+
+*/
+
+namespace BinaryData
+{
+
+//================== juice.jpeg ==================
+static const unsigned char temp_binary_data_0[] =
+{ 255,216,255,224,0,16,74,70,73,70,0,1,1,1,0,72,0,72,0,0,255,219,0,67,0,2,1,1,1,1,1,2,1,1,1,2,2,2,2,2,4,3,2,2,2,2,5,4,4,3,4,6,5,6,6,6,5,6,6,6,7,9,8,6,7,9,7,6,6,8,11,8,9,10,10,10,10,10,6,8,11,12,11,10,12,9,10,10,10,255,219,0,67,1,2,2,2,2,2,2,5,3,3,5,10,
+7,6,7,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,255,192,0,17,8,1,244,1,161,3,1,17,0,2,17,1,3,17,1,255,196,0,30,0,1,0,1,3,5,1,0,0,0,0,0,0,0,0,0,
+0,0,9,6,7,8,1,3,4,5,10,2,255,196,0,97,16,0,0,5,2,3,4,5,5,10,9,6,10,8,4,7,0,0,1,2,3,4,5,6,7,8,17,9,10,18,33,19,49,65,81,113,20,34,97,129,145,21,35,50,51,66,82,114,161,177,193,22,52,83,98,99,115,130,146,194,23,36,67,116,162,209,24,37,68,131,147,163,178,
+179,195,196,26,38,53,100,148,164,165,210,84,85,101,180,54,69,86,211,212,225,240,255,196,0,29,1,1,0,0,7,1,1,0,0,0,0,0,0,0,0,0,0,0,1,2,3,4,5,6,7,8,9,255,196,0,84,17,0,2,1,2,3,3,7,7,7,9,3,11,3,4,3,0,0,1,2,3,4,5,6,17,18,33,49,7,65,81,113,129,145,161,19,20,
+34,50,97,177,193,21,66,98,114,146,178,209,8,35,51,82,130,194,210,225,240,52,67,162,22,23,36,37,53,83,99,115,131,147,179,38,68,241,54,195,211,226,69,84,163,255,218,0,12,3,1,0,2,17,3,17,0,63,0,159,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,204,139,172,192,22,107,53,59,65,242,89,146,26,47,187,89,172,204,157,167,101,146,155,233,24,129,85,169,164,231,73,79,51,213,152,141,241,72,123,171,228,54,96,8,188,205,142,250,46,81,
+108,7,95,161,229,11,46,247,86,35,75,111,146,43,55,20,132,208,233,199,207,225,161,38,151,100,56,90,118,41,182,140,1,111,118,123,111,149,191,136,120,217,19,13,182,131,96,149,183,106,219,117,202,137,177,14,249,178,222,146,77,81,73,106,209,191,44,142,250,
+221,83,141,22,186,45,246,214,149,36,139,139,162,81,107,160,19,193,76,169,65,172,64,98,171,76,154,212,152,210,26,75,177,228,71,116,150,219,173,168,136,210,180,168,185,41,38,70,70,70,92,140,140,140,1,202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,200,186,204,1,109,51,23,156,92,172,101,34,222,252,41,204,206,96,109,27,26,25,160,214,194,174,74,235,49,92,145,167,99,77,41,93,35,199,232,66,84,126,128,4,107,230,203,124,79,103,46,14,38,
+77,27,45,182,85,225,139,149,86,205,105,98,76,72,126,227,210,150,162,229,206,68,180,244,230,90,246,166,57,145,151,104,2,52,113,199,120,147,109,190,211,219,205,204,20,201,245,191,85,180,163,212,23,192,205,177,130,212,57,18,106,203,108,249,17,187,63,69,
+200,70,154,243,91,125,2,123,200,136,128,21,158,83,247,71,118,143,102,166,224,254,84,51,201,139,144,48,205,154,147,132,253,65,85,121,167,112,92,82,141,92,205,75,67,110,244,72,81,151,35,55,36,26,136,207,154,59,0,18,147,148,125,213,189,147,121,100,68,90,
+181,235,133,149,60,87,174,48,68,106,168,226,53,71,167,141,199,174,167,195,5,130,110,57,167,208,226,92,63,73,128,48,231,123,115,100,254,93,48,211,45,86,174,120,242,219,132,22,253,155,62,218,173,197,183,46,202,109,177,73,106,4,73,148,233,9,89,69,121,76,
+178,148,182,78,50,242,18,215,17,17,41,72,124,137,70,100,132,232,6,104,110,178,230,154,227,204,230,200,219,78,5,229,87,84,234,166,27,214,166,217,174,201,117,195,83,139,141,24,154,122,33,43,83,63,129,26,75,45,23,161,162,0,72,216,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,91,235,16,44,108,47,181,102,223,88,145,121,210,173,250,37,57,147,118,161,88,173,212,27,137,22,43,101,214,167,29,117,73,66,11,210,102,64,8,192,206,222,247,46,206,12,184,
+46,101,173,151,120,213,188,104,184,227,26,144,133,91,169,242,26,49,56,68,124,149,62,66,117,113,58,233,231,48,211,169,62,197,0,34,215,24,183,138,246,226,237,45,189,94,194,92,161,81,170,150,179,51,85,192,197,177,130,214,211,242,170,134,217,242,35,114,105,
+165,217,9,50,215,154,219,54,83,203,93,11,64,7,125,151,45,212,125,172,25,198,185,63,149,44,228,226,28,12,59,77,73,73,118,125,74,246,173,57,93,175,190,70,124,148,108,50,226,252,237,53,228,243,232,81,118,144,2,75,114,165,186,25,179,19,2,206,53,111,28,95,
+187,49,118,174,210,137,110,38,226,169,157,62,154,107,46,163,76,72,70,133,25,107,207,133,199,156,35,237,0,73,14,7,229,207,1,50,207,102,55,135,185,123,193,203,102,202,162,55,166,148,219,94,138,204,38,148,162,45,56,150,77,36,184,213,222,165,106,103,218,
+96,10,220,136,136,180,34,0,104,106,34,237,245,0,34,139,123,115,53,56,17,101,236,185,184,114,225,85,191,41,111,94,215,181,205,71,98,143,110,199,154,219,147,26,68,105,141,204,122,75,141,36,205,109,180,150,216,52,113,168,136,184,157,66,75,153,128,41,189,
+204,28,57,187,173,109,155,55,165,241,93,134,235,52,235,159,22,101,189,68,55,18,100,79,180,196,24,145,220,117,61,233,233,82,180,107,222,210,139,176,1,48,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,45,254,35,102,163,44,216,63,121,64,195,188,90,204,69,141,108,87,234,168,74,233,116,59,134,237,135,10,100,196,168,248,82,109,50,243,137,90,200,212,70,68,100,92,207,145,0,35,3,104,70,246,214,2,228,211,58,114,178,197,134,248,1,35,18,40,54,180,255,0,33,
+190,174,234,109,206,136,198,204,162,208,158,98,11,70,210,147,33,76,158,169,82,150,227,105,83,137,82,8,200,139,140,192,198,44,208,239,176,98,61,98,157,38,135,147,172,157,211,40,110,56,218,145,30,225,196,26,218,167,45,58,252,162,135,20,155,65,40,139,159,
+156,242,203,94,178,50,235,3,19,172,252,163,237,250,222,13,187,162,226,22,35,205,186,234,214,147,210,122,88,119,53,247,37,84,107,94,2,76,254,20,56,201,66,80,230,132,122,107,25,151,21,203,206,62,208,4,164,100,91,115,199,36,24,37,22,21,213,156,219,230,177,
+139,183,18,13,46,61,73,142,235,148,170,19,74,46,124,61,19,74,242,137,26,31,46,37,186,148,168,139,155,101,212,0,149,28,19,203,214,5,229,178,203,103,14,178,255,0,132,86,221,153,67,103,78,10,85,177,71,102,19,38,100,90,113,41,45,36,184,213,222,165,106,103,
+218,96,10,208,136,136,180,34,0,104,106,34,235,62,190,160,5,174,204,182,117,50,157,147,155,108,174,204,207,230,18,211,177,225,173,6,168,229,112,86,91,97,233,36,93,140,177,169,186,241,250,27,66,140,1,20,249,223,223,50,202,190,25,174,77,171,145,188,22,171,
+226,93,69,58,165,23,53,202,165,209,233,8,61,121,45,13,26,78,84,130,229,212,164,177,215,201,64,8,238,188,54,178,111,10,237,148,184,164,97,198,94,92,188,145,75,125,74,110,77,189,130,116,55,169,144,88,74,143,170,76,244,168,220,74,12,180,35,233,164,146,61,
+28,192,23,123,41,219,156,121,230,198,58,220,123,207,59,24,223,110,225,228,9,111,147,245,40,20,233,10,174,215,28,51,61,86,149,41,38,152,200,89,243,46,51,121,221,15,159,10,186,140,15,68,89,108,203,174,20,229,47,1,237,108,183,224,133,188,84,171,86,207,164,
+55,78,163,195,53,241,172,155,78,166,167,28,89,243,91,171,89,169,197,172,249,169,107,82,143,172,1,93,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,103,23,113,107,14,48,31,12,235,184,203,139,215,124,
+58,5,177,108,210,222,168,214,235,19,214,100,212,72,205,39,137,107,61,8,204,249,114,36,164,141,74,51,34,34,51,50,32,4,121,163,123,35,99,188,218,21,126,116,12,90,185,155,157,73,166,202,147,75,166,212,236,153,204,29,101,214,155,82,155,97,151,18,133,165,
+10,117,68,72,73,187,192,68,106,46,45,57,128,60,212,102,30,245,205,78,208,108,66,197,156,253,95,148,58,149,121,17,170,241,167,223,53,198,81,199,26,134,137,207,156,120,49,181,63,128,209,112,165,134,146,93,68,217,23,164,1,147,149,13,222,204,195,90,251,38,
+110,77,168,87,37,253,65,168,69,141,79,165,86,173,139,118,214,158,153,231,46,136,242,201,50,230,200,116,136,146,210,217,233,27,62,133,38,106,73,54,255,0,73,194,104,36,152,25,249,185,253,100,100,11,48,56,49,121,90,152,143,150,43,2,171,140,88,125,112,20,
+198,174,74,221,1,153,147,164,82,37,145,27,46,182,114,9,100,133,52,250,30,104,212,217,39,68,169,157,121,171,83,2,123,90,101,182,16,77,178,130,74,82,146,36,165,37,161,17,119,23,113,0,62,205,68,93,103,224,0,180,217,152,207,94,79,50,109,70,58,238,104,115,
+39,103,217,45,244,93,35,81,171,181,166,219,149,33,63,161,140,70,111,60,126,132,33,70,0,139,108,228,111,156,101,11,13,93,145,109,228,207,3,110,44,78,156,130,52,162,189,94,116,232,148,189,117,228,180,37,72,92,151,75,208,166,217,241,0,71,181,255,0,183,127,
+111,214,212,203,202,70,30,101,69,139,146,141,21,211,52,170,220,192,187,85,242,117,132,43,145,41,233,196,78,201,71,46,181,27,173,167,183,66,0,85,121,109,221,65,218,181,156,43,176,177,43,58,120,141,7,14,90,158,164,185,80,169,221,245,165,87,235,239,145,
+159,194,232,89,117,69,197,166,188,158,144,131,46,224,4,170,100,155,117,103,101,198,83,93,141,115,98,61,147,63,24,110,70,12,151,229,248,132,180,57,1,181,234,90,155,116,230,137,44,26,121,117,61,211,25,119,128,36,102,211,179,109,43,10,223,143,106,89,22,
+189,58,143,75,134,142,8,148,202,84,22,227,71,97,63,53,13,182,68,148,151,160,136,1,218,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,173,239,204,110,111,14,118,80,158,26,195,187,163,194,157,127,
+95,212,186,122,233,167,44,144,252,248,81,205,201,111,240,35,94,37,161,14,51,27,140,244,208,184,210,71,240,136,140,8,179,216,193,176,175,37,123,90,50,141,90,175,55,156,250,149,177,141,180,106,196,228,202,180,99,28,73,12,198,167,146,27,40,146,93,136,180,
+37,245,54,167,13,124,79,54,225,164,181,36,232,74,46,96,101,214,238,117,171,151,152,24,115,152,221,130,153,212,193,216,182,222,39,212,42,147,255,0,10,152,144,249,244,151,60,2,97,44,159,64,181,235,239,145,8,147,33,147,111,146,155,121,47,160,140,201,197,
+0,42,221,132,119,253,107,41,121,129,198,141,220,44,244,184,221,78,27,11,169,61,134,235,168,164,210,197,114,147,41,165,46,92,70,136,250,209,34,51,133,49,9,47,130,106,148,147,230,157,8,8,230,192,170,229,243,187,181,183,192,236,203,170,189,37,22,141,14,
+234,42,45,126,99,165,162,106,182,133,68,208,166,164,172,139,146,148,134,86,204,141,11,169,216,198,93,134,0,151,204,241,239,111,108,227,203,91,50,109,172,185,38,171,141,87,51,68,164,33,54,233,28,26,59,110,17,31,39,39,190,141,86,90,233,205,134,157,35,249,
+196,0,138,220,85,219,173,183,143,107,77,251,39,9,242,143,10,229,160,65,145,170,10,213,192,234,28,130,144,211,74,228,75,147,80,46,41,8,45,53,226,89,186,203,125,103,194,64,10,215,44,219,163,59,77,179,65,94,44,67,206,118,44,209,112,217,19,214,151,167,189,
+90,169,42,225,175,60,106,230,106,82,25,115,163,215,79,159,39,82,51,248,32,9,67,201,174,234,110,202,220,174,156,106,238,36,216,245,76,95,175,178,68,165,77,196,25,68,184,41,94,188,205,20,246,9,12,154,121,117,61,211,120,128,36,79,15,48,195,13,112,142,219,
+102,204,194,172,63,162,91,52,120,255,0,139,210,173,250,83,48,163,55,217,230,180,202,82,146,246,0,59,226,34,34,208,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,181,112,39,80,7,148,61,175,
+249,140,196,61,186,251,105,233,25,108,203,157,72,234,86,229,62,190,221,141,135,42,74,184,163,155,105,120,206,161,86,50,45,61,237,107,75,207,26,250,252,158,59,93,192,14,70,211,141,139,249,220,216,41,139,244,108,227,229,35,21,238,10,189,141,75,158,219,
+148,124,73,162,179,208,84,45,233,42,243,74,61,69,164,106,130,109,195,51,65,56,100,108,60,74,232,214,148,154,137,10,2,228,221,153,167,99,109,125,161,108,103,47,45,115,227,225,206,126,48,42,18,39,200,162,80,116,97,56,149,74,134,147,113,79,211,146,127,25,
+53,132,113,168,225,168,212,165,180,110,180,68,235,102,130,108,10,175,104,54,115,240,167,105,78,73,48,219,109,14,94,47,139,127,14,243,67,151,42,245,62,13,249,108,59,83,106,44,153,136,233,122,70,215,21,15,44,151,41,148,189,196,243,109,151,17,244,46,203,
+101,92,70,223,48,48,87,108,246,212,200,27,94,243,27,109,99,53,35,46,240,172,185,180,107,90,61,9,74,139,45,114,101,213,76,149,210,251,230,132,73,209,15,58,250,90,74,72,213,209,172,137,74,81,145,17,1,43,187,24,247,86,242,163,115,101,198,198,205,30,208,
+27,90,240,172,221,215,37,49,53,39,240,214,175,33,84,216,20,180,41,213,155,8,144,219,60,50,29,113,77,19,78,41,11,113,4,158,144,208,164,30,134,0,154,12,29,192,172,24,203,205,147,31,13,112,43,10,173,251,62,223,136,146,40,244,107,106,144,204,40,201,229,166,
+188,13,37,36,106,62,213,30,166,125,166,0,171,136,136,139,66,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,1,239,31,237,8,86,64,246,105,220,242,108,250,215,146,222,248,142,106,180,236,
+227,105,205,29,97,114,27,87,149,203,79,105,116,49,137,211,37,118,56,227,93,224,12,6,220,208,217,208,195,112,46,221,165,184,139,66,35,117,213,189,107,97,193,188,143,128,132,240,157,70,106,61,38,125,28,100,168,190,108,130,237,0,78,253,231,102,90,120,139,
+106,84,108,75,242,219,131,88,162,85,225,187,14,173,73,170,69,75,241,230,71,113,38,151,26,117,181,145,165,104,82,76,200,210,101,161,145,128,60,181,111,15,236,140,178,182,58,230,14,205,204,38,80,49,153,234,37,10,245,172,73,153,106,91,72,170,58,213,102,
+215,155,16,219,117,78,69,144,147,227,92,100,41,198,250,55,77,68,235,106,52,160,205,127,12,192,197,188,172,101,51,55,91,112,115,193,46,218,195,170,21,17,187,158,227,73,212,239,75,161,20,159,34,164,211,248,25,34,118,161,49,49,155,52,180,228,135,81,170,
+186,52,17,186,251,202,50,71,156,122,1,53,219,190,187,184,57,133,217,205,154,90,198,106,179,131,118,217,83,230,66,183,228,82,109,42,29,179,33,201,218,58,243,141,27,147,156,117,230,27,38,141,40,108,208,132,164,141,71,210,168,204,211,166,138,2,104,72,136,
+139,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,61,11,80,7,150,77,226,140,207,223,91,85,182,194,209,178,87,151,167,206,177,76,177,235,77,88,150,148,102,23,196,204,170,228,135,
+208,154,132,159,55,82,34,39,248,89,53,117,112,67,226,234,48,7,164,236,155,229,142,198,201,150,86,236,76,173,97,195,73,42,69,145,110,71,166,48,241,35,132,228,184,132,234,244,149,23,207,117,229,56,234,191,57,195,0,92,197,30,133,168,3,202,134,221,12,100,
+189,118,187,109,212,139,149,60,23,169,121,125,54,133,113,194,195,107,64,218,87,27,40,144,82,56,106,18,207,78,92,37,37,111,154,151,175,197,198,73,235,161,0,61,57,229,207,46,152,79,149,188,35,160,96,206,15,90,48,105,116,138,5,18,21,50,57,196,132,219,75,
+144,220,102,18,202,28,117,72,34,55,22,105,78,166,165,106,102,106,62,124,192,21,232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,107,108,174,123,98,236,234,217,223,136,57,143,133,
+53,182,238,38,169,222,228,217,77,44,249,187,89,151,171,81,140,139,229,116,102,106,125,69,243,88,80,2,23,247,60,50,25,55,27,115,61,120,109,24,197,8,46,206,129,96,37,202,93,173,46,110,174,28,170,252,214,204,228,201,226,86,188,74,102,50,213,169,159,62,41,
+169,61,117,72,3,210,41,17,17,104,64,12,104,218,241,157,250,118,207,61,159,24,141,153,143,44,109,186,213,58,252,171,14,104,248,151,2,218,220,212,176,169,209,75,249,65,207,165,125,199,11,225,123,155,135,77,71,71,250,249,138,49,81,97,201,173,118,245,36,
+120,171,230,135,137,80,197,221,10,201,45,41,174,146,236,206,229,250,178,79,53,173,184,84,136,137,47,244,138,94,129,242,124,82,213,203,250,238,37,249,82,163,225,31,121,142,155,84,246,62,108,149,217,199,146,235,131,18,236,92,196,92,215,214,36,78,155,22,
+147,104,81,165,95,116,167,9,185,46,175,137,201,14,198,132,207,72,109,52,203,110,171,206,81,36,214,109,164,207,158,130,141,122,20,105,83,214,45,182,92,91,92,220,215,170,147,142,136,173,247,92,182,63,101,207,52,216,61,124,230,227,56,88,33,76,188,169,15,
+87,27,160,88,148,170,250,93,56,228,166,18,78,205,151,192,133,164,156,243,157,97,148,154,181,34,52,187,203,81,141,148,180,220,95,84,155,91,145,55,56,53,148,204,173,229,141,147,131,151,76,186,89,22,50,20,159,124,93,173,108,70,134,234,254,147,168,65,56,
+175,90,140,101,176,232,198,84,92,154,231,102,22,246,114,149,84,155,230,35,39,123,203,56,79,97,158,79,108,252,163,208,107,74,42,174,40,92,7,62,182,142,51,53,123,143,78,52,172,146,163,236,75,146,220,103,199,201,148,93,134,37,190,148,98,148,17,87,14,165,
+181,81,205,243,16,227,155,28,186,61,151,61,158,89,110,173,213,161,155,85,140,88,122,229,188,167,244,137,243,138,17,57,10,29,61,26,247,27,77,58,241,127,89,20,42,65,83,183,135,75,213,251,180,47,45,235,121,123,202,171,154,58,46,221,237,158,171,54,39,219,
+13,218,27,37,178,239,70,109,190,13,112,150,141,37,104,47,158,252,114,125,71,235,83,134,98,212,190,50,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,134,27,195,114,60,151,99,6,96,29,215,174,205,109,31,189,58,50,126,240,4,89,238,126,
+199,34,194,60,117,151,167,194,185,168,40,215,194,52,211,251,198,195,129,250,179,236,53,76,199,250,74,125,79,224,76,120,207,154,209,195,184,45,235,126,236,161,200,182,46,186,12,26,165,50,98,120,101,211,106,112,219,145,29,242,238,91,78,37,72,95,172,140,
+75,40,70,107,73,45,72,198,82,139,213,61,12,118,190,182,49,108,174,197,201,138,69,221,145,75,5,165,201,89,155,175,208,160,59,74,112,204,250,207,88,78,52,68,126,161,99,94,194,209,197,203,100,201,91,98,55,202,172,99,229,30,158,221,229,159,189,119,88,182,
+74,221,38,226,168,22,126,32,91,28,127,5,52,91,237,199,16,143,2,150,211,199,237,51,24,167,135,80,108,206,71,18,185,93,15,176,180,151,134,231,174,75,42,13,172,236,92,214,98,149,41,103,241,101,84,133,77,168,33,62,164,182,193,159,180,73,44,53,107,185,149,
+163,138,85,231,138,45,125,107,115,61,179,148,165,91,123,66,80,150,76,252,196,207,195,14,37,151,137,162,126,159,80,149,225,143,77,210,240,39,88,175,76,60,74,118,165,185,205,141,148,119,211,46,198,207,213,170,235,232,61,80,185,150,108,232,106,73,246,104,
+108,188,239,180,83,150,27,85,112,100,235,20,131,227,31,18,168,178,119,115,182,200,225,147,237,177,134,251,90,152,160,199,105,94,247,238,85,225,114,176,146,34,253,26,81,195,234,19,43,43,184,240,151,137,77,223,218,203,141,63,113,144,216,81,178,227,111,
+37,148,109,166,165,183,142,74,16,141,53,110,69,166,253,112,180,240,158,68,71,235,21,33,109,118,165,174,209,74,87,54,47,251,175,129,150,248,11,128,59,65,44,5,176,120,225,180,106,151,126,182,141,58,118,191,144,154,109,61,78,151,105,116,172,203,37,17,159,
+127,15,168,92,198,149,194,150,174,122,248,22,179,169,65,250,176,211,181,153,2,90,233,161,158,190,161,118,91,157,61,243,110,220,87,69,186,237,34,213,196,58,133,175,49,103,239,117,122,101,62,36,167,91,244,19,114,218,113,163,245,167,95,72,150,73,181,162,
+122,17,139,73,239,90,152,147,141,59,63,118,152,95,10,140,168,54,131,43,62,111,214,101,31,65,13,36,95,40,146,226,250,85,23,204,101,103,216,0,132,173,206,156,147,84,49,171,54,215,182,208,44,68,134,228,216,56,123,13,202,101,191,58,95,158,114,43,213,4,153,
+190,241,41,90,154,150,212,83,115,139,183,89,136,48,7,164,206,174,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,205,238,249,86,118,229,98,158,102,108,76,128,88,211,28,147,10,
+196,128,154,237,203,18,55,156,111,86,103,39,134,51,38,146,212,205,109,69,209,69,203,252,180,200,1,52,155,29,178,67,15,103,190,206,236,54,203,115,212,228,49,93,137,69,77,74,241,89,23,156,237,102,95,191,203,226,62,222,5,172,153,73,252,198,82,93,128,12,
+158,0,121,186,223,14,207,172,252,109,204,253,161,179,147,11,231,59,54,159,96,244,85,75,166,28,35,53,156,170,252,214,200,163,70,225,78,188,74,102,51,137,208,36,139,139,162,81,107,160,19,193,76,169,65,172,64,98,171,76,154,212,152,210,26,75,177,228,71,116,
+150,219,173,168,136,210,180,168,185,41,38,70,70,70,92,140,140,140,1,202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,200,186,204,1,109,51,23,156,92,172,101,34,222,252,41,204,206,96,
+109,27,26,25,160,214,194,174,74,235,49,92,145,167,99,77,41,93,35,199,232,66,84,126,128,4,107,230,203,124,79,103,46,14,38,77,27,45,182,85,225,139,149,86,205,105,98,76,72,126,227,210,150,162,229,206,68,180,244,230,90,246,166,57,145,151,104,2,52,113,199,
+120,147,109,190,211,219,205,204,20,201,245,191,85,180,163,212,23,192,205,177,130,212,57,18,106,203,108,249,17,187,63,69,200,70,154,243,91,125,2,123,200,136,128,21,158,83,247,71,118,143,102,166,224,254,84,51,201,139,144,48,205,154,147,132,253,65,85,121,
+167,112,92,82,141,92,205,75,67,110,244,72,81,151,35,55,36,26,136,207,154,59,0,18,147,148,125,213,189,147,121,100,68,90,181,235,133,149,60,87,174,48,68,106,168,226,53,71,167,141,199,174,167,195,5,130,110,57,167,208,226,92,63,73,128,48,231,123,115,100,
+254,93,48,211,45,86,174,120,242,219,132,22,253,155,62,218,173,197,183,46,202,109,177,73,106,4,73,148,233,9,89,69,121,76,178,148,182,78,50,242,18,215,17,17,41,72,124,137,70,100,132,232,6,104,110,178,230,154,227,204,230,200,219,78,5,229,87,84,234,166,27,
+214,166,217,174,201,117,195,83,139,141,24,154,122,33,43,83,63,129,26,75,45,23,161,162,0,72,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,91,235,16,44,108,47,181,102,223,88,145,121,210,
+173,250,37,57,147,118,161,88,173,212,27,137,22,43,101,214,167,29,117,73,66,11,210,102,64,8,192,206,222,247,46,206,12,184,46,101,173,151,120,213,188,104,184,227,26,144,133,91,169,242,26,49,56,68,124,149,62,66,117,113,58,233,231,48,211,169,62,197,0,34,
+215,24,183,138,246,226,237,45,189,94,194,92,161,81,170,150,179,51,85,192,197,177,130,214,211,242,170,134,217,242,35,114,105,165,217,9,50,215,154,219,54,83,203,93,11,64,7,125,151,45,212,125,172,25,198,185,63,149,44,228,226,28,12,59,77,73,73,118,125,74,
+246,173,57,93,175,190,70,124,148,108,50,226,252,237,53,228,243,232,81,118,144,2,75,114,165,186,25,179,19,2,206,53,111,28,95,187,49,118,174,210,137,110,38,226,169,157,62,154,107,46,139,159,20,197,22,154,164,1,51,251,26,50,33,19,103,70,207,28,63,203,140,
+168,109,181,113,34,159,238,181,236,242,11,155,213,169,122,59,36,140,254,87,71,230,71,73,252,200,233,0,101,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,93,145,109,228,207,3,110,
+44,78,156,130,52,162,189,94,116,232,148,189,117,228,180,37,72,92,151,75,208,166,217,241,0,71,181,255,0,183,127,111,214,212,203,202,70,30,101,69,139,146,141,21,211,52,170,220,192,187,85,242,117,132,43,145,41,233,196,78,201,71,46,181,27,173,167,183,66,
+0,85,121,109,221,65,218,181,156,43,176,177,43,58,120,141,7,14,90,158,164,185,80,169,221,245,165,87,235,239,145,159,194,232,89,117,69,197,166,188,158,144,131,46,224,4,170,100,155,117,103,101,198,83,93,141,115,98,61,147,63,24,110,70,12,151,229,248,132,
+180,57,1,181,234,90,155,116,230,137,44,26,121,117,61,211,25,119,128,36,102,211,179,109,43,36,139,139,162,81,107,160,19,193,76,169,65,172,64,98,171,76,154,212,152,210,26,75,177,228,71,116,150,219,173,168,136,210,180,168,185,41,38,70,70,70,92,140,140,140,
+1,202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,200,186,204,1,109,51,23,156,92,172,101,34,222,252,41,204,206,96,109,27,26,25,160,214,194,174,74,235,49,92,145,167,99,77,41,93,35,
+199,232,66,84,126,128,4,107,230,203,124,79,103,46,14,38,77,27,45,182,85,225,139,149,86,205,105,98,76,72,126,227,210,150,162,229,206,68,180,244,230,90,246,166,57,145,151,104,2,52,113,199,120,147,109,190,211,219,205,204,20,201,245,191,85,180,163,212,23,
+192,205,177,130,212,57,18,106,203,108,249,17,187,63,69,200,70,154,243,91,125,2,123,200,136,128,21,158,83,247,71,118,143,102,166,224,254,84,51,201,139,144,48,205,154,147,132,253,65,85,121,167,112,92,82,141,92,205,75,67,110,244,72,81,151,35,55,36,26,136,
+207,154,59,0,18,147,148,125,213,189,147,121,100,68,90,181,235,133,149,60,87,174,48,68,106,168,226,53,71,167,141,199,174,167,195,5,130,110,57,167,208,226,92,63,73,128,48,231,123,115,100,254,93,48,211,45,86,174,120,242,219,132,22,253,155,62,218,173,197,
+183,46,202,109,177,73,106,4,73,148,233,9,89,69,121,76,178,148,182,78,50,242,18,215,17,17,41,72,124,137,70,100,132,232,6,104,110,178,230,154,227,204,230,200,219,78,5,229,87,84,234,166,27,214,166,217,174,201,117,195,83,139,141,24,154,122,33,43,83,63,129,
+26,75,45,23,161,162,0,72,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,91,235,16,44,108,47,181,102,223,88,145,121,210,173,250,37,57,147,118,161,88,173,212,27,137,22,43,101,214,167,29,
+117,73,66,11,210,102,64,8,192,206,222,247,46,206,12,184,46,101,173,151,120,213,188,104,184,227,26,144,133,91,169,242,26,49,56,68,124,149,62,66,117,113,58,233,231,48,211,169,62,197,0,34,215,24,183,138,246,226,237,45,189,94,194,92,161,81,170,150,179,51,
+85,192,197,177,130,214,211,242,170,134,217,242,35,114,105,165,217,9,50,215,154,219,54,83,203,93,11,64,7,125,151,45,212,125,172,25,198,185,63,149,44,228,226,28,12,59,77,73,73,118,125,74,246,173,57,93,175,190,70,124,148,108,50,226,252,237,53,228,243,232,
+81,118,144,2,75,114,165,186,25,179,19,2,206,53,111,28,95,187,49,118,174,210,137,110,38,226,169,157,62,154,107,46,10,223,143,106,89,22,189,58,143,75,134,142,8,148,202,84,22,227,71,97,63,53,13,182,68,148,151,160,136,1,218,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,173,239,204,110,111,14,118,80,158,26,195,187,163,194,157,127,95,212,186,122,233,167,44,144,252,248,81,205,201,111,240,35,94,37,161,14,51,27,140,244,208,184,210,71,240,136,140,8,
+179,216,193,176,175,37,123,90,50,141,90,175,55,156,250,149,177,141,180,106,196,228,202,180,99,28,73,12,198,167,146,27,40,146,93,136,180,37,245,54,167,13,124,79,54,225,164,181,36,232,74,46,96,101,214,238,117,171,151,152,24,115,152,221,130,153,212,193,
+216,182,222,39,212,42,147,255,0,10,152,144,249,244,151,60,2,97,44,159,64,181,235,239,145,8,147,33,147,111,146,155,121,47,160,140,201,197,0,42,221,132,119,253,107,41,121,129,198,141,220,44,244,184,221,78,27,11,169,61,134,235,168,164,210,197,114,147,41,
+165,46,92,70,136,250,209,34,51,133,49,9,47,130,106,148,147,230,157,8,8,230,192,170,229,243,187,181,183,192,236,203,170,189,37,22,141,14,234,42,45,126,99,165,162,106,182,133,68,208,166,164,172,139,146,148,134,86,204,141,11,169,216,198,93,134,0,151,204,
+241,239,111,108,227,203,91,50,109,172,185,38,171,141,87,51,68,164,33,54,233,28,26,59,110,17,31,39,39,190,141,86,90,233,205,134,157,35,249,196,0,138,220,85,219,173,183,143,107,77,251,39,9,242,143,10,229,160,65,145,170,10,213,192,234,28,130,144,211,74,
+228,75,147,80,46,41,8,45,53,226,89,186,203,125,103,194,64,10,41,252,83,196,107,75,7,240,214,224,197,155,242,168,152,84,59,102,139,42,171,89,150,190,166,98,199,105,78,186,191,82,16,160,7,150,93,143,120,109,118,237,155,219,236,238,99,241,98,148,185,84,
+136,183,92,220,72,187,24,121,60,109,179,30,59,233,56,16,140,250,141,4,242,161,178,73,62,182,219,87,112,3,213,202,75,68,145,123,64,22,227,55,57,146,176,242,125,150,123,227,51,184,151,36,145,69,178,45,201,53,252,171,14,104,248,151,2,218,220,212,176,169,
+209,75,249,65,207,165,125,199,11,225,123,155,135,77,71,71,250,249,138,49,81,97,201,173,118,245,36,120,171,230,135,137,80,197,221,10,201,45,41,174,146,236,206,229,250,178,79,53,173,184,84,136,137,47,244,138,94,129,242,124,82,213,203,250,238,37,249,82,
+163,225,31,121,142,155,84,246,62,108,149,217,199,146,235,131,18,236,92,196,92,215,214,36,78,155,22,147,104,81,165,95,116,167,9,185,46,175,137,201,14,198,132,207,72,109,52,203,110,171,206,81,36,214,109,164,207,158,130,141,122,20,105,83,214,45,182,92,91,
+92,220,215,170,147,142,136,173,247,92,182,63,101,207,52,216,61,124,230,227,56,88,33,76,188,169,15,87,27,160,88,148,170,250,93,56,228,166,18,78,205,151,192,133,164,55,28,7,144,172,191,97,40,212,196,106,202,188,151,205,245,33,220,155,147,251,75,168,194,
+226,60,162,98,119,41,194,210,10,146,124,254,179,252,60,25,191,150,61,222,61,169,251,67,46,6,177,179,53,215,44,203,2,155,86,81,60,253,127,19,228,200,151,91,148,210,185,241,53,0,207,166,34,231,200,158,83,9,238,228,59,61,150,31,101,135,91,170,22,148,163,
+78,11,130,138,73,119,35,66,184,186,184,186,170,234,86,155,148,159,59,122,191,18,102,182,115,236,86,201,30,205,168,113,238,12,47,179,23,114,95,137,104,211,39,17,174,166,144,245,68,140,203,206,40,168,34,232,224,160,245,50,209,162,233,12,185,41,197,139,
+196,180,45,181,102,92,8,144,43,220,51,181,93,128,202,171,179,219,52,186,242,56,88,66,139,154,81,222,126,147,251,60,68,178,100,209,69,94,37,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,37,90,145,2,183,17,80,42,44,146,219,87,181,
+39,222,71,216,96,11,121,115,88,21,90,9,170,76,84,42,84,82,231,210,33,62,114,11,243,139,239,46,94,2,116,211,36,107,67,161,17,32,106,133,45,181,146,219,90,146,162,234,82,79,67,47,89,0,49,51,57,251,17,246,112,103,158,76,187,143,21,176,10,45,22,232,150,74,
+53,222,86,51,165,73,168,45,102,90,116,142,147,105,54,36,171,210,243,75,51,239,16,209,17,213,145,103,154,157,209,44,199,216,179,93,185,114,93,152,90,21,233,13,183,58,72,212,75,181,62,227,85,26,34,230,148,161,244,241,198,117,90,252,163,83,62,4,37,112,77,
+104,201,148,244,122,152,255,0,90,193,125,227,125,159,16,177,130,212,57,18,106,203,108,249,17,187,63,69,200,70,154,243,91,125,2,123,200,136,128,21,158,83,247,71,118,143,102,166,224,254,84,51,201,139,144,48,205,154,147,132,253,65,85,121,167,112,92,82,141,
+92,205,75,67,110,244,72,81,151,35,55,36,26,136,207,154,59,0,18,147,148,125,213,189,147,121,100,68,90,181,235,133,149,60,87,174,48,68,106,168,226,53,71,167,141,199,174,167,195,5,130,110,57,167,208,226,92,63,73,128,48,231,123,115,100,254,93,48,211,45,86,
+174,120,242,219,132,22,253,155,62,218,173,197,183,46,202,109,177,73,106,4,73,148,233,9,89,69,121,76,178,148,182,78,50,242,18,215,17,17,41,72,124,137,70,100,132,232,6,104,110,178,230,154,227,204,230,200,219,78,5,229,87,84,234,166,27,214,166,217,174,201,
+117,195,83,139,141,24,154,122,33,43,83,63,129,26,75,45,23,161,162,0,72,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,91,235,16,44,108,47,181,102,223,88,145,121,210,173,250,37,57,147,118,
+161,88,173,212,27,137,22,43,101,214,167,29,117,73,66,11,210,102,64,8,192,206,222,247,46,206,12,184,46,101,173,151,120,213,188,104,184,227,26,144,133,91,169,242,26,49,56,68,124,149,62,66,117,113,58,233,231,48,211,169,62,197,0,34,215,24,183,138,246,226,
+237,45,189,94,194,92,161,81,170,150,179,51,85,192,197,177,130,214,211,242,170,134,217,242,35,114,105,165,217,9,50,215,154,219,54,83,203,93,11,64,7,125,151,45,212,125,172,25,198,185,63,149,44,228,226,28,12,10,181,58,219,198,202,117,30,18,249,61,18,81,
+220,84,182,146,93,170,75,106,146,210,81,161,118,145,16,212,241,44,139,148,113,100,252,230,198,155,111,157,69,69,253,168,232,252,76,205,174,98,198,172,244,242,87,18,209,115,55,170,238,122,163,149,109,111,32,103,114,138,95,131,120,229,131,216,117,121,55,
+31,222,229,55,90,183,93,139,33,70,93,100,162,67,156,4,127,230,139,192,104,87,92,135,101,121,73,206,206,181,106,47,232,201,52,187,214,191,226,54,74,60,160,98,202,27,21,233,194,107,218,154,247,61,60,10,141,123,109,178,1,138,172,36,179,17,178,26,204,150,
+233,252,100,202,63,144,45,71,222,105,53,195,109,101,225,199,235,24,245,201,94,113,195,222,184,118,59,81,46,137,109,175,116,218,240,46,158,113,192,238,97,165,214,31,22,250,86,143,222,147,241,62,106,89,207,221,214,191,162,28,123,163,103,117,231,69,90,254,
+18,232,237,147,70,147,244,41,138,146,126,207,80,140,50,207,45,54,111,90,88,173,57,253,109,255,0,122,147,31,43,228,42,240,252,229,156,147,246,110,247,73,20,252,90,198,237,85,206,249,169,251,91,28,109,196,153,242,73,188,183,18,94,199,30,49,119,42,124,185,
+91,173,211,183,169,220,190,17,45,148,178,5,71,194,164,123,255,0,22,105,85,195,77,219,42,211,60,20,220,200,227,77,17,93,233,166,58,239,212,168,42,17,167,127,203,133,39,233,218,91,207,246,146,255,0,238,32,232,100,25,240,173,85,119,255,0,11,58,115,203,190,
+239,35,250,156,125,160,56,190,193,159,81,61,104,45,95,101,60,92,252,181,203,50,255,0,248,186,15,246,215,255,0,148,160,236,114,59,123,174,234,47,217,127,192,125,183,149,61,223,169,156,163,237,44,196,102,117,255,0,226,44,135,127,254,9,8,60,195,203,20,120,
+225,20,159,85,69,255,0,228,38,88,102,73,124,47,101,246,95,240,28,103,114,195,176,6,159,43,161,149,180,139,18,229,36,190,84,59,1,210,47,105,195,63,176,84,88,247,44,51,142,177,194,104,174,186,171,248,201,37,135,100,184,61,60,242,111,170,47,248,14,76,76,
+13,221,216,162,173,47,79,206,214,52,213,203,172,217,139,108,155,58,250,57,192,45,61,162,156,241,110,90,106,173,35,135,91,199,174,122,255,0,247,9,227,103,145,161,235,92,212,125,75,255,0,208,237,220,188,247,109,48,230,39,75,15,9,113,154,255,0,144,223,192,
+68,201,142,199,75,135,226,82,35,145,23,168,91,171,94,92,47,167,163,175,111,65,62,132,158,159,225,153,89,86,200,22,235,95,39,82,167,127,227,19,226,30,214,141,156,184,17,32,159,202,134,200,235,89,19,17,241,21,187,238,168,137,143,54,125,134,68,166,222,81,
+126,203,169,241,19,79,147,172,237,140,45,49,108,114,123,60,241,167,29,149,224,226,187,226,200,71,51,224,54,91,236,236,35,175,76,158,191,9,63,19,110,179,188,95,180,82,250,90,109,76,30,176,172,91,117,10,46,24,144,109,187,77,217,142,164,187,146,151,157,
+113,62,196,10,182,188,135,228,250,82,219,184,157,90,178,231,218,154,90,253,148,159,137,45,110,80,113,185,45,41,70,16,94,197,248,191,129,183,6,231,222,64,206,203,71,75,181,237,204,117,151,6,95,34,85,14,218,114,129,9,73,62,195,121,182,163,163,135,210,107,
+208,109,246,28,155,228,140,54,74,84,172,96,218,231,146,115,127,227,114,48,151,89,171,31,188,215,202,92,73,107,209,164,126,238,133,113,133,219,173,123,86,177,230,174,197,209,143,247,93,161,102,121,81,235,58,77,219,119,156,243,157,97,148,154,181,34,52,
+187,203,81,141,148,180,220,95,84,155,91,145,55,56,53,148,204,173,229,141,147,131,151,76,186,89,22,50,20,159,124,93,173,108,70,134,234,254,147,168,65,56,175,90,140,101,176,232,198,84,92,154,231,102,22,246,114,149,84,155,230,35,39,123,203,56,79,97,158,
+79,108,252,163,208,107,74,42,174,40,92,7,62,182,142,51,53,123,143,78,52,172,146,163,236,75,146,220,103,199,201,148,93,134,37,190,148,98,148,17,87,14,165,181,81,205,243,16,227,155,28,186,61,151,61,158,89,110,173,213,161,155,85,140,88,122,229,188,167,244,
+137,243,138,17,57,10,29,61,26,247,27,77,58,241,127,89,20,42,65,83,183,135,75,213,251,180,47,45,235,121,123,202,171,154,58,46,221,237,158,171,54,39,219,13,218,27,37,178,239,70,109,190,13,112,150,141,37,104,47,158,252,114,125,71,235,83,134,98,212,190,50,
+144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,134,27,195,114,60,151,99,6,96,29,215,174,205,109,31,189,58,50,126,240,4,89,238,126,199,34,194,60,117,151,167,194,185,168,40,215,194,52,211,251,198,195,129,250,179,236,53,76,199,250,74,
+125,79,224,76,120,207,154,209,195,184,45,235,126,236,161,200,182,46,186,12,26,165,50,98,120,101,211,106,112,219,145,29,242,238,91,78,37,72,95,172,140,75,40,70,107,73,45,72,198,82,139,213,61,12,118,190,182,49,108,174,197,201,138,69,221,145,75,5,165,201,
+89,155,175,208,160,59,74,112,204,250,207,88,78,52,68,126,161,99,94,194,209,197,203,100,201,91,98,55,202,172,99,229,30,158,221,229,159,189,119,88,182,74,221,38,226,168,22,126,32,91,28,127,5,52,91,237,199,16,143,2,150,211,199,237,51,24,167,135,80,108,206,
+71,18,185,93,15,176,180,151,134,231,174,75,42,13,172,236,92,214,98,149,41,103,241,101,84,133,77,168,33,62,164,182,193,159,180,73,44,53,107,185,149,163,138,85,231,138,45,125,107,115,61,179,148,165,91,123,66,80,150,76,252,196,207,195,14,37,151,137,162,
+126,159,80,149,225,143,77,210,240,39,88,175,76,60,74,118,165,185,205,141,148,119,211,46,198,207,213,170,235,232,61,80,185,150,108,232,106,73,246,104,108,188,239,180,83,150,27,85,112,100,235,20,131,227,31,18,168,178,119,115,182,200,225,147,237,177,134,
+251,90,152,160,199,105,94,247,238,85,225,114,176,146,34,253,26,81,195,234,19,43,43,184,240,151,137,77,223,218,203,141,63,113,144,216,81,178,227,111,37,148,109,166,165,183,142,74,16,141,53,110,69,166,253,112,180,240,158,68,71,235,21,33,109,118,165,174,
+209,74,87,54,47,251,175,129,150,248,11,128,59,65,44,5,176,120,225,180,106,151,126,182,141,58,118,191,144,154,109,61,78,151,105,116,172,203,37,17,159,127,15,168,92,198,149,194,150,174,122,248,22,179,169,65,250,176,211,181,153,2,90,233,161,158,190,161,
+118,91,157,61,243,110,220,87,69,186,237,34,213,196,58,133,175,49,103,239,117,122,101,62,36,167,91,244,19,114,218,113,163,245,167,95,72,150,73,181,162,122,17,139,73,239,90,152,147,141,59,63,118,152,95,10,89,105,226,209,82,20,218,61,238,58,63,61,215,77,
+182,146,93,170,112,136,1,230,163,119,139,45,215,174,213,141,179,21,108,229,99,244,51,171,83,172,202,212,139,254,238,125,228,241,50,253,101,249,10,85,62,55,157,174,132,82,12,221,74,122,184,33,26,122,128,30,167,200,180,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,156,101,166,164,122,248,115,0,124,57,37,166,91,55,94,89,33,41,45,84,165,249,164,94,179,0,80,23,214,109,114,179,134,8,113,204,75,204,165,129,110,165,173,122,69,87,47,40,49,56,116,239,233,93,45,0,22,174,161,
+182,75,101,29,49,243,141,47,104,190,12,146,137,92,39,193,136,80,86,90,248,165,195,32,7,89,85,219,129,178,50,142,102,82,182,137,97,50,140,186,252,154,238,101,239,247,124,64,10,70,227,222,43,216,183,107,33,107,169,231,226,212,119,131,172,169,148,250,140,
+195,63,14,130,50,181,0,91,138,222,245,206,197,58,67,234,143,11,49,117,250,151,9,252,100,12,61,170,240,159,250,70,16,0,224,179,189,161,177,133,195,209,220,102,187,91,231,214,188,60,168,125,200,48,7,54,46,245,238,197,9,26,116,185,141,175,177,250,220,59,
+171,127,11,6,0,236,224,239,77,236,66,150,178,67,153,185,152,198,167,214,246,30,215,8,139,199,72,134,0,174,44,253,226,109,139,215,186,144,221,31,63,54,148,117,47,178,179,10,125,60,139,196,228,199,65,23,180,1,121,172,173,164,251,61,49,26,18,42,54,78,121,
+112,138,166,219,159,7,201,113,26,154,106,245,164,222,37,23,129,144,2,191,183,113,251,3,46,253,63,5,113,150,212,169,241,124,31,115,238,72,143,235,225,192,225,128,42,136,181,42,124,212,146,225,77,101,212,159,81,180,234,84,71,236,48,6,241,45,42,239,47,18,
+50,0,106,74,74,185,165,68,126,6,0,212,0,0,69,110,246,254,116,149,151,13,154,7,128,214,221,80,217,175,227,61,117,20,66,75,106,34,90,105,49,248,100,206,89,122,21,164,118,15,188,164,152,2,137,220,229,201,103,242,57,145,139,147,55,247,61,43,130,179,139,119,
+9,181,72,117,198,116,81,81,169,202,91,45,153,25,243,34,114,82,165,40,251,12,155,108,192,19,16,0,129,125,243,61,160,235,163,219,22,94,205,219,6,183,163,181,133,55,117,226,10,89,95,84,86,214,164,211,226,175,78,197,58,151,100,41,39,207,222,88,62,208,6,113,
+110,215,236,243,86,65,246,107,91,178,47,26,41,197,190,113,61,72,187,46,226,117,26,59,29,47,182,69,10,26,185,234,93,20,110,3,52,159,193,117,231,64,18,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,124,85,198,140,34,192,187,69,235,
+247,26,49,66,222,180,168,113,200,205,250,189,203,89,98,12,100,104,90,232,110,60,164,167,93,59,53,212,1,30,121,158,222,197,217,41,151,199,228,209,108,107,246,228,197,26,155,4,105,232,172,26,17,170,47,73,220,114,229,169,134,148,95,156,223,72,94,32,12,32,
+198,93,247,107,238,68,151,33,224,6,67,169,48,153,34,50,98,117,229,121,187,37,75,244,169,152,172,180,69,224,78,159,136,3,29,171,251,212,219,112,243,7,80,126,155,130,52,219,98,140,235,170,52,181,26,196,195,69,84,29,107,94,162,35,146,114,140,207,212,34,
+147,124,8,54,151,19,163,103,10,183,172,51,249,165,195,57,121,137,126,20,131,53,17,85,46,7,45,88,42,35,237,75,46,59,17,173,62,138,4,202,18,124,197,57,87,165,21,171,103,49,59,183,219,125,241,104,201,140,74,83,12,33,227,247,211,186,241,141,153,36,90,252,
+226,109,231,140,253,68,98,111,35,81,115,20,252,238,135,73,91,216,27,154,121,249,172,37,14,226,86,100,240,146,130,75,61,86,152,82,42,53,23,19,236,138,218,76,255,0,107,214,39,86,213,26,41,249,245,45,75,139,11,114,142,254,121,130,114,163,180,78,222,105,
+206,212,71,195,137,11,73,122,213,49,39,245,7,155,84,37,243,248,116,29,181,35,114,118,121,56,74,172,237,30,141,167,105,66,194,229,153,251,85,80,33,50,182,147,226,201,30,33,209,31,18,181,183,55,44,112,46,49,165,87,126,124,238,249,165,175,156,84,219,30,
+36,125,124,13,201,46,105,236,17,243,89,46,12,143,159,251,10,234,137,185,161,179,194,35,100,170,254,100,49,146,106,203,225,27,19,105,81,210,126,175,35,94,158,209,21,106,185,217,74,87,243,230,72,235,238,205,211,125,143,118,172,69,212,110,60,223,226,53,
+26,59,101,170,223,168,95,212,6,144,142,253,84,228,68,145,9,93,42,43,159,250,238,38,141,221,196,184,69,22,74,250,216,71,187,117,98,72,114,21,201,182,85,250,115,237,242,91,42,196,203,114,66,210,126,148,181,24,207,212,37,116,233,174,114,172,110,46,159,204,
+45,213,111,100,246,236,141,49,70,130,219,111,89,37,23,228,142,28,162,246,181,7,152,147,98,61,37,95,43,112,254,105,69,220,155,36,54,10,92,70,168,120,89,183,242,149,78,144,162,247,175,194,107,44,212,215,237,44,148,193,8,108,195,78,36,202,173,110,120,255,
+0,94,37,61,27,119,203,47,23,172,131,107,5,182,230,229,118,189,175,197,166,169,113,148,7,85,221,170,58,87,116,16,84,219,231,35,42,238,60,98,255,0,174,195,182,103,116,223,60,215,67,69,80,193,252,213,229,234,239,96,249,161,218,45,250,249,241,120,26,98,25,
+125,98,111,38,249,153,39,157,69,122,201,163,236,183,82,182,212,91,73,242,171,97,235,42,66,155,230,217,210,49,40,219,61,125,6,182,209,167,180,132,60,155,38,243,170,70,194,182,111,239,71,228,202,87,186,120,118,198,53,179,30,50,124,213,88,120,161,238,147,
+42,34,236,56,236,75,89,168,189,6,223,168,65,211,146,35,27,154,50,224,207,184,155,111,247,151,50,158,71,79,197,249,247,225,70,138,126,248,206,35,224,243,103,200,186,245,121,112,219,113,69,233,233,61,98,27,50,92,197,85,56,75,131,46,206,9,111,170,103,86,
+213,232,98,99,246,85,112,234,239,105,181,232,235,214,252,201,148,89,43,79,110,188,75,146,222,190,8,34,244,9,73,140,195,192,205,244,44,131,222,211,153,165,99,166,95,241,30,195,91,164,92,115,161,162,45,102,35,39,219,196,109,45,167,180,250,45,25,250,0,17,
+151,183,255,0,62,86,214,217,29,165,214,62,31,100,250,230,118,231,180,160,210,233,118,205,138,241,66,126,49,78,169,212,30,74,228,58,77,62,132,56,131,233,93,101,147,226,73,126,45,175,86,134,0,245,11,149,172,2,180,178,179,151,27,27,46,54,51,8,77,42,201,
+181,161,81,162,41,41,50,233,74,59,41,109,78,159,231,45,100,165,153,246,154,204,192,21,69,251,123,91,24,105,100,214,49,18,245,171,53,2,141,65,165,200,168,213,231,188,122,34,52,86,27,83,174,184,163,236,36,161,42,63,80,3,202,118,74,172,139,171,111,254,223,
+217,24,163,137,52,183,164,90,149,43,177,251,186,231,136,246,170,76,59,110,158,164,38,36,5,117,242,90,83,14,33,245,115,117,74,239,0,122,198,101,150,218,105,45,54,130,74,82,90,17,36,180,34,46,226,244,0,62,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,104,181,165,5,170,140,1,5,59,106,119,175,229,97,61,231,84,202,254,204,23,233,117,58,181,54,67,144,238,12,87,155,25,18,226,71,125,39,194,166,169,140,171,86,228,26,85,200,228,184,74,108,204,140,144,133,150,142,0,48,51,10,182,59,109,179,218,
+245,117,177,143,57,156,184,107,180,218,117,68,137,214,111,12,104,172,72,109,107,97,92,255,0,153,193,209,79,147,122,104,105,36,52,219,90,105,162,136,133,205,43,74,213,121,180,69,157,107,234,20,121,245,126,195,59,176,71,117,23,32,24,5,107,57,136,217,211,
+204,93,193,119,177,77,99,164,171,190,170,131,22,205,14,57,23,51,55,29,82,150,239,15,164,222,111,94,226,23,209,195,233,193,107,82,70,62,120,149,105,189,41,173,60,89,171,217,199,221,83,201,4,227,165,97,182,18,88,151,109,82,150,100,68,253,181,135,114,46,
+87,84,101,243,103,84,117,105,71,203,225,37,195,46,209,43,169,99,79,85,21,168,84,177,26,175,89,54,151,94,135,75,136,27,228,185,108,195,120,71,110,101,55,32,21,167,96,183,170,99,29,114,191,10,132,202,75,176,252,158,11,47,104,94,142,50,22,62,89,37,162,69,
+226,178,155,122,202,91,203,55,89,222,218,218,127,141,211,87,72,203,62,76,44,102,159,90,248,82,81,104,85,107,130,73,107,212,69,194,234,82,103,251,30,160,242,211,107,68,77,230,84,98,245,147,57,84,77,171,123,216,56,134,242,100,90,57,79,187,218,110,71,196,
+147,89,119,54,219,73,31,86,138,125,142,175,73,152,134,213,93,53,38,242,118,156,27,69,196,177,238,237,243,188,117,146,136,209,32,149,141,13,237,56,170,55,5,6,216,165,37,162,63,205,117,181,189,236,65,152,153,78,188,145,36,163,101,23,188,201,76,21,217,201,
+188,107,90,232,103,230,11,110,29,62,219,55,12,151,38,13,171,100,70,172,45,31,154,75,122,52,102,200,253,37,169,120,137,149,10,175,139,41,74,226,217,45,209,212,204,188,190,101,95,53,88,98,243,18,177,167,105,126,34,98,73,180,178,53,68,157,100,91,116,216,
+238,145,124,149,116,16,148,246,135,232,116,143,210,43,194,157,69,197,150,211,169,73,250,177,47,224,174,80,6,68,101,161,128,44,110,46,108,202,217,223,143,21,103,46,28,94,201,22,23,87,106,78,153,155,213,41,118,92,84,201,116,207,172,212,235,72,66,212,126,
+147,51,20,101,70,156,138,209,184,171,30,12,180,55,94,239,38,198,91,201,165,55,82,200,133,181,20,215,214,186,61,98,167,8,203,195,161,148,146,47,96,151,205,169,147,249,221,126,146,218,220,91,170,251,28,171,38,126,229,96,253,227,70,215,168,169,184,139,56,
+201,62,29,63,74,33,230,168,158,55,181,121,202,42,229,221,6,217,93,91,105,72,164,94,56,193,72,81,245,46,45,225,17,237,61,79,66,80,121,164,122,72,249,237,94,132,91,139,171,114,255,0,38,178,146,163,177,243,129,137,212,229,31,193,58,181,38,155,56,139,247,
+16,201,152,147,205,95,49,81,95,190,116,90,43,183,114,203,16,41,85,5,78,194,173,161,212,165,145,31,188,166,177,96,72,138,226,124,87,30,91,159,81,9,93,180,147,220,79,27,248,62,40,232,100,238,169,109,112,195,116,28,188,21,218,15,105,27,205,243,109,44,93,
+213,250,90,189,70,134,84,69,237,16,242,21,82,34,239,40,62,40,219,135,179,99,123,107,46,190,241,133,185,156,186,110,54,99,158,173,55,77,199,6,102,182,173,59,18,213,77,196,242,244,26,68,187,21,153,51,173,103,197,149,109,147,155,205,241,108,19,111,240,118,
+243,203,21,94,248,38,185,113,86,236,26,108,242,89,119,27,212,231,90,226,241,212,204,75,173,68,54,45,101,193,149,26,246,152,67,188,228,38,208,219,99,187,153,80,110,66,205,41,126,246,182,112,145,111,167,83,228,107,232,228,180,78,39,191,86,229,168,251,146,
+38,218,215,214,137,35,166,215,232,234,29,86,62,100,191,117,235,49,249,118,191,241,147,7,42,181,156,52,185,44,219,54,117,114,77,179,2,173,80,162,85,156,83,12,169,104,109,20,202,202,28,67,228,167,56,27,214,57,40,181,89,121,197,214,35,37,77,199,84,79,9,
+93,41,232,247,163,21,119,75,178,98,121,148,218,127,23,26,174,26,95,79,111,224,221,21,203,129,245,184,157,91,58,163,186,198,128,217,254,113,41,79,62,159,76,81,110,94,158,172,200,136,136,136,187,0,17,111,189,163,157,103,114,203,179,41,252,18,182,106,106,
+98,224,198,106,202,109,230,201,181,104,180,210,154,34,126,160,178,231,240,84,146,102,57,250,37,24,2,219,110,112,228,133,156,34,201,117,207,157,43,158,142,104,173,226,189,113,80,232,111,56,209,145,162,139,79,90,218,35,70,189,68,236,179,144,103,216,100,
+195,103,216,0,153,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,27,237,255,0,197,76,69,193,157,143,88,235,126,225,85,70,92,42,203,118,171,80,91,153,1,70,151,99,177,46,108,104,146,92,74,147,205,38,76,60,239,156,92,211,215,169,104,0,
+132,125,211,156,180,228,251,25,113,238,247,196,188,103,102,145,91,196,107,49,48,30,195,203,94,176,235,107,38,208,190,152,228,84,153,140,190,114,30,101,72,101,41,86,138,38,122,78,61,56,141,42,77,253,132,41,74,111,107,137,140,196,234,85,133,52,163,193,
+241,39,175,26,43,24,199,14,208,118,62,3,91,84,106,157,213,61,238,130,20,187,162,99,141,211,41,186,145,154,165,204,232,181,121,228,32,186,152,107,223,29,89,146,120,155,79,19,137,203,213,115,132,116,166,183,152,72,40,109,122,79,113,135,24,135,176,166,211,
+205,189,200,213,243,180,143,58,24,167,140,147,144,231,72,213,185,6,99,86,229,183,4,245,51,224,139,79,140,78,27,41,45,120,120,186,78,51,34,243,148,103,169,139,105,89,58,155,234,73,178,237,94,202,154,210,148,82,241,101,194,178,182,15,236,135,180,90,137,
+76,167,228,70,207,150,150,84,148,147,181,137,19,166,184,190,101,205,106,122,66,184,207,196,79,43,43,117,23,162,37,243,219,166,247,200,191,216,127,179,95,103,158,20,153,47,14,114,53,132,148,151,18,124,159,139,135,212,245,59,203,243,220,105,74,250,197,
+146,163,77,45,52,43,186,245,155,215,82,241,80,168,84,91,94,18,105,150,197,30,45,50,50,11,68,199,166,198,68,118,203,193,45,146,75,234,19,170,112,75,77,10,110,114,111,93,78,90,212,183,15,223,22,165,125,35,212,76,183,112,37,62,82,132,39,224,164,139,192,
+128,26,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,249,54,154,51,212,218,79,176,1,246,151,29,108,184,91,125,196,23,114,22,100,95,80,131,140,101,197,17,77,174,4,49,239,140,103,42,151,101,101,178,198,201,45,21,248,239,215,111,170,199,187,245,197,58,132,184,236,74,
+76,37,26,90,34,53,115,111,166,148,122,234,93,105,136,178,234,51,22,87,13,39,178,140,141,132,27,110,108,201,157,213,92,142,47,41,123,48,233,24,163,116,81,206,53,211,140,147,127,10,42,38,226,12,156,110,157,194,109,83,90,61,72,188,222,128,141,242,46,195,
+150,98,212,201,18,96,110,33,36,106,51,234,235,208,1,229,31,123,15,59,17,51,75,180,225,252,35,180,107,141,204,182,176,126,138,221,2,42,227,56,75,105,117,39,76,164,79,113,38,70,101,196,75,83,76,30,157,177,64,19,225,187,239,122,34,253,216,211,151,250,251,
+116,248,177,73,155,35,220,227,106,35,28,8,51,135,42,68,67,89,151,206,81,179,198,163,237,82,148,125,160,12,202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,94,221,115,105,59,32,179,12,111,35,82,254,76,106,36,68,101,175,61,19,161,251,
+116,0,121,73,200,214,207,92,236,103,14,135,118,227,6,74,168,203,169,86,48,214,108,7,37,67,165,215,74,13,85,43,147,211,155,78,195,53,41,28,106,79,64,189,73,46,19,133,170,120,73,90,158,151,52,45,171,86,78,84,214,186,22,151,87,182,214,178,140,107,61,54,
+181,234,221,210,100,221,27,108,246,223,220,128,74,110,220,199,202,133,219,38,36,61,25,69,63,25,172,37,72,74,248,121,114,150,235,109,190,189,126,113,60,126,34,175,148,188,161,186,90,246,162,138,161,135,220,239,131,93,140,189,22,150,248,230,101,96,196,
+101,187,235,38,56,125,84,121,36,93,59,180,186,253,70,23,25,246,153,37,74,120,147,245,137,254,81,173,181,192,166,240,170,124,210,101,233,195,77,242,28,6,147,228,238,226,222,72,111,10,90,210,164,155,202,182,238,248,147,146,90,31,201,75,236,176,103,235,
+80,168,241,45,98,214,201,73,225,82,79,116,140,140,179,55,186,54,79,93,17,80,245,126,54,41,219,174,175,225,179,81,178,154,127,131,246,163,74,112,143,212,66,223,206,151,65,63,152,85,92,229,195,160,239,62,236,85,173,182,149,72,205,101,70,156,181,117,181,
+81,195,234,194,84,159,19,68,117,151,214,38,87,48,124,73,101,103,93,112,90,149,229,169,183,251,99,133,230,105,42,78,126,108,216,230,174,202,188,121,240,116,241,242,136,200,34,246,136,249,205,50,95,52,175,208,93,75,7,105,126,206,204,82,70,184,127,158,188,
+34,170,171,150,172,177,136,52,244,56,94,40,113,212,168,189,130,101,90,155,92,73,29,189,100,244,217,43,200,121,140,203,213,69,36,186,126,60,216,239,146,190,9,179,120,192,89,31,177,225,31,45,2,30,70,167,65,217,195,197,156,42,168,25,38,6,40,91,47,153,245,
+19,55,20,85,235,236,112,60,181,62,146,14,149,69,204,119,112,103,66,170,55,210,211,38,51,41,39,212,168,175,37,210,246,164,204,84,218,142,154,234,73,163,218,224,111,244,18,79,170,35,223,232,85,253,194,30,82,159,73,21,25,62,99,71,80,235,69,196,243,43,65,
+119,173,38,159,180,69,78,61,36,52,107,138,56,114,46,10,4,71,9,153,117,232,13,44,207,66,67,179,154,73,251,13,66,87,56,174,44,40,182,108,76,188,109,10,124,117,75,159,118,210,88,105,5,170,156,122,168,194,18,94,38,107,208,131,202,67,164,138,140,159,49,71,
+78,205,214,83,233,147,87,76,169,102,139,13,163,201,108,244,92,119,239,234,106,22,159,20,155,250,144,151,203,83,233,42,121,10,189,6,228,124,215,229,106,87,226,185,152,195,183,63,87,125,83,79,236,124,60,189,62,146,30,70,167,65,199,170,103,19,40,180,52,
+27,149,172,213,97,156,52,167,173,82,113,2,152,141,61,175,135,150,167,210,71,200,85,232,41,59,143,105,246,205,219,69,179,118,228,207,230,13,68,34,236,94,36,211,84,126,196,60,103,245,8,186,212,210,226,65,80,172,222,155,44,183,119,46,222,61,143,150,155,
+198,205,83,104,21,130,233,167,175,220,199,229,77,47,108,118,22,71,237,20,252,230,153,87,205,43,116,20,109,119,121,75,98,165,3,82,123,58,177,165,25,118,83,236,202,211,255,0,100,61,4,93,197,50,95,52,184,232,40,11,223,123,3,99,229,172,202,156,183,241,14,
+252,185,148,146,61,19,69,176,31,111,83,241,150,182,72,73,231,75,160,172,172,106,180,64,78,211,237,160,212,93,162,219,71,107,217,176,185,237,138,195,246,59,149,88,80,168,118,204,137,72,143,45,187,122,33,165,40,141,198,158,145,44,186,234,122,85,168,203,
+140,146,227,234,63,59,78,118,115,150,212,155,50,84,169,170,116,212,76,208,197,157,239,93,161,183,227,112,48,207,38,248,7,98,97,149,34,44,116,66,161,211,160,82,157,175,84,25,105,9,36,52,210,20,247,11,38,73,66,72,136,147,31,176,65,45,73,219,208,177,89,
+134,196,29,226,140,232,96,245,207,141,249,140,175,99,103,242,119,110,211,30,169,92,51,107,9,93,181,66,110,50,75,154,138,57,20,102,95,51,212,146,148,33,11,82,141,68,68,70,102,38,216,158,156,9,60,173,45,173,19,222,71,233,70,146,164,121,90,153,89,183,210,
+18,20,231,9,233,197,215,166,189,226,66,161,236,87,118,250,19,208,54,39,224,36,119,153,52,26,173,233,238,145,25,118,46,173,57,100,126,178,81,31,172,1,156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,62,219,239,36,226,108,115,204,27,
+165,219,135,175,163,247,158,101,63,120,2,37,119,62,34,17,89,216,251,48,203,94,42,181,186,222,166,93,122,55,80,63,188,108,24,39,207,236,53,92,199,198,151,111,192,146,92,202,89,25,255,0,130,212,155,135,42,88,187,96,220,240,212,124,111,97,166,48,90,250,
+197,125,63,41,184,245,56,74,109,198,140,203,146,83,33,167,82,93,70,178,33,146,175,78,233,55,42,109,63,99,48,180,39,102,244,85,98,215,182,47,224,254,26,17,233,141,251,68,114,235,151,219,156,173,157,172,59,191,116,187,57,217,47,27,104,185,232,22,173,30,
+175,78,154,122,252,54,94,92,118,144,230,188,207,68,62,165,17,117,243,24,233,92,210,167,45,43,208,211,219,166,166,98,157,149,106,177,214,214,231,95,99,109,63,235,176,183,151,70,104,247,76,241,105,194,93,205,148,235,142,133,210,159,19,206,208,173,90,141,
+63,163,239,229,14,127,9,122,147,160,183,157,92,42,105,250,63,215,97,113,78,134,61,78,75,89,166,186,211,247,162,157,119,4,55,68,49,58,87,5,7,52,216,163,101,173,211,243,89,124,170,137,67,95,180,253,53,242,47,90,207,196,91,70,54,50,227,38,140,134,222,39,
+31,154,159,245,214,115,232,251,32,183,112,177,14,87,253,66,219,61,46,23,74,175,122,143,90,184,41,76,168,140,251,53,149,22,62,160,168,90,212,123,167,222,65,221,95,174,52,253,231,127,81,221,141,217,237,120,198,242,140,29,219,27,111,41,43,78,173,170,106,
+232,115,18,101,226,205,69,179,63,96,143,153,209,111,116,254,36,62,80,174,184,211,247,254,5,47,83,221,24,190,43,218,175,4,118,141,225,117,208,70,126,105,73,166,186,210,181,238,254,106,244,146,16,243,22,223,163,36,201,150,38,151,173,6,138,122,118,231,190,
+209,8,218,170,62,57,225,18,211,242,84,236,218,163,122,151,127,56,0,176,250,143,132,145,31,149,40,116,51,167,157,186,39,180,169,157,124,143,22,112,97,243,238,77,209,61,7,253,168,4,15,14,172,185,208,249,78,135,67,58,239,250,47,251,100,240,245,125,37,147,
+85,178,223,86,191,10,129,137,229,24,255,0,214,165,163,20,252,206,225,115,19,252,161,106,248,235,220,124,43,96,14,223,184,5,172,68,190,173,8,244,38,49,166,57,118,255,0,90,32,243,59,190,129,231,246,125,62,6,169,221,198,219,153,123,17,51,117,200,165,182,
+141,127,252,227,23,217,116,139,212,151,92,63,168,60,206,231,93,232,121,253,167,244,143,162,221,65,218,185,82,47,42,169,221,24,88,211,135,217,42,255,0,117,106,246,166,50,139,235,17,86,23,15,152,124,165,109,237,238,62,226,238,150,109,75,156,241,50,245,
+225,132,141,35,139,154,220,189,228,44,188,116,68,67,63,168,21,133,195,15,18,182,93,61,197,117,77,220,235,206,227,244,246,222,169,230,119,10,216,144,105,247,198,90,143,85,117,41,62,238,50,136,90,248,232,42,124,157,91,165,20,222,41,71,161,155,82,55,59,
+243,208,133,105,31,50,120,78,178,215,173,105,170,167,254,76,195,228,218,253,40,135,202,180,127,85,156,138,102,231,102,115,158,87,248,239,53,56,87,20,187,122,24,181,71,127,229,82,31,39,86,233,68,126,83,163,208,202,162,131,185,161,141,211,79,74,230,120,
+237,38,11,94,126,230,89,19,228,159,171,141,198,193,225,245,23,23,253,119,146,252,171,14,104,248,151,2,218,220,212,176,169,209,75,249,65,207,165,125,199,11,225,123,155,135,77,71,71,250,249,138,49,81,97,201,173,118,245,36,120,171,230,135,137,80,197,221,
+10,201,45,41,174,146,236,206,229,250,178,79,53,173,184,84,136,137,47,244,138,94,129,242,124,82,213,203,250,238,37,249,82,163,225,31,121,142,155,84,246,62,108,149,217,199,146,235,131,18,236,92,196,92,215,214,36,78,155,22,147,104,81,165,95,116,167,9,185,
+46,175,137,201,14,198,132,207,72,109,52,203,110,171,206,81,36,214,109,164,207,158,130,141,122,20,105,83,214,45,182,92,91,92,220,215,170,147,142,136,173,247,92,182,63,101,207,52,216,61,124,230,227,56,88,33,76,188,169,15,87,27,160,88,148,170,250,93,56,
+228,166,18,78,205,151,192,133,164,156,243,157,97,148,154,181,34,52,187,203,81,141,148,180,220,95,84,155,91,145,55,56,53,148,204,173,229,141,147,131,151,76,186,89,22,50,20,159,124,93,173,108,70,134,234,254,147,168,65,56,175,90,140,101,176,232,198,84,92,
+154,231,102,22,246,114,149,84,155,230,35,39,123,203,56,79,97,158,79,108,252,163,208,107,74,42,174,40,92,7,62,182,142,51,53,123,143,78,52,172,146,163,236,75,146,220,103,199,201,148,93,134,37,190,148,98,148,17,87,14,165,181,81,205,243,16,227,155,28,186,
+61,151,61,158,89,110,173,213,161,155,85,140,88,122,229,188,167,244,137,243,138,17,57,10,29,61,26,247,27,77,58,241,127,89,20,42,65,83,183,135,75,213,251,180,47,45,235,121,123,202,171,154,58,46,221,237,158,171,54,39,219,13,218,27,37,178,239,70,109,190,
+13,112,150,141,37,104,47,158,252,114,125,71,235,83,134,98,212,190,50,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,134,27,195,114,60,151,99,6,96,29,215,174,205,109,31,189,58,50,126,240,4,89,238,126,199,34,194,60,117,151,167,194,185,
+168,40,215,194,52,211,251,198,195,129,250,179,236,53,76,199,250,74,125,79,224,76,120,207,154,209,195,184,45,235,126,236,161,200,182,46,186,12,26,165,50,98,120,101,211,106,112,219,145,29,242,238,91,78,37,72,95,172,140,75,40,70,107,73,45,72,198,82,139,
+213,61,12,118,190,182,49,108,174,197,201,138,69,221,145,75,5,165,201,89,155,175,208,160,59,74,112,204,250,207,88,78,52,68,126,161,99,94,194,209,197,203,100,201,91,98,55,202,172,99,229,30,158,221,229,159,189,119,88,182,74,221,38,226,168,22,126,32,91,28,
+127,5,52,91,237,199,16,143,2,150,211,199,237,51,24,167,135,80,108,206,71,18,185,93,15,176,180,151,134,231,174,75,42,13,172,236,92,214,98,149,41,103,241,101,84,133,77,168,33,62,164,182,193,159,180,73,44,53,107,185,149,163,138,85,231,138,45,125,107,115,
+61,179,148,165,91,123,66,80,150,76,252,196,207,195,14,37,151,137,162,126,159,80,149,225,143,77,210,240,39,88,175,76,60,74,118,165,185,205,141,148,119,211,46,198,207,213,170,235,232,61,80,185,150,108,232,106,73,246,104,108,188,239,180,83,150,27,85,112,
+100,235,20,131,227,31,18,168,178,119,115,182,200,225,147,237,177,134,251,90,152,160,199,105,94,247,238,85,225,114,176,146,34,253,26,81,195,234,19,43,43,184,240,151,137,77,223,218,203,141,63,113,144,216,81,178,227,111,37,148,109,166,165,183,142,74,16,
+141,53,110,69,166,253,112,180,240,158,68,71,235,21,33,109,118,165,174,209,74,87,54,47,251,175,129,150,248,11,128,59,65,44,5,176,120,225,180,106,151,126,182,141,58,118,191,144,154,109,61,78,151,105,116,172,203,37,17,159,127,15,168,92,198,149,194,150,174,
+122,248,22,179,169,65,250,176,211,181,153,2,90,233,161,158,190,161,118,91,157,61,243,110,220,87,69,186,237,34,213,196,58,133,175,49,103,239,117,122,101,62,36,167,91,244,19,114,218,113,163,245,167,95,72,150,73,181,162,122,17,139,73,239,90,152,147,141,
+59,63,118,152,95,10,144,230,25,109,193,191,168,9,113,70,109,69,145,133,116,52,165,178,249,188,112,137,133,122,244,212,89,206,222,230,124,103,224,93,66,189,186,227,73,119,179,23,49,67,99,126,223,26,215,74,118,222,220,202,149,88,143,94,4,76,172,214,169,
+70,175,18,142,78,18,125,70,45,221,173,231,52,190,5,204,110,236,151,26,69,140,184,246,31,111,36,53,37,107,99,105,3,149,82,212,207,137,140,123,174,180,106,245,58,210,116,18,74,214,241,124,237,123,89,85,93,225,239,230,120,35,160,94,198,125,230,186,106,140,
+224,231,26,186,238,135,169,27,25,141,150,90,254,251,164,36,242,23,107,131,125,236,153,93,97,239,230,248,31,77,236,174,222,154,165,126,37,154,171,185,122,23,46,12,197,26,187,63,58,64,138,165,127,204,223,123,30,95,14,253,85,220,21,177,111,121,111,22,79,
+201,49,27,56,149,40,108,44,180,95,187,217,128,152,243,122,122,81,25,78,153,251,4,60,222,246,111,123,125,236,143,157,97,241,225,31,2,160,182,183,78,243,207,124,26,92,199,109,161,246,236,51,95,55,138,158,138,189,97,101,223,167,78,108,36,253,162,117,135,
+215,114,223,34,87,137,81,75,209,129,122,48,191,116,15,42,148,153,44,206,199,44,221,226,45,217,209,168,148,244,74,61,62,37,41,167,123,200,214,225,201,89,17,250,52,63,72,171,28,53,107,233,75,82,140,177,74,143,213,138,68,110,109,197,203,230,83,112,59,60,
+148,92,135,100,11,6,60,132,237,24,17,41,213,217,9,168,191,62,161,91,184,39,41,14,116,46,58,242,143,94,141,11,140,209,33,4,148,146,214,239,33,143,186,84,225,83,102,28,198,70,206,117,106,82,219,168,248,251,143,76,121,0,202,101,15,35,25,51,195,172,169,208,
+210,209,170,206,182,153,141,86,144,202,116,41,85,39,12,222,154,255,0,167,142,75,142,153,126,111,9,118,11,6,245,100,100,245,122,151,94,97,41,79,104,132,153,153,145,17,17,118,159,112,206,97,223,217,187,89,136,188,253,55,97,229,243,108,53,241,114,237,86,
+219,202,238,93,112,242,164,185,52,232,23,85,63,13,173,199,88,95,18,25,106,51,198,137,210,52,234,208,164,46,99,166,127,53,5,175,80,181,150,213,197,198,139,157,232,100,105,74,54,150,46,164,185,147,101,206,222,209,183,45,171,7,17,114,249,133,246,92,20,68,
+163,91,152,107,54,21,34,35,101,161,51,21,169,72,97,164,145,118,104,134,82,94,161,121,139,197,66,164,34,185,145,142,203,210,148,225,86,82,226,217,232,47,102,29,52,169,91,55,112,6,1,39,135,163,193,123,99,82,238,51,165,71,63,188,98,13,132,190,128,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,32,222,64,147,228,187,19,49,237,237,116,214,222,128,143,222,171,66,79,222,0,141,29,208,72,220,57,126,198,185,135,242,239,106,50,63,118,20,147,254,33,176,224,94,172,141,79,49,254,154,154,246,63,
+121,48,35,62,107,96,1,201,164,255,0,218,13,248,159,216,98,149,127,209,50,189,175,233,226,119,98,192,204,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,82,152,233,140,118,150,94,48,90,237,199,155,245,242,110,141,102,91,147,43,85,51,51,248,109,71,101,78,116,101,
+233,89,164,144,94,149,144,167,90,106,157,55,38,77,8,58,147,81,92,231,158,61,221,252,19,187,246,142,109,156,168,230,235,23,226,29,66,61,155,58,126,33,92,143,60,158,54,151,87,125,245,20,22,188,238,173,36,189,210,164,190,108,67,238,26,181,89,185,54,223,
+22,109,45,42,116,212,87,81,233,188,139,179,95,104,160,80,44,230,125,115,57,72,201,158,80,177,35,52,53,135,16,95,129,150,148,169,212,246,156,81,17,63,60,211,209,67,103,159,106,228,184,202,125,102,51,22,211,242,118,45,251,89,143,173,77,213,187,81,234,32,
+43,117,123,46,85,124,112,207,101,227,155,219,229,14,78,111,15,232,79,45,169,242,83,170,157,173,213,20,182,137,124,93,70,162,96,166,44,251,72,212,147,21,240,122,62,82,225,212,124,222,242,76,126,191,146,181,84,151,206,126,11,249,232,124,111,113,221,5,63,
+60,248,121,105,19,156,169,120,76,211,166,146,236,55,234,51,85,245,146,11,216,35,140,191,244,148,189,131,47,71,253,22,79,233,124,17,233,99,41,150,167,224,22,86,176,218,197,232,248,61,197,176,104,208,56,123,186,24,12,183,167,246,70,28,207,151,12,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,129,187,205,51,252,139,98,14,57,153,31,198,64,162,183,251,213,200,4,0,143,61,208,168,252,57,83,198,9,159,148,196,104,8,215,232,211,148,127,196,54,44,19,212,151,245,208,106,89,139,244,240,234,126,
+242,92,134,120,215,0,3,147,73,47,241,131,71,227,246,24,167,91,244,108,184,180,254,208,142,235,137,36,124,60,92,207,168,134,60,204,26,79,117,186,76,99,155,87,113,49,25,34,212,223,150,162,105,4,95,73,122,23,214,37,218,135,72,91,203,67,138,187,65,178,37,
+129,230,166,241,107,57,56,97,64,117,26,241,69,155,123,194,83,250,151,103,68,219,139,112,207,209,194,41,74,230,132,86,249,21,99,66,180,253,88,190,227,30,113,63,121,3,99,246,25,41,81,145,154,39,238,105,9,45,73,139,66,210,159,51,139,193,199,26,105,191,237,
+138,50,191,160,184,50,226,54,23,82,230,208,177,151,182,247,150,206,250,28,133,198,179,48,67,22,238,13,62,11,202,167,83,160,182,175,223,148,181,23,238,138,50,196,161,204,153,85,97,117,223,22,139,85,123,111,147,216,17,120,139,14,242,13,88,152,95,37,117,
+220,65,101,159,105,51,13,127,104,147,229,78,152,149,86,19,46,121,120,22,194,233,223,30,204,108,222,47,192,156,149,225,245,52,140,185,123,169,113,84,102,40,188,120,13,146,63,96,160,241,42,189,5,85,133,83,231,147,40,10,182,247,158,210,41,79,26,233,56,65,
+131,112,209,175,36,29,187,80,116,203,214,169,194,103,136,215,124,200,143,201,116,58,89,199,99,123,179,105,155,102,93,38,24,96,202,244,62,219,86,121,122,185,79,16,249,70,186,92,16,249,50,223,165,157,140,61,239,189,162,77,233,229,184,27,131,79,119,233,
+69,169,35,236,158,35,242,157,126,132,77,242,93,14,151,224,118,145,119,194,115,202,141,60,183,44,216,70,239,127,3,117,68,127,206,24,124,163,91,161,18,252,151,67,165,157,140,125,241,92,221,160,139,202,242,143,133,174,31,105,162,117,81,63,173,36,189,210,
+164,190,108,67,238,26,181,89,185,54,223,22,109,45,42,116,212,87,81,233,188,139,179,95,104,160,80,44,230,125,115,57,72,201,158,80,177,35,52,53,135,16,95,129,150,148,169,212,246,156,81,17,63,60,211,209,67,103,159,106,228,184,202,125,102,51,22,211,242,118,
+45,251,89,143,173,77,213,187,81,234,32,43,117,123,46,85,124,112,207,101,227,155,219,229,14,78,111,15,232,79,45,169,242,83,170,157,173,213,20,182,137,124,93,70,162,96,166,44,251,72,212,147,21,240,122,62,82,225,212,124,222,242,76,126,191,146,181,84,151,
+206,126,11,249,232,124,111,113,221,5,63,60,248,121,105,19,156,169,120,76,211,166,146,236,55,234,51,85,245,146,11,216,35,140,191,244,148,189,131,47,71,253,22,79,233,124,17,233,99,41,150,167,224,22,86,176,218,197,232,248,61,197,176,104,208,56,123,186,24,
+12,183,167,246,70,28,207,151,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,129,187,205,51,252,139,98,14,57,153,31,198,64,162,183,251,213,200,4,0,143,61,208,168,252,57,83,198,9,159,148,196,104,8,215,232,211,148,127,196,54,44,19,212,
+151,245,208,106,89,139,244,240,234,126,242,92,134,120,215,0,3,147,73,47,241,131,71,227,246,24,167,91,244,108,184,180,254,208,142,235,137,36,124,60,92,207,168,134,60,204,26,79,117,186,76,99,155,87,113,49,25,34,212,223,150,162,105,4,95,73,122,23,214,37,
+218,135,72,91,203,67,138,187,65,178,37,129,230,166,241,107,57,56,97,64,117,26,241,69,155,123,194,83,250,151,103,68,219,139,112,207,209,194,41,74,230,132,86,249,21,99,66,180,253,88,190,227,30,113,63,121,3,99,246,25,41,81,145,154,39,238,105,9,45,73,139,
+66,210,159,51,139,193,199,26,105,191,237,138,50,191,160,184,50,226,54,23,82,230,208,177,151,182,247,150,206,250,28,133,198,179,48,67,22,238,13,62,11,243,6,37,249,74,175,65,15,146,169,126,179,240,59,203,115,124,147,29,35,203,74,174,220,141,217,51,88,215,
+206,110,151,118,79,138,225,248,41,196,188,95,217,19,44,70,167,58,254,187,131,194,161,205,34,255,0,97,62,248,38,77,107,253,12,108,103,203,6,34,218,207,47,66,117,234,36,216,85,118,16,125,167,231,42,51,154,126,201,152,175,28,78,13,239,69,188,240,186,171,
+213,146,102,70,97,110,242,30,199,236,81,144,220,37,102,122,77,177,37,210,228,205,225,104,207,134,148,250,13,214,219,117,162,253,241,94,55,244,90,222,202,18,195,238,163,205,169,147,152,79,157,28,160,99,179,109,47,5,243,81,135,55,65,188,122,54,213,22,244,
+132,243,170,62,238,139,164,39,53,244,112,234,43,198,189,25,240,101,188,168,213,135,173,22,187,12,8,222,189,205,91,216,39,179,250,149,151,106,52,229,49,87,197,235,149,184,239,181,196,105,90,169,16,56,36,200,50,239,74,159,56,104,238,50,226,33,101,136,86,
+78,154,138,124,75,220,54,150,213,103,55,204,85,59,167,153,68,44,4,217,190,246,62,215,233,93,13,115,24,238,55,106,137,113,198,248,92,42,76,51,92,88,105,250,42,112,165,186,93,228,234,76,96,102,245,102,90,171,213,232,74,16,144,166,66,246,248,166,111,206,
+203,192,124,62,201,53,183,84,225,153,123,85,85,114,220,205,54,178,212,169,208,140,218,138,133,151,205,114,82,220,89,122,98,16,189,83,255,0,70,140,122,201,104,211,214,230,83,124,201,23,191,119,123,41,191,224,181,179,42,210,170,86,105,190,79,112,98,83,
+203,187,235,28,104,50,89,53,33,41,68,38,207,94,124,162,161,181,233,216,111,168,109,24,85,15,35,108,155,91,222,243,82,198,110,60,189,244,146,225,29,223,143,137,21,187,210,202,247,95,106,237,50,150,163,226,38,240,222,223,143,195,232,83,178,85,167,246,198,
+27,22,122,221,246,126,38,193,128,45,44,123,95,192,245,101,104,193,77,50,213,166,211,139,145,71,128,195,100,93,220,45,164,190,225,139,51,103,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,143,125,233,57,94,79,177,15,23,208,103,241,178,
+40,8,255,0,214,225,31,220,0,193,109,209,8,250,100,187,20,229,124,252,84,101,31,187,76,103,255,0,112,216,240,69,232,75,172,212,115,23,246,152,117,124,73,101,51,34,235,49,157,53,210,202,230,211,104,150,74,242,63,79,91,249,154,204,45,6,220,157,209,116,140,
+219,201,120,229,213,95,46,206,8,76,18,158,208,254,114,146,148,254,113,11,90,247,150,214,235,210,145,117,111,101,117,116,255,0,55,22,253,188,221,228,99,102,115,123,202,143,69,170,63,71,201,142,86,206,160,219,105,90,35,220,184,141,61,77,36,213,212,74,76,
+24,138,215,135,180,184,223,35,239,73,12,53,206,49,180,182,105,199,191,240,54,27,60,2,80,146,157,89,118,47,199,249,24,169,82,218,195,188,23,180,6,107,177,48,110,243,191,218,166,75,51,79,145,225,61,167,238,100,54,75,184,229,48,217,44,139,179,85,190,126,
+35,82,197,179,118,15,132,45,111,238,225,75,78,105,73,39,221,174,215,114,54,155,28,187,113,121,253,158,132,167,237,209,181,223,192,234,27,216,179,182,103,51,14,149,91,27,234,18,27,113,245,113,41,252,70,196,159,42,116,253,42,66,92,144,189,125,26,106,57,
+237,247,45,25,30,213,181,26,243,171,245,33,39,227,45,148,109,118,185,7,48,84,73,249,37,5,237,107,225,169,114,48,251,117,183,30,106,42,67,152,163,154,75,62,142,92,141,104,160,209,165,212,22,94,130,55,60,157,62,189,70,165,121,203,254,17,13,124,214,202,
+164,254,180,163,15,118,219,51,180,57,50,191,147,74,181,120,174,164,223,191,100,190,54,22,235,222,86,41,15,183,35,18,179,15,126,87,184,52,53,179,76,139,14,156,133,247,234,102,151,213,167,172,140,106,151,188,190,102,10,186,171,107,90,112,250,206,83,126,
+248,163,53,111,201,166,31,25,126,122,180,165,213,162,248,50,241,218,219,190,251,47,173,210,66,234,24,53,91,173,173,31,46,177,121,77,62,47,18,97,109,23,212,53,123,142,89,51,237,127,86,226,48,250,180,227,251,202,76,204,209,200,25,114,147,244,169,185,117,
+202,95,6,139,145,109,236,138,217,163,106,161,41,166,228,202,204,119,135,168,234,81,158,152,126,190,157,213,234,48,117,249,72,207,87,30,182,33,81,117,53,31,186,145,127,12,161,151,105,250,182,241,237,223,239,212,184,86,198,75,242,127,101,54,77,218,89,85,
+195,154,113,39,168,227,89,16,8,253,166,209,152,195,220,102,156,203,116,245,173,123,86,93,117,39,248,153,26,120,38,15,73,105,11,120,46,168,175,192,172,33,97,158,27,83,80,77,211,176,234,223,142,146,234,75,20,56,200,34,253,214,200,99,39,136,95,212,245,170,
+201,245,202,95,137,116,172,108,227,194,11,184,251,123,15,108,9,31,31,97,80,220,215,175,142,141,28,254,212,8,43,219,197,194,172,190,211,252,72,187,27,70,183,193,119,28,71,176,127,8,228,150,146,112,166,215,115,95,202,91,113,21,246,182,42,44,79,18,92,43,
+205,126,220,191,18,87,135,217,63,238,215,113,194,123,47,88,1,36,245,149,129,86,83,159,172,180,96,159,218,200,170,177,172,102,60,46,106,47,219,159,226,73,44,47,15,231,165,30,228,112,223,202,206,88,228,254,51,151,12,63,115,95,159,101,83,207,254,8,168,179,
+6,61,30,23,117,127,238,79,248,138,127,35,225,95,238,33,246,87,224,116,151,38,68,242,79,119,68,84,59,147,40,152,103,45,181,22,154,46,200,130,147,245,41,13,17,151,168,197,229,12,219,154,173,165,181,74,250,178,255,0,169,63,199,66,157,92,7,5,173,29,153,91,
+195,236,175,192,178,152,145,176,123,102,22,35,60,185,104,203,251,214,244,133,151,199,90,215,28,184,164,94,13,173,110,54,95,186,54,139,30,87,115,229,146,217,119,94,81,116,78,17,126,41,39,226,97,110,114,38,93,184,222,169,108,191,99,107,195,93,60,11,19,
+136,219,175,185,90,172,37,215,112,171,48,183,205,188,234,139,86,209,86,141,18,164,210,15,179,224,165,133,233,251,70,54,235,30,95,115,5,45,21,221,173,58,139,232,185,65,251,228,188,12,29,207,38,120,116,223,230,43,74,61,122,63,130,247,152,243,137,251,176,
+57,164,183,163,61,55,9,243,3,100,92,166,223,156,136,245,38,101,82,222,112,189,6,105,117,178,87,138,200,189,35,116,195,249,123,192,43,73,43,187,90,148,245,231,91,51,94,248,191,3,95,185,228,219,20,130,110,141,88,203,78,157,83,126,243,12,174,252,17,205,
+53,223,154,42,30,69,177,30,232,168,213,238,218,117,216,205,165,72,164,191,112,170,167,26,157,46,76,134,218,54,152,81,56,180,37,28,107,73,168,145,161,106,147,215,154,79,78,211,134,98,150,184,206,27,74,250,217,183,78,164,118,163,170,105,232,248,110,123,
+209,207,238,236,234,97,247,51,163,85,37,40,189,30,157,39,178,76,20,194,43,83,47,248,59,106,96,69,137,25,45,81,172,187,118,21,14,148,132,150,132,108,69,97,12,165,94,42,224,53,31,165,70,98,179,222,99,91,213,149,66,27,91,171,75,45,105,196,181,18,83,175,
+121,158,132,4,15,44,217,215,184,234,123,106,247,129,95,195,123,94,160,228,155,102,125,242,197,163,69,144,209,234,81,237,218,97,169,50,100,164,203,177,72,106,92,141,123,221,23,182,212,157,106,177,166,185,200,220,214,86,182,146,168,249,151,143,49,233,22,
+151,75,165,208,233,145,168,148,26,122,34,65,133,29,184,240,98,180,157,18,195,13,164,144,219,100,93,132,148,37,41,47,1,188,198,42,43,68,115,182,220,158,172,243,145,188,161,173,87,108,163,52,243,231,195,107,218,172,145,107,243,155,35,254,33,168,226,191,
+219,25,187,96,43,253,94,186,217,235,29,166,144,219,100,218,58,146,68,69,234,24,243,50,125,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,143,122,210,89,198,216,157,137,109,164,244,233,235,118,235,126,58,213,227,31,220,0,141,29,222,
+124,251,229,79,103,254,204,236,70,196,108,205,226,156,106,50,101,226,227,197,72,161,197,79,148,213,42,203,69,42,22,168,141,21,39,196,189,13,68,70,226,184,91,78,165,196,180,140,238,25,117,70,214,218,82,155,231,248,35,88,198,108,238,47,47,161,26,75,95,
+71,143,50,222,249,203,73,157,173,229,108,235,102,250,225,115,6,50,43,103,84,176,230,139,84,120,226,195,93,21,7,54,232,170,146,181,34,34,121,180,153,70,53,23,200,140,158,50,252,170,133,142,35,142,249,26,50,171,86,106,157,56,173,91,109,36,151,75,111,114,
+47,240,236,187,15,41,24,180,234,77,240,73,115,251,23,57,76,101,123,119,159,53,121,129,168,22,38,103,19,17,23,99,199,168,187,229,50,226,72,95,186,85,249,134,163,212,212,238,171,224,101,74,235,213,213,169,100,125,104,30,123,205,60,188,96,56,108,229,75,
+10,131,185,169,250,205,236,211,79,175,214,151,98,73,243,72,236,24,47,38,216,149,228,84,238,229,228,161,209,198,93,220,23,139,246,18,63,149,253,143,57,0,203,33,199,147,110,96,108,27,150,176,201,17,157,193,124,37,53,73,38,178,47,132,148,56,158,129,163,
+250,13,164,253,35,132,99,60,168,103,76,195,85,170,183,46,157,55,243,41,250,17,237,105,237,62,217,51,165,88,100,188,191,133,83,214,52,182,229,211,47,73,254,11,177,35,42,98,197,141,6,35,84,248,76,33,152,237,32,146,212,118,80,72,109,9,46,196,164,180,34,
+47,65,16,210,101,41,78,78,82,122,183,207,207,222,103,225,8,193,105,21,161,184,68,68,90,17,9,73,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,147,199,108,94,183,114,255,0,130,247,86,56,93,171,34,167,90,84,9,85,89,41,51,211,164,38,91,53,37,178,244,173,100,148,17,
+118,154,200,100,176,140,54,190,51,138,81,177,163,235,85,148,98,189,154,190,61,156,123,11,10,182,247,158,210,41,79,26,233,56,65,131,112,209,175,36,29,187,80,116,203,214,169,194,103,136,215,124,200,143,201,116,58,89,199,99,123,179,105,155,102,93,38,24,
+96,202,244,62,219,86,121,122,185,79,16,249,70,186,92,16,249,50,223,165,157,140,61,239,189,162,77,233,229,184,27,131,79,119,233,69,169,35,236,158,35,242,157,126,132,77,242,93,14,151,224,118,145,119,194,115,202,141,60,183,44,216,70,239,127,3,117,68,127,
+206,24,124,163,91,161,18,252,151,67,165,157,140,125,241,92,221,160,139,202,242,143,133,174,31,105,162,117,81,63,243,6,37,249,74,175,65,15,146,169,126,179,240,59,203,115,124,147,29,35,203,74,174,220,141,217,51,88,215,206,110,151,118,79,138,225,248,41,
+196,188,95,217,19,44,70,167,58,254,187,131,194,161,205,34,255,0,97,62,248,38,77,107,253,12,108,103,203,6,34,218,207,47,66,117,234,36,216,85,118,16,125,167,231,42,51,154,126,201,152,175,28,78,13,239,69,188,240,186,171,213,146,102,70,97,110,242,30,199,
+236,81,144,220,37,102,122,77,177,37,210,228,205,225,104,207,134,148,250,13,214,219,117,162,253,241,94,55,244,90,222,202,18,195,238,163,205,169,147,152,79,157,28,160,99,179,109,47,5,243,81,135,55,65,188,122,54,213,22,244,132,243,170,62,238,139,164,39,
+53,244,112,234,43,198,189,25,240,101,188,168,213,135,173,22,187,12,8,222,189,205,91,216,39,179,250,149,151,106,52,229,49,87,197,235,149,184,239,181,196,105,90,169,16,56,36,200,50,239,74,159,56,104,238,50,226,33,101,136,86,78,154,138,124,75,220,54,150,
+213,103,55,204,85,59,167,153,68,44,4,217,190,246,62,215,233,93,13,115,24,238,55,106,137,113,198,248,92,42,76,51,92,88,105,250,42,112,165,186,93,228,234,76,96,102,245,102,90,171,213,232,74,16,144,166,66,246,248,166,111,206,203,192,124,62,201,53,183,84,
+225,153,123,85,85,114,220,205,54,178,212,169,208,140,218,138,133,151,205,114,82,220,89,122,98,16,189,83,255,0,70,140,122,201,104,211,214,230,83,124,201,23,191,119,123,41,191,224,181,179,42,210,170,86,105,190,79,112,98,83,203,187,235,28,104,50,89,53,33,
+41,68,38,207,94,124,162,161,181,233,216,111,168,109,24,85,15,35,108,155,91,222,243,82,198,110,60,189,12,74,238,158,31,99,82,226,124,34,155,238,68,66,238,194,96,21,197,156,141,173,181,60,216,98,20,117,77,143,135,145,103,221,245,89,78,22,169,93,106,107,
+139,102,34,79,95,149,210,60,243,197,253,91,94,193,244,34,214,218,141,133,149,59,106,43,72,194,42,43,169,45,23,129,229,203,186,243,175,86,85,102,253,41,54,223,91,222,207,76,196,68,146,36,151,81,9,139,19,31,246,168,102,157,188,150,236,243,197,172,197,181,
+57,49,234,52,91,62,68,107,121,106,86,159,227,73,122,68,134,69,233,39,159,66,252,27,49,52,86,172,154,11,89,30,83,54,107,103,230,241,217,187,154,40,121,158,182,48,218,143,118,184,154,108,170,108,218,117,105,110,183,210,71,124,145,211,41,135,144,122,178,
+255,0,10,116,39,13,43,34,37,168,141,38,74,23,214,215,46,214,178,154,222,47,108,213,237,187,166,219,94,211,210,150,206,189,171,25,79,218,89,101,185,87,193,27,157,218,117,205,78,142,78,220,22,29,117,72,110,167,78,46,68,110,164,146,124,50,88,212,244,39,
+218,212,139,82,37,147,106,62,17,182,90,222,209,186,91,184,244,26,61,238,31,113,99,45,38,183,115,62,111,228,66,190,240,75,158,235,109,210,69,63,93,120,24,179,152,50,238,214,60,99,211,251,67,91,197,127,182,51,107,192,191,217,209,235,126,243,214,58,62,243,
+251,70,60,203,159,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,212,222,205,123,163,216,191,123,52,71,167,75,117,219,168,255,0,212,91,63,184,1,230,19,39,120,59,132,216,249,143,212,44,46,198,204,118,133,135,116,10,147,198,153,87,37,
+66,42,156,66,85,203,133,146,62,72,109,78,124,18,113,213,37,180,159,53,31,81,30,7,52,98,152,150,11,130,85,187,176,181,119,21,35,194,9,232,253,175,165,165,209,20,228,249,140,158,17,103,105,127,136,66,133,205,101,74,15,231,63,119,66,235,123,151,129,232,
+163,39,249,10,202,166,74,237,102,160,101,251,14,162,71,153,34,50,74,93,215,45,73,149,83,168,164,203,94,37,202,50,215,128,250,201,13,112,183,220,158,209,225,124,209,156,243,38,108,184,115,196,171,55,20,247,65,122,48,143,84,122,125,178,214,94,211,209,216,
+46,94,194,48,106,41,90,65,106,254,115,223,39,214,254,11,119,176,189,90,104,92,189,67,81,54,51,126,159,248,199,236,152,171,75,214,41,86,245,14,104,187,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,141,221,229,76,206,150,26,229,70,135,150,234,21,67,130,167,136,
+181,162,118,162,218,22,100,162,165,194,82,92,86,186,118,46,66,152,46,124,140,155,89,14,229,200,94,0,239,179,13,76,74,162,244,104,71,69,245,231,170,93,209,218,239,71,54,229,27,19,242,24,108,44,226,247,212,123,254,170,223,239,211,196,203,77,213,156,158,
+43,45,219,51,226,227,37,197,75,54,110,12,99,173,46,224,117,78,32,137,196,210,153,226,141,79,71,209,81,38,67,229,232,144,70,61,91,55,188,225,181,94,178,36,184,72,82,33,31,124,139,56,105,161,97,158,25,228,90,217,170,240,202,175,207,114,240,186,218,105,
+206,105,137,31,164,141,5,181,151,114,221,84,167,52,253,2,12,84,130,231,43,82,92,231,198,205,173,155,152,35,81,217,117,106,97,14,99,240,162,155,91,85,230,219,151,69,85,153,241,184,36,69,122,98,83,208,41,167,75,71,35,186,136,169,96,184,144,162,50,51,50,
+61,72,204,143,198,89,255,0,62,99,20,121,69,175,121,133,215,148,60,142,148,163,163,220,212,61,100,215,171,36,230,229,185,167,204,122,19,43,229,155,42,217,90,157,11,202,106,94,83,89,61,120,173,120,104,248,167,166,156,8,234,218,21,145,124,83,216,239,152,
+59,107,28,114,219,143,15,70,131,34,164,169,22,109,73,138,187,113,235,212,167,146,70,102,219,204,145,145,188,215,14,169,233,146,131,105,194,51,67,137,73,159,10,189,9,201,143,40,239,58,218,74,53,41,58,119,20,151,164,210,126,78,94,216,203,130,125,48,111,
+94,117,170,225,203,115,142,83,134,7,91,101,73,78,148,248,38,214,210,246,53,207,214,187,116,221,173,11,7,51,152,149,180,159,106,158,24,98,246,48,210,233,173,92,55,101,247,103,210,42,141,210,99,155,81,222,83,47,67,136,110,165,179,51,232,248,210,223,26,
+146,94,105,26,140,146,68,90,17,117,58,245,167,113,83,110,92,77,50,218,222,157,173,21,78,28,22,190,39,180,150,254,15,237,31,218,40,149,205,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,137,189,203,43,201,246,58,87,152,252,189,249,111,
+183,255,0,152,90,191,132,1,4,185,48,217,13,47,61,121,37,153,141,184,87,127,183,73,190,41,183,132,218,122,41,213,147,63,115,234,81,155,98,58,208,142,52,36,213,29,210,83,139,243,204,148,133,17,145,25,39,78,33,200,179,95,41,235,39,102,232,225,247,148,182,
+237,229,78,50,214,62,188,91,148,147,122,61,210,91,150,237,205,116,190,7,67,192,50,60,179,38,95,149,221,180,246,106,198,109,104,253,89,36,147,94,212,247,241,223,213,206,113,108,60,213,109,91,217,3,95,99,15,46,248,21,136,86,235,79,240,199,182,175,24,135,
+62,137,40,139,175,201,31,74,140,144,70,68,103,252,221,212,245,234,100,42,94,229,206,77,249,81,160,238,168,74,50,170,214,249,211,123,53,87,215,142,155,255,0,110,47,216,203,74,88,142,110,201,149,149,42,177,148,98,190,108,183,193,253,87,252,47,172,205,92,
+8,222,103,203,205,208,81,169,153,133,192,235,142,210,146,178,36,189,82,160,72,110,169,13,39,243,141,10,232,158,74,125,4,78,25,122,71,40,198,127,39,236,110,223,106,120,109,204,42,174,137,167,9,117,106,182,163,175,113,187,97,252,168,88,212,74,55,148,92,
+31,74,244,151,193,248,51,51,240,3,104,246,70,51,21,45,152,152,77,153,187,86,108,215,209,171,84,185,213,15,32,152,163,62,194,98,89,54,181,31,209,35,28,191,17,200,121,191,1,147,149,237,148,227,21,243,146,218,143,218,142,171,188,220,45,179,70,5,136,199,
+74,21,226,223,67,122,62,231,163,47,209,159,189,147,250,31,2,139,84,175,228,153,122,15,168,198,186,227,163,208,202,41,70,92,25,167,74,147,45,72,54,72,234,141,58,100,151,89,151,180,54,70,168,116,164,125,90,123,67,100,106,143,162,90,76,67,70,68,212,64,0,
+0,0,0,0,0,0,0,0,0,3,35,51,225,73,106,103,200,139,188,8,55,162,212,128,221,160,147,174,205,170,123,106,96,101,163,13,42,11,122,34,174,168,86,13,190,251,39,198,134,25,105,227,76,217,90,117,112,147,170,150,233,159,205,108,187,135,183,121,42,192,126,65,201,
+148,54,214,149,43,126,118,95,181,166,202,236,130,143,137,231,92,231,137,188,71,28,169,36,253,24,122,43,179,143,142,167,169,204,61,176,237,92,51,177,232,152,93,135,180,180,197,162,219,148,136,212,170,44,38,81,241,81,35,180,150,89,73,17,119,33,9,245,234,
+55,253,117,102,150,247,179,164,197,236,195,96,38,95,104,206,215,241,227,28,109,27,42,19,41,213,217,55,85,201,22,9,36,190,139,203,74,149,224,68,102,35,163,97,38,207,37,251,80,243,185,101,231,147,106,133,225,153,107,181,83,171,24,124,87,115,16,41,16,160,
+184,73,117,235,114,10,210,195,72,100,215,161,32,222,105,181,57,169,245,42,66,140,203,176,75,119,78,234,118,85,33,109,36,170,56,181,22,248,41,105,185,189,57,147,50,22,206,140,43,65,213,90,197,53,170,92,90,231,69,220,199,93,190,25,236,204,165,111,249,50,
+202,109,130,197,131,10,86,145,233,116,187,70,158,186,157,101,77,17,112,165,180,188,164,31,14,137,36,145,116,45,32,203,176,251,71,27,194,249,26,201,184,20,29,238,51,87,203,201,111,147,168,212,41,167,211,179,174,253,255,0,173,38,159,65,190,93,103,188,193,
+137,105,109,97,13,133,193,40,173,169,63,15,114,70,198,0,236,55,207,62,106,174,162,196,252,220,93,210,237,8,147,214,79,84,39,93,19,87,80,175,76,79,95,38,77,102,104,81,150,165,171,235,73,167,230,159,80,134,53,203,6,79,203,118,222,103,130,211,85,165,29,
+201,65,40,82,143,237,105,189,125,84,245,233,69,246,21,201,222,98,198,171,121,198,33,39,77,62,46,79,106,111,179,241,123,186,14,139,46,24,21,97,96,230,240,142,25,96,22,28,199,148,84,27,111,48,86,252,8,94,95,35,166,121,104,102,100,99,82,214,173,11,85,41,
+68,165,30,132,69,169,242,34,45,8,116,140,155,138,222,99,89,94,214,254,235,79,41,86,59,79,69,162,222,222,228,186,18,220,185,250,89,165,102,43,43,124,55,26,175,107,67,212,132,180,90,239,123,146,226,207,97,5,166,154,144,217,140,41,168,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,41,247,196,43,173,210,54,72,199,128,225,150,181,60,87,162,70,65,107,214,105,102,107,223,99,64,12,53,221,232,183,235,69,179,227,202,41,180,137,50,138,85,245,84,120,206,51,10,94,133,195,29,178,215,132,185,115,
+108,253,131,200,156,180,81,175,119,158,26,167,7,45,138,80,91,147,124,242,124,221,103,162,57,49,171,78,219,45,122,114,75,106,114,123,222,157,11,224,102,117,219,134,146,239,154,12,139,82,243,194,183,107,20,201,105,225,149,77,170,208,206,68,119,139,185,
+77,184,131,74,189,100,57,149,181,174,45,103,89,86,161,25,194,107,132,162,164,154,234,105,106,111,53,235,97,215,116,221,58,206,50,139,226,158,141,119,51,21,241,167,96,246,74,241,149,14,201,166,96,37,126,201,158,233,114,155,102,169,232,232,35,254,174,234,
+92,103,79,66,80,145,209,240,158,83,57,69,194,154,83,110,188,87,53,74,109,255,0,137,40,203,189,179,74,191,200,249,62,249,55,29,41,203,166,18,75,193,235,31,3,18,241,163,118,99,21,233,207,188,188,8,199,234,100,245,33,28,104,164,94,180,167,105,207,18,123,
+137,230,73,212,168,252,82,130,29,2,195,151,139,74,83,84,241,123,41,211,125,48,209,175,179,45,151,226,205,47,16,228,186,188,97,183,97,112,166,186,26,209,247,173,117,238,69,171,255,0,1,109,186,153,55,89,201,194,246,49,21,154,124,68,234,209,225,253,230,
+115,163,168,139,254,238,203,198,102,94,131,107,212,54,5,157,57,33,204,235,75,169,82,218,127,239,105,236,191,181,40,233,221,35,3,44,191,157,240,127,209,109,233,244,37,170,238,215,95,2,160,178,118,181,237,194,194,134,188,150,240,178,43,183,19,81,94,232,
+156,69,225,133,110,113,165,68,68,124,11,117,150,89,115,139,67,46,181,107,204,79,46,75,57,53,199,35,229,44,146,73,243,210,171,170,238,214,107,192,130,205,249,175,14,106,21,245,221,250,240,211,221,178,95,236,42,222,11,204,227,70,136,248,223,179,178,189,
+40,248,75,142,117,166,153,177,249,254,166,67,46,23,250,194,26,174,33,200,37,6,181,177,189,107,217,82,9,248,197,175,186,102,45,57,74,184,75,75,138,41,251,98,244,240,127,137,122,173,13,188,152,49,88,52,183,117,101,63,28,232,171,62,75,87,224,74,100,182,
+159,91,110,145,159,238,141,94,231,144,172,213,79,244,85,104,207,246,165,23,227,29,60,76,213,46,81,240,137,47,206,83,154,125,73,175,188,84,45,109,250,217,189,78,158,229,30,238,196,11,178,135,53,133,112,200,135,88,177,102,182,235,42,238,90,80,74,208,249,
+246,140,37,94,70,179,220,61,90,48,151,85,72,252,116,47,225,202,6,95,124,102,215,236,191,192,171,104,91,110,246,92,215,88,75,172,102,202,153,31,139,169,19,232,53,38,20,94,60,81,134,42,191,37,89,250,139,223,100,223,84,160,253,210,50,16,206,185,106,107,
+251,66,238,146,247,163,187,143,182,15,102,92,173,58,44,230,90,5,175,229,60,169,31,237,48,66,211,252,218,231,200,241,176,159,248,127,136,168,179,142,93,127,251,132,84,52,125,166,155,60,235,169,37,83,179,175,134,124,250,138,69,216,195,7,236,116,210,98,
+202,174,67,206,116,125,108,62,183,100,27,247,106,92,67,51,224,21,56,92,195,182,73,124,78,254,38,121,114,85,56,137,80,243,125,134,14,145,245,112,223,180,255,0,255,0,120,90,75,41,102,152,122,214,53,191,237,79,240,46,150,57,130,191,253,205,63,183,31,196,
+231,199,205,246,83,37,233,228,185,163,195,135,53,234,224,190,105,231,255,0,24,81,121,107,49,71,141,157,95,251,115,254,18,63,44,225,15,133,196,62,210,252,78,91,89,156,203,92,131,214,54,98,44,39,62,133,233,0,255,0,227,10,79,0,199,99,198,214,175,253,185,
+255,0,9,21,139,97,111,251,232,253,164,117,151,102,116,50,129,98,68,242,235,203,53,56,115,77,107,78,74,147,123,65,35,63,2,39,76,207,212,66,189,182,87,204,183,114,217,163,101,86,79,217,78,127,129,78,166,57,131,209,142,179,175,5,251,75,241,45,165,127,108,
+94,204,139,113,75,68,252,227,218,174,154,58,202,158,220,185,90,248,27,44,40,143,212,99,59,71,147,60,247,95,213,176,154,235,217,143,190,72,198,207,56,229,200,61,247,11,179,87,238,45,70,35,111,22,236,217,178,144,226,109,155,146,240,187,92,65,153,37,52,
+27,85,109,37,71,244,230,45,159,176,108,118,92,138,103,139,166,188,172,41,210,250,211,79,194,10,70,50,191,40,89,126,139,106,14,83,234,139,253,237,11,25,139,91,209,88,104,187,98,161,11,4,242,195,114,170,170,244,55,91,167,79,184,107,209,152,110,51,202,65,
+146,30,54,217,67,134,190,21,25,43,135,136,181,225,211,82,235,27,102,27,200,13,247,156,66,87,215,144,216,77,106,163,25,61,86,187,214,173,199,77,120,107,163,234,48,87,124,165,81,149,41,70,133,7,171,79,70,218,90,123,245,234,35,51,38,89,205,199,156,154,102,
+50,54,101,48,33,186,100,171,233,168,211,35,211,39,214,168,233,169,41,135,165,182,166,221,125,182,150,122,41,227,74,214,68,165,18,136,186,69,114,61,71,166,84,105,194,154,143,4,187,146,57,36,156,170,55,174,246,204,199,123,19,183,159,115,251,79,91,240,171,
+153,128,155,73,168,43,151,185,200,93,181,77,113,39,216,147,65,69,107,131,79,78,157,227,21,113,141,224,246,175,74,149,162,159,70,186,190,229,169,119,75,12,188,168,150,205,55,238,247,150,167,56,123,21,115,197,148,140,185,212,179,123,156,43,182,212,163,
+161,202,156,72,76,209,228,221,74,169,86,42,51,36,44,244,108,141,164,173,173,82,132,184,226,141,79,114,75,103,214,122,11,123,44,203,135,226,55,170,218,217,74,79,123,215,77,18,75,175,127,179,129,94,227,9,186,180,161,229,43,104,185,180,231,252,60,75,137,
+177,31,101,22,15,231,114,217,186,113,183,50,48,235,50,109,202,53,89,138,93,10,159,77,168,170,34,39,201,36,116,178,77,213,165,60,102,132,37,108,36,137,10,73,234,225,243,228,57,103,43,156,165,98,121,66,226,133,134,22,226,170,206,46,114,114,91,78,43,93,
+35,162,215,77,91,82,123,211,220,184,27,158,71,202,118,152,236,42,92,93,235,177,22,146,73,233,171,226,245,231,231,92,25,46,216,59,150,76,191,229,150,154,229,177,128,152,67,66,181,98,25,18,93,85,38,9,37,231,180,34,230,235,202,213,215,79,210,181,24,243,
+14,43,152,113,188,193,81,85,196,110,37,85,253,39,185,117,71,213,93,137,29,239,8,193,240,188,46,217,70,214,148,97,212,183,190,183,197,246,149,162,146,92,6,146,46,193,136,92,76,211,224,66,246,93,209,238,182,244,29,178,102,90,240,230,85,7,254,142,73,159,
+240,143,122,242,123,29,50,70,30,191,225,67,220,121,31,55,61,115,53,223,215,145,235,81,28,208,147,244,16,220,141,112,250,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,102,250,165,105,113,118,119,97,197,9,43,208,166,99,44,101,153,107,
+215,209,210,234,31,251,192,20,38,237,108,110,131,102,253,33,207,203,213,170,14,159,167,249,244,148,127,0,243,22,121,123,89,242,245,116,70,146,255,0,6,191,19,184,229,72,168,229,107,103,210,231,247,180,36,24,107,134,124,248,125,246,98,176,185,50,28,36,
+54,218,13,75,81,245,17,17,106,102,33,41,40,197,183,193,17,73,201,232,139,55,26,184,245,207,114,77,174,185,169,19,206,17,182,147,249,40,35,209,37,234,34,33,201,241,107,135,117,114,234,190,127,119,55,129,183,170,42,222,218,20,215,49,218,60,159,123,212,
+203,153,117,24,196,3,183,194,218,211,10,173,63,106,214,27,75,209,231,181,230,51,37,36,226,13,105,231,166,138,212,180,50,215,179,176,134,225,149,175,37,111,112,233,39,166,215,58,220,245,94,213,236,248,26,254,53,105,10,180,124,166,137,233,238,55,111,60,
+155,229,107,16,29,92,171,163,2,109,215,30,115,227,36,68,131,228,174,40,251,205,76,26,12,207,210,99,172,90,230,172,197,100,146,163,117,52,151,4,222,210,238,150,166,143,91,4,194,174,30,179,162,187,22,158,237,25,111,107,59,42,242,113,84,53,28,43,66,177,
+77,53,30,191,204,110,7,140,139,192,157,227,25,186,92,163,230,152,122,213,35,46,184,47,134,134,58,166,82,194,36,253,24,181,212,223,197,179,10,113,231,119,103,38,88,135,139,181,235,145,88,165,136,212,233,18,230,241,56,219,21,24,46,32,143,132,139,145,46,
+46,189,157,227,5,121,203,150,105,177,186,157,47,33,74,73,62,120,205,126,249,147,161,201,190,15,115,66,51,85,42,38,253,177,254,18,223,84,55,96,112,14,74,184,168,57,168,188,163,35,177,50,168,48,222,50,245,165,104,251,4,180,255,0,40,76,102,43,243,150,52,
+223,84,164,189,233,135,201,101,171,126,141,196,151,90,79,240,58,185,91,174,86,10,191,17,206,93,109,29,221,45,150,202,190,201,68,46,99,249,68,94,47,91,14,143,253,199,252,4,143,146,170,75,133,211,251,63,204,165,171,91,173,247,26,31,82,237,252,232,211,221,
+70,190,105,78,177,157,65,233,233,52,74,80,200,210,252,162,40,105,249,204,57,174,170,169,251,224,139,58,188,149,215,79,208,186,79,174,63,254,199,74,246,235,206,50,151,226,217,177,180,148,95,164,183,102,39,236,51,23,75,242,134,194,159,27,26,159,110,63,
+129,65,242,93,127,205,94,63,101,254,39,25,253,215,220,194,37,63,205,243,61,98,47,187,164,165,207,79,240,24,169,31,202,19,3,124,108,170,253,168,126,37,63,243,93,138,115,86,143,115,56,146,119,97,115,70,142,113,243,23,135,107,238,227,98,122,127,224,24,168,
+191,40,60,186,248,218,86,239,135,241,7,201,118,47,254,250,30,63,129,205,182,55,95,241,230,99,188,55,158,104,172,184,13,235,240,169,148,121,146,215,167,130,201,146,250,197,43,143,202,19,6,135,232,44,170,73,253,41,70,62,237,162,106,124,150,226,58,233,82,
+188,87,82,111,223,161,115,109,237,215,156,54,101,148,21,215,156,10,244,149,153,123,231,185,214,123,12,164,252,58,73,11,208,96,43,126,80,215,237,191,37,135,197,117,212,111,221,20,101,41,242,87,65,47,74,229,190,168,165,241,101,204,195,173,219,44,135,218,
+174,166,77,237,120,98,5,210,191,148,204,154,187,16,153,63,217,142,201,47,251,99,94,190,229,239,56,220,45,45,233,210,165,213,23,39,254,41,105,224,101,45,185,49,193,41,45,106,206,114,125,105,47,4,159,137,136,27,118,114,193,146,76,150,210,172,28,21,203,
+102,14,70,162,220,149,149,154,12,139,82,243,194,183,107,20,201,105,225,149,77,170,208,206,68,119,139,185,77,184,131,74,189,100,57,149,181,174,45,103,89,86,161,25,194,107,132,162,164,154,234,105,106,111,53,235,97,215,116,221,58,206,50,139,226,158,141,
+119,51,21,241,167,96,246,74,241,149,14,201,166,96,37,126,201,158,233,114,155,102,169,232,232,35,254,174,234,92,103,79,66,80,145,209,240,158,83,57,69,194,154,83,110,188,87,53,74,109,255,0,137,40,203,189,179,74,191,200,249,62,249,55,29,41,203,166,18,75,
+193,235,31,3,18,241,163,118,99,21,233,207,188,188,8,199,234,100,245,33,28,104,164,94,180,167,105,207,18,123,137,230,73,212,168,252,82,130,29,2,195,151,139,74,83,84,241,123,41,211,125,48,209,175,179,45,151,226,205,47,16,228,186,188,97,183,97,112,166,186,
+26,209,247,173,117,238,69,171,255,0,1,109,186,153,55,89,201,194,246,49,21,154,124,68,234,209,225,253,230,115,163,168,139,254,238,203,198,102,94,131,107,212,54,5,157,57,33,204,235,75,169,82,218,127,239,105,236,191,181,40,233,221,35,3,44,191,157,240,127,
+209,109,233,244,37,170,238,215,95,2,160,178,118,181,237,194,194,134,188,150,240,178,43,183,19,81,94,232,156,69,225,133,110,113,165,68,68,124,11,117,150,89,115,139,67,46,181,107,204,79,46,75,57,53,199,35,229,44,146,73,243,210,171,170,238,214,107,192,130,
+205,249,175,14,106,21,245,221,250,240,211,221,178,95,236,42,222,11,204,227,70,136,248,223,179,178,189,40,248,75,142,117,166,153,177,249,254,166,67,46,23,250,194,26,174,33,200,37,6,181,177,189,107,217,82,9,248,197,175,186,102,45,57,74,184,75,75,138,41,
+251,98,244,240,127,137,122,173,13,188,152,49,88,52,183,117,101,63,28,232,171,62,75,87,224,74,100,182,159,91,110,145,159,238,141,94,231,144,172,213,79,244,85,104,207,246,165,23,227,29,60,76,213,46,81,240,137,47,206,83,154,125,73,175,188,84,45,109,250,
+217,189,78,158,229,30,238,196,11,178,135,53,133,112,200,135,88,177,102,182,235,42,238,90,80,74,208,249,246,140,37,94,70,179,220,61,90,48,151,85,72,252,116,47,225,202,6,95,124,102,215,236,191,192,171,104,91,110,246,92,215,88,75,172,102,202,153,31,139,
+169,19,232,53,38,20,94,60,81,134,42,191,37,89,250,139,223,100,223,84,160,253,210,50,16,206,185,106,107,251,66,238,146,247,163,187,143,182,15,102,92,173,58,44,230,90,5,175,229,60,169,31,237,48,66,211,252,218,231,200,241,176,159,248,127,136,168,179,142,
+93,127,251,132,84,52,125,166,155,60,235,169,37,83,179,175,134,124,250,138,69,216,195,7,236,116,210,98,202,174,67,206,116,125,108,62,183,100,27,247,106,92,67,51,224,21,56,92,195,182,73,124,78,254,38,121,114,85,56,137,80,243,125,134,14,145,245,112,223,
+180,255,0,255,0,120,90,75,41,102,152,122,214,53,191,237,79,240,46,150,57,130,191,253,205,63,183,31,196,231,199,205,246,83,37,233,228,185,163,195,135,53,234,224,190,105,231,255,0,24,81,121,107,49,71,141,157,95,251,115,254,18,63,44,225,15,133,196,62,210,
+252,78,91,89,156,203,92,131,214,54,98,44,39,62,133,233,0,255,0,227,10,79,0,199,99,198,214,175,253,185,255,0,9,21,139,97,111,251,232,253,164,117,151,102,116,50,129,98,68,242,235,203,53,56,115,77,107,78,74,147,123,65,35,63,2,39,76,207,212,66,189,182,87,
+204,183,114,217,163,101,86,79,217,78,127,129,78,166,57,131,209,142,179,175,5,251,75,241,45,165,127,108,94,204,139,113,75,68,252,227,218,174,154,58,202,158,220,185,90,248,27,44,40,143,212,99,59,71,147,60,247,95,213,176,154,235,217,143,190,72,198,207,56,
+229,200,61,247,11,179,87,238,45,70,35,111,22,236,217,178,144,226,109,155,146,240,187,92,65,153,37,52,27,85,109,37,71,244,230,45,159,176,108,118,92,138,103,139,166,188,172,41,210,250,211,79,194,10,70,50,191,40,89,126,139,106,14,83,234,139,253,237,11,25,
+139,91,209,88,104,187,98,161,11,4,242,195,114,170,170,244,55,91,167,79,184,107,209,152,110,51,202,65,146,30,54,217,67,134,190,21,25,43,135,136,181,225,211,82,235,27,102,27,200,13,247,156,66,87,215,144,216,77,106,163,25,61,86,187,214,173,199,77,120,107,
+163,234,48,87,124,165,81,149,41,70,133,7,171,79,70,218,90,123,245,234,35,51,38,89,73,172,87,42,142,86,37,203,146,152,45,251,195,45,25,190,234,200,146,227,166,242,143,66,35,247,130,231,167,33,212,185,28,204,57,187,53,213,186,191,197,110,28,233,67,72,70,
+59,49,138,218,126,148,159,163,21,193,104,184,252,227,75,207,152,94,9,130,249,27,91,58,91,51,122,202,79,86,222,156,23,22,248,189,123,137,110,216,17,147,139,127,43,123,56,44,42,197,102,210,130,213,219,123,176,187,170,181,80,118,156,130,148,130,153,162,
+162,179,210,41,60,105,36,69,75,30,110,164,68,165,172,244,230,98,235,53,98,51,190,197,234,70,47,209,135,162,183,238,221,199,199,82,92,10,202,20,44,163,57,47,73,239,239,254,70,111,155,166,233,234,226,141,103,222,179,212,254,177,172,25,229,21,24,232,136,
+30,222,211,205,83,151,126,55,225,238,76,237,185,198,228,107,78,150,171,134,224,142,209,234,74,168,77,46,142,51,102,69,242,145,25,6,162,254,181,233,29,71,33,217,42,86,181,47,37,243,158,139,169,113,125,254,227,69,204,215,46,173,204,104,174,111,127,245,
+239,51,187,103,62,91,91,202,110,75,236,28,21,126,34,90,169,66,162,34,101,193,161,115,58,140,175,127,145,169,246,240,173,125,31,131,100,60,113,158,241,231,153,115,93,213,250,122,193,201,168,125,72,250,49,239,75,94,211,188,229,124,45,97,24,45,27,118,180,
+150,154,203,173,239,126,59,139,169,81,61,106,14,167,243,134,183,15,81,27,173,191,232,81,179,166,188,132,197,98,24,242,72,148,220,91,208,22,250,227,23,25,127,132,77,65,222,93,205,57,37,71,236,224,63,96,247,238,68,131,134,76,195,211,255,0,115,79,238,163,
+200,89,162,74,89,142,237,175,247,147,247,179,214,91,110,17,54,159,162,67,107,48,6,189,57,107,160,3,82,116,140,1,244,74,35,0,106,0,0,0,0,0,103,161,106,0,248,83,154,122,0,4,187,175,104,3,236,140,140,181,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,134,251,
+28,158,12,153,97,20,45,126,30,41,60,189,59,248,105,143,151,241,0,56,27,185,145,74,46,205,219,88,180,248,195,152,225,250,234,115,199,151,51,147,114,207,184,135,253,47,252,104,239,57,101,37,149,45,63,111,239,179,61,134,8,203,148,102,55,220,135,71,180,253,
+200,142,230,143,212,151,209,22,135,204,155,46,107,63,177,63,180,48,152,237,215,155,217,236,46,50,221,217,207,248,118,153,60,42,135,149,185,218,124,35,191,183,152,160,108,216,196,147,113,71,216,146,251,71,53,185,122,164,108,215,62,170,69,66,230,138,111,
+77,69,161,110,218,208,234,100,191,42,153,57,170,164,37,112,187,29,212,184,217,250,72,245,33,123,105,90,84,106,198,113,226,158,165,189,122,113,169,7,23,193,151,198,141,84,141,91,165,71,171,196,63,123,144,202,86,146,215,171,82,234,63,73,117,122,135,86,
+161,90,53,232,198,164,120,53,169,164,212,131,165,81,193,243,28,145,84,144,178,151,145,159,225,245,83,159,249,81,253,132,57,174,54,191,214,21,58,205,187,13,254,203,3,144,199,197,144,192,75,129,149,143,3,233,74,225,45,68,34,131,122,26,210,224,202,173,212,
+81,77,136,180,37,107,35,62,55,15,68,164,136,140,204,204,251,11,66,23,150,150,149,111,107,170,80,209,55,174,247,193,104,181,222,91,215,175,27,122,110,114,21,56,82,232,149,55,105,83,77,61,35,70,90,154,79,82,61,75,82,50,244,104,98,23,118,181,108,174,37,
+70,167,21,209,192,80,173,10,244,149,72,112,102,137,81,40,133,171,90,151,9,234,124,186,233,32,189,32,150,132,27,57,150,108,88,117,139,162,45,54,160,215,72,211,156,124,104,226,50,215,68,40,203,153,115,235,33,149,193,173,168,221,226,48,165,85,107,23,174,
+171,122,230,111,152,177,191,171,82,141,164,167,7,163,90,123,209,215,173,210,67,235,66,122,146,179,34,244,115,24,234,145,217,168,210,233,46,224,219,138,102,226,93,37,232,72,50,226,51,208,181,20,218,212,153,205,37,169,1,184,219,229,219,92,118,218,196,195,
+91,86,99,146,237,234,205,233,26,221,167,190,214,166,77,80,224,153,148,153,9,50,234,73,182,220,167,245,253,39,164,123,159,36,225,127,228,95,39,180,163,53,165,77,151,82,95,94,123,210,126,213,172,99,216,121,171,48,94,203,31,204,243,148,119,199,93,149,245,
+99,199,191,123,237,61,58,217,212,138,52,103,162,91,208,41,232,102,4,104,196,204,72,141,145,165,44,180,132,112,161,4,69,212,73,73,17,122,134,145,107,8,87,186,74,126,211,107,170,221,11,125,34,247,156,101,212,34,197,101,82,167,73,75,44,52,131,91,207,44,
+244,38,219,34,213,74,51,236,34,34,51,245,11,53,23,39,178,138,243,158,196,27,60,204,96,164,169,91,85,118,230,200,197,58,235,103,46,135,85,196,9,87,36,164,47,154,81,69,167,31,20,86,85,249,166,211,49,153,253,177,208,179,182,35,254,72,242,119,91,97,233,61,
+133,78,63,94,166,230,215,86,178,151,97,167,101,251,87,142,102,138,105,239,142,214,211,234,142,244,187,119,46,210,124,22,225,168,205,107,62,106,61,79,196,120,99,100,244,170,217,75,68,116,83,220,51,154,239,87,195,49,117,5,164,81,147,160,244,164,143,134,
+86,70,251,124,69,200,220,73,125,100,34,214,226,121,189,41,178,27,182,21,211,255,0,148,221,228,123,118,224,127,87,9,55,221,227,87,82,143,189,48,234,75,35,246,168,135,208,252,189,73,80,192,45,41,47,155,74,154,238,130,71,142,113,138,158,91,22,184,169,211,
+57,190,249,51,213,185,184,181,25,52,210,76,207,65,152,49,160,146,230,186,27,237,17,247,113,243,0,104,183,150,194,184,28,45,57,0,62,211,36,211,167,25,25,17,150,165,175,105,0,55,144,249,31,104,3,232,223,34,0,106,78,144,3,83,116,191,255,0,24,3,109,215,200,
+139,172,1,199,242,130,91,169,65,246,168,136,253,160,15,163,120,146,242,155,46,162,61,8,1,200,105,194,208,1,184,70,71,212,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,251,125,170,81,163,44,88,43,11,94,78,98,13,69,122,125,26,121,23,241,3,224,14,199,119,182,63,
+147,108,226,178,203,79,135,79,117,126,218,140,243,30,85,205,178,218,207,120,151,92,63,241,163,190,229,221,217,78,207,170,127,121,153,208,49,38,76,178,56,161,112,126,19,223,47,155,43,226,143,7,249,187,58,117,25,164,252,227,245,171,94,125,196,67,159,227,
+183,126,113,120,210,225,29,203,227,226,109,248,85,191,145,182,77,241,123,255,0,1,111,188,134,18,233,119,105,247,141,102,162,215,66,238,233,233,161,81,213,168,179,40,244,136,21,121,26,240,78,108,212,69,243,123,75,218,147,35,246,139,155,172,50,173,181,
+173,42,210,225,53,221,209,222,183,152,170,55,116,235,86,157,53,243,127,175,121,212,76,36,188,158,93,194,198,27,153,115,37,170,43,140,12,175,155,176,36,218,210,23,231,69,87,75,28,140,255,0,163,81,249,196,94,10,231,251,67,125,203,119,126,82,132,168,55,
+190,59,215,83,254,126,243,89,197,232,108,212,85,23,63,30,178,190,27,49,135,44,165,229,255,0,227,234,167,245,163,251,8,115,108,111,253,161,83,172,219,176,223,236,176,57,12,124,89,13,126,70,86,60,15,153,43,208,180,212,69,18,190,39,54,140,231,185,54,197,
+78,226,87,37,188,69,10,41,246,234,174,107,50,240,72,207,225,241,243,108,62,181,207,59,244,35,219,189,248,24,203,167,229,110,169,209,230,94,147,236,225,226,125,92,238,21,82,133,73,186,81,205,75,103,201,101,125,52,117,25,250,76,181,63,80,155,20,143,156,
+89,208,186,92,116,217,151,92,120,119,162,22,79,201,92,84,161,237,213,117,51,170,109,253,19,200,198,191,163,50,103,50,157,111,214,171,201,83,176,35,145,52,143,135,33,213,146,27,79,172,197,253,158,27,117,120,156,169,199,114,226,222,228,187,75,106,247,116,
+45,218,83,123,223,50,222,206,242,197,180,93,167,221,81,170,31,132,84,169,29,23,31,27,49,166,113,185,205,10,46,173,61,63,104,216,176,124,45,219,226,16,169,229,97,45,53,220,165,171,224,215,13,12,86,33,122,170,218,202,27,18,90,233,189,173,23,20,81,239,62,
+101,45,221,63,40,175,180,106,213,163,249,201,117,179,53,77,250,8,180,219,70,239,250,222,1,228,162,243,189,216,189,40,118,197,94,173,76,85,30,217,153,112,213,74,34,74,100,178,54,146,178,61,12,248,144,217,186,225,22,154,153,182,58,23,39,217,54,227,28,205,
+22,180,238,18,80,79,110,73,191,73,198,27,244,107,218,244,142,254,147,81,205,120,253,28,59,7,170,233,55,180,214,202,107,130,111,119,31,103,30,195,17,247,96,246,121,92,184,107,125,223,121,200,196,168,48,164,181,22,18,45,187,38,163,6,90,36,48,234,222,209,
+217,175,161,69,218,150,210,203,93,68,122,60,178,30,165,207,119,146,141,26,118,177,123,159,164,253,203,226,251,17,198,178,213,180,103,90,85,164,184,110,95,215,245,206,77,53,152,233,185,113,181,244,23,254,201,141,3,14,221,116,187,125,198,221,119,250,6,
+99,134,213,235,250,171,129,219,62,113,54,224,166,222,148,74,61,110,173,110,185,65,160,187,83,170,165,141,38,79,47,38,78,138,208,203,137,45,173,213,145,118,154,8,198,95,1,194,165,115,139,82,132,218,220,245,107,93,250,45,254,60,12,102,47,122,169,216,207,
+101,61,94,238,27,183,238,34,199,119,111,39,87,182,18,93,88,147,142,152,151,111,148,103,188,146,37,191,111,203,74,210,227,111,182,179,41,50,86,219,137,51,37,22,136,138,93,254,113,235,160,213,63,40,44,94,94,74,207,11,139,233,171,37,213,232,195,247,140,
+183,37,214,41,213,175,121,46,109,34,189,239,224,74,148,95,41,159,33,16,224,178,183,93,113,90,33,180,22,166,99,204,244,168,85,175,81,66,11,86,249,145,217,39,56,83,139,148,158,137,26,76,176,170,171,156,228,114,172,82,252,171,164,61,33,121,122,122,93,123,
+180,234,215,214,54,8,224,55,59,42,62,82,27,127,171,181,233,127,93,164,212,113,90,42,146,123,18,217,233,217,220,116,134,212,170,124,239,34,157,29,77,58,211,169,37,161,101,161,164,245,33,138,175,70,165,9,184,84,90,53,204,101,21,72,85,167,183,23,170,100,
+65,110,195,182,117,157,187,116,186,170,190,18,41,151,100,141,79,189,81,158,79,241,143,162,150,17,217,177,165,30,136,199,220,143,26,93,189,171,202,143,233,63,123,61,82,44,212,152,46,173,179,243,141,100,74,50,238,23,133,177,195,74,244,46,96,15,164,106,
+242,186,62,153,8,229,214,226,180,32,7,46,91,6,106,107,73,108,39,70,82,90,41,205,53,244,151,160,1,178,212,163,215,135,93,124,0,28,142,7,139,227,29,66,12,250,146,165,232,96,15,151,29,122,58,184,93,78,154,151,35,46,163,0,105,229,138,89,240,36,140,204,250,
+136,128,31,110,50,241,167,71,29,109,7,220,181,232,0,227,151,27,51,154,109,70,71,171,137,230,147,212,186,192,26,72,127,134,107,133,175,82,204,1,204,138,181,41,190,144,207,66,236,62,240,7,33,181,106,122,128,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,99,190,
+231,39,131,2,176,30,38,191,25,120,214,151,251,176,227,151,241,3,224,69,113,42,205,128,204,244,27,58,44,66,249,212,50,87,182,116,227,30,80,204,239,92,243,137,253,104,125,195,191,224,11,255,0,74,217,117,75,239,25,131,136,23,33,90,182,156,186,178,23,163,
+196,142,142,49,119,184,174,73,246,117,248,17,140,14,33,114,173,45,37,83,159,155,173,240,51,54,116,60,226,226,48,230,231,234,44,100,6,141,45,241,168,204,204,249,153,159,104,230,115,147,148,141,230,11,68,119,246,13,49,203,154,229,106,136,222,188,46,186,
+147,120,203,177,178,212,212,126,194,63,94,130,173,141,163,188,186,133,62,103,199,171,156,197,226,213,213,189,45,191,103,137,121,175,203,120,171,182,148,138,116,86,139,164,105,4,228,84,164,186,148,146,228,69,226,90,167,214,55,172,82,205,93,216,74,156,
+86,245,189,117,175,235,67,76,179,174,232,92,169,190,126,61,165,157,137,32,158,111,172,115,25,199,70,110,80,122,156,203,106,180,118,181,215,18,181,196,100,209,57,193,35,78,214,213,201,94,206,191,18,33,147,194,110,252,210,238,53,57,184,62,166,89,95,80,
+242,212,37,30,126,110,178,248,145,146,136,148,147,212,143,168,200,116,222,38,158,89,91,204,143,240,250,166,127,247,175,184,135,53,198,223,250,194,175,89,183,225,191,217,97,212,111,177,201,162,49,129,50,107,129,198,150,231,89,136,199,137,41,221,221,212,
+10,243,52,122,93,189,79,162,76,117,44,48,111,73,91,49,148,162,55,86,124,203,82,46,178,46,94,177,181,223,89,221,194,214,141,189,58,114,105,45,94,137,191,73,254,6,18,222,226,132,235,84,171,41,37,171,209,111,92,23,226,125,91,52,58,235,246,189,86,222,168,
+209,229,48,92,5,42,42,223,142,180,23,72,158,178,35,50,211,83,45,11,218,35,103,105,117,82,194,181,189,74,114,95,58,58,166,183,174,43,127,74,33,94,189,24,221,83,171,25,39,204,244,107,131,252,10,118,147,25,117,74,140,122,115,74,209,79,188,150,200,251,181,
+61,53,26,245,11,119,94,188,105,47,156,210,239,50,213,106,249,42,82,155,230,90,157,197,247,87,82,234,42,183,96,25,183,6,158,125,11,76,164,249,26,147,201,74,62,243,215,81,146,197,238,91,184,243,106,123,169,211,220,151,181,113,111,219,169,105,97,71,243,
+94,90,123,229,45,237,251,145,183,134,101,165,249,0,255,0,91,254,233,98,124,3,253,173,79,183,238,178,92,79,251,12,251,61,232,88,240,227,72,185,164,212,102,181,198,205,57,151,101,41,7,212,163,79,81,123,79,95,80,155,12,163,78,119,211,171,53,170,166,165,
+46,226,91,202,146,86,209,132,120,201,168,247,144,211,188,207,153,249,151,166,39,89,25,103,135,84,55,147,73,136,187,138,188,218,121,145,202,147,171,81,81,232,52,178,135,21,167,116,130,30,140,228,43,9,171,58,23,120,229,198,249,84,126,78,31,86,59,228,250,
+156,154,95,178,114,46,82,47,160,171,209,195,232,238,140,22,211,235,123,151,114,215,188,152,189,143,57,96,86,81,242,5,135,57,115,170,193,232,42,110,219,101,84,184,208,190,106,77,86,102,178,159,35,62,244,26,201,159,6,72,187,6,111,17,191,249,83,22,173,171,
+244,101,185,118,110,95,137,103,97,106,173,48,248,73,122,220,89,144,214,65,159,225,43,73,50,234,66,245,215,232,152,195,225,255,0,218,215,111,184,202,221,254,129,144,167,189,161,153,22,225,219,152,93,148,138,60,255,0,124,153,42,77,217,94,97,183,52,50,109,
+178,84,72,68,162,46,195,82,166,43,159,205,35,27,190,68,180,244,234,221,181,209,21,239,127,3,85,204,247,58,202,20,19,246,191,135,196,202,125,142,88,55,84,194,77,153,118,118,29,92,253,42,170,78,208,206,230,119,202,53,227,97,114,214,111,147,90,31,81,37,
+133,50,141,61,6,60,243,202,14,55,28,205,152,241,21,198,20,183,67,216,169,238,150,157,111,105,246,157,79,42,216,60,39,10,181,151,206,159,173,215,45,235,185,104,187,12,146,180,163,84,227,90,53,10,245,34,11,207,76,121,226,137,28,216,104,214,166,211,166,
+171,81,105,213,200,200,181,236,26,46,27,70,181,44,58,173,122,49,110,109,236,173,22,173,115,183,187,222,109,23,117,41,206,234,20,234,61,34,183,189,121,250,10,54,69,171,119,28,213,184,86,213,75,94,147,94,47,34,115,251,133,180,112,252,65,36,252,148,190,
+203,252,12,253,43,187,79,38,151,148,143,122,59,187,233,153,199,65,164,92,21,72,174,53,53,113,156,110,81,60,217,165,102,109,158,132,163,35,231,169,151,63,96,191,198,105,84,157,181,10,213,86,147,105,169,107,185,238,123,155,235,45,108,42,66,21,43,82,131,
+214,41,166,180,225,191,137,14,123,168,140,121,126,218,180,203,235,232,236,187,145,210,63,18,66,127,136,123,234,217,105,111,5,236,94,227,200,245,223,231,101,214,253,231,169,197,27,145,150,107,65,17,145,242,82,76,185,24,174,82,54,148,212,25,39,163,74,232,
+92,62,164,168,252,211,245,128,56,18,144,227,14,155,47,167,69,23,88,3,126,171,241,172,127,86,71,222,0,220,166,159,70,135,101,153,106,109,39,205,215,188,192,27,78,40,214,174,51,81,153,159,89,152,3,117,135,13,248,175,69,81,235,209,163,164,71,163,78,176,
+6,144,157,54,33,46,119,202,53,244,109,159,119,105,152,0,94,122,73,74,62,103,204,204,1,242,218,120,102,50,95,165,79,218,0,58,193,28,231,229,202,62,6,82,233,150,189,171,62,226,0,111,198,150,169,11,35,225,225,73,114,74,75,168,136,1,216,49,207,152,3,116,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,91,239,210,56,48,207,47,17,53,248,203,138,227,95,238,199,128,95,196,15,129,21,196,184,219,8,163,148,125,158,56,126,157,62,21,177,29,95,189,38,97,253,227,201,153,138,91,89,231,20,250,241,251,167,160,112,53,166,88,178,
+250,175,222,95,188,118,175,29,66,177,26,216,142,189,91,136,158,149,242,46,215,20,92,136,252,19,207,246,134,131,153,46,246,170,198,130,230,222,250,223,242,247,155,150,9,109,164,29,87,207,185,117,127,243,238,41,30,139,163,143,213,216,53,45,117,145,177,
+105,162,46,78,93,237,179,106,60,235,170,74,60,231,148,76,71,215,230,23,53,31,173,90,23,236,152,220,178,237,174,205,41,87,151,62,229,213,207,253,123,13,51,49,87,214,180,105,46,109,236,185,163,100,53,194,203,223,180,47,193,139,202,68,102,209,163,18,79,
+167,143,220,73,81,158,165,234,86,165,225,160,231,56,229,167,154,222,201,46,18,222,187,127,153,182,97,213,252,181,186,111,138,220,206,174,83,68,243,90,105,168,194,193,232,204,140,214,171,82,236,97,85,120,235,118,147,45,60,189,94,135,239,14,234,124,204,
+136,188,211,253,221,61,100,99,164,224,151,126,117,99,29,120,199,115,248,120,26,134,35,67,200,220,189,56,61,229,189,189,17,255,0,94,234,71,223,35,238,33,165,99,111,253,99,87,172,216,176,239,236,176,234,53,108,244,111,79,64,193,153,3,151,106,82,145,86,
+184,227,178,249,123,203,74,55,95,51,234,36,39,159,63,168,189,99,41,131,219,171,155,248,70,94,170,222,250,150,255,0,228,89,223,213,116,109,100,215,23,185,117,179,102,175,119,92,115,234,82,37,198,173,205,101,183,29,82,155,105,185,75,73,37,58,242,45,8,244,
+234,21,46,49,123,218,183,18,156,106,73,38,222,137,73,173,23,49,10,86,22,240,164,162,226,155,75,161,31,118,253,225,95,167,86,163,75,159,91,152,235,9,116,137,230,222,146,165,36,210,124,143,145,159,113,234,42,217,98,247,116,174,225,42,149,36,227,174,244,
+219,107,78,114,75,155,10,19,161,40,194,9,62,109,18,21,40,73,179,177,0,148,72,209,134,102,161,228,105,249,51,50,86,133,234,61,61,66,165,196,22,27,140,253,24,201,53,213,199,221,184,146,148,157,229,135,181,166,187,120,31,55,237,49,218,117,207,37,197,22,
+173,74,112,223,101,194,234,90,85,207,145,248,153,144,163,141,80,149,11,249,190,105,61,164,250,83,222,84,195,170,70,173,172,87,58,220,251,13,204,51,47,250,241,4,255,0,91,254,233,98,166,95,255,0,107,83,237,251,172,147,20,254,197,62,207,122,52,178,165,193,
+137,91,168,194,169,204,75,12,205,129,33,151,30,89,232,148,117,171,83,63,66,72,197,198,14,252,166,33,58,31,239,35,40,37,237,124,10,24,139,242,118,177,171,250,141,50,5,242,173,135,55,38,211,253,186,105,145,136,116,41,30,229,174,249,147,94,184,32,201,65,
+151,147,209,169,134,74,102,58,200,254,74,144,212,102,61,38,239,164,123,62,214,202,25,55,35,82,179,135,173,8,40,245,206,91,228,251,220,153,231,186,213,231,143,102,25,215,150,245,41,107,251,43,114,240,209,30,153,45,52,45,53,37,214,95,34,38,226,180,227,
+142,40,186,184,140,140,136,188,121,142,117,100,154,170,234,62,17,90,155,157,198,158,77,83,92,231,205,144,75,93,202,215,15,194,81,47,214,102,71,160,142,31,253,169,62,178,23,122,70,131,108,243,45,158,139,134,86,212,13,185,115,236,58,28,197,74,161,200,190,
+99,90,148,213,163,94,22,233,52,227,232,164,188,147,237,73,147,82,158,215,243,199,67,175,121,28,165,145,106,222,207,116,161,77,207,246,229,234,174,247,20,105,180,232,75,26,204,80,160,184,74,73,118,46,62,26,178,123,237,154,115,22,181,141,62,115,49,211,
+25,137,49,83,2,153,29,62,105,116,101,200,200,139,177,41,73,17,122,135,140,45,101,59,108,58,189,205,87,190,162,217,94,215,206,250,143,66,212,138,157,205,58,17,249,158,147,246,116,27,244,87,42,18,176,234,100,42,84,151,81,34,12,242,144,162,97,102,149,41,
+163,79,9,245,117,145,30,166,126,2,123,90,149,106,96,211,133,38,212,161,45,173,220,116,107,79,230,66,188,33,12,66,50,154,221,37,166,254,157,74,41,250,245,193,229,78,23,187,147,62,31,63,231,75,239,241,22,49,189,187,217,95,156,151,123,54,58,54,214,254,77,
+122,11,185,27,53,137,211,229,82,228,63,58,99,207,27,81,157,52,155,174,154,180,209,6,125,162,147,171,90,181,88,169,201,189,235,139,215,156,171,58,84,168,209,150,204,82,221,204,69,14,232,123,62,95,182,14,108,189,53,232,240,194,190,238,190,47,196,79,241,
+15,162,244,150,148,210,246,35,198,51,122,205,179,212,156,173,52,49,57,3,175,144,90,145,128,62,170,105,82,163,197,55,117,55,58,51,226,240,215,144,3,234,166,131,55,24,61,63,201,147,247,128,62,233,233,55,25,126,46,188,214,146,52,151,121,144,3,142,101,167,
+35,0,111,69,73,180,196,137,71,200,141,163,66,79,188,204,1,164,86,148,253,45,113,147,205,77,187,198,69,222,90,104,0,213,179,46,2,230,0,33,58,204,104,255,0,74,159,180,128,26,57,35,130,107,241,101,39,141,133,186,122,151,106,79,188,128,27,205,197,84,85,17,
+37,92,72,62,104,89,118,144,3,158,194,185,0,55,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,37,191,11,33,69,108,229,190,49,23,154,117,43,169,103,207,180,155,165,151,222,15,129,21,196,188,59,20,156,141,67,217,213,135,181,9,42,209,182,236,120,78,175,195,142,74,
+190,241,228,28,193,94,52,115,150,47,82,124,35,61,95,115,61,19,130,83,149,76,185,97,21,197,199,240,46,76,183,228,86,106,175,213,230,115,114,67,202,113,94,141,79,171,192,186,189,67,146,221,92,202,226,180,170,75,139,122,157,30,133,24,209,164,160,184,35,
+117,113,245,111,79,64,180,79,71,169,92,169,45,204,81,186,168,84,164,210,233,176,160,19,81,210,73,65,41,149,25,159,164,252,238,179,235,25,218,89,130,238,218,148,41,70,49,209,45,56,63,196,214,177,28,38,133,74,219,109,189,95,87,224,86,56,93,137,117,59,194,
+124,170,85,117,136,237,190,219,100,227,29,2,13,36,164,235,162,181,212,207,153,106,159,105,141,131,8,197,167,127,57,66,166,154,173,235,79,19,95,191,177,141,180,84,161,174,158,211,115,25,237,227,169,219,200,173,71,70,175,83,215,196,122,118,182,173,9,94,
+195,208,253,70,33,152,109,124,181,159,149,92,97,238,231,252,70,21,91,201,220,108,62,18,247,150,225,130,233,27,47,1,207,37,186,70,215,29,232,169,176,166,172,116,107,155,200,93,86,140,206,79,70,125,220,101,205,39,246,151,237,13,135,46,94,249,11,223,39,
+46,19,221,219,205,248,118,152,172,90,219,202,91,237,174,49,223,217,206,112,239,86,117,189,106,11,253,63,220,66,199,27,151,250,206,175,89,115,135,47,244,56,63,97,178,210,53,71,49,134,47,210,212,230,83,106,167,74,133,54,51,81,181,118,99,36,209,61,199,167,
+2,117,243,139,77,57,235,226,47,173,111,124,214,133,88,70,59,230,180,215,94,11,159,119,62,189,101,181,123,127,45,82,18,111,116,94,186,116,190,110,227,128,152,220,133,137,114,147,102,142,69,212,131,93,6,140,229,92,21,79,119,89,135,211,196,225,122,44,98,
+101,110,241,235,210,145,117,30,154,114,237,239,235,25,27,203,255,0,60,133,61,168,233,40,173,150,245,227,167,14,111,196,181,183,182,243,121,79,71,186,79,93,58,13,218,109,207,34,45,61,52,122,181,61,138,132,84,124,83,114,8,248,155,250,42,46,100,43,219,226,
+211,167,69,81,173,5,82,11,130,124,87,83,230,41,85,177,140,234,121,74,114,113,151,179,159,173,27,241,238,186,85,41,255,0,44,183,173,8,241,95,45,120,30,118,66,221,52,234,90,30,154,233,216,43,195,23,181,182,150,221,181,186,140,186,91,114,211,191,66,156,
+172,107,86,91,53,170,182,186,52,72,195,221,178,89,137,145,150,156,131,94,119,29,34,168,168,149,203,157,45,219,244,55,91,119,129,100,244,179,50,117,104,50,230,74,68,116,190,122,246,30,131,108,228,175,6,120,246,119,183,140,150,176,164,252,172,186,161,190,
+58,245,207,100,215,243,190,32,176,220,191,87,101,233,41,250,11,183,143,134,172,165,55,92,109,58,158,35,225,173,247,156,108,88,176,41,146,43,18,165,181,105,81,110,22,227,155,18,166,69,97,40,147,36,220,82,121,47,223,21,25,26,145,23,197,168,180,239,245,
+14,118,196,105,70,173,59,73,45,173,61,39,191,78,59,151,199,188,227,185,110,210,114,115,174,158,156,203,250,254,184,18,195,62,162,244,200,197,1,136,232,143,24,143,94,133,174,211,239,51,237,28,246,173,212,170,71,98,41,70,61,11,226,109,244,232,168,203,105,
+189,89,102,179,197,153,184,217,41,202,38,34,102,117,210,101,79,218,182,188,151,105,140,190,231,9,63,57,210,232,34,55,169,117,113,62,235,69,237,23,248,29,25,92,226,180,169,199,139,107,94,174,47,195,82,203,21,170,168,216,206,79,163,196,135,45,222,139,103,
+8,113,83,48,23,150,100,105,217,109,141,75,149,105,82,83,18,61,89,235,134,76,182,220,155,56,212,75,225,109,194,34,35,38,91,119,95,214,145,124,161,83,151,28,195,71,12,193,237,240,237,149,39,90,91,90,62,26,83,225,175,74,114,107,184,161,201,206,23,82,243,
+17,169,115,171,138,166,180,77,116,203,249,47,18,91,171,53,74,141,195,36,164,212,92,35,225,79,11,77,33,60,40,109,61,201,46,193,228,251,203,234,247,181,54,234,62,28,18,220,146,232,72,238,84,45,233,91,67,102,11,175,165,245,159,20,121,245,27,126,113,84,41,
+143,155,110,17,104,100,101,169,40,187,72,203,180,132,182,151,181,236,171,42,148,158,143,223,236,100,107,219,210,185,167,177,81,106,142,60,203,150,217,147,41,201,19,44,8,198,249,186,122,173,153,75,109,6,122,252,194,228,51,159,41,88,84,74,83,181,91,94,
+201,52,187,145,113,74,198,238,16,74,53,222,154,115,164,223,121,79,223,149,52,76,160,84,231,183,79,98,42,90,165,191,209,179,25,58,17,18,90,81,235,233,62,125,98,205,215,141,205,244,26,130,138,213,45,23,14,62,255,0,105,117,42,94,111,107,36,228,228,248,234,
+200,166,220,227,142,185,59,88,171,82,58,248,48,118,178,163,61,59,78,101,60,135,209,68,180,60,102,122,144,113,70,148,154,20,217,40,181,234,50,17,6,193,155,41,61,91,132,158,46,245,25,153,0,54,93,140,243,238,27,174,159,17,152,3,125,36,70,218,91,126,41,47,
+128,180,73,234,101,200,1,180,81,214,135,58,70,139,132,200,245,45,59,0,27,138,83,110,31,27,240,210,165,118,168,140,203,80,7,203,168,114,65,37,6,146,74,19,240,82,146,228,64,13,27,142,235,11,39,90,51,37,23,112,3,113,70,218,143,137,216,73,53,31,105,40,200,
+1,242,77,106,242,94,75,68,146,73,145,146,75,208,0,209,216,134,243,170,119,135,78,35,215,64,6,244,100,41,180,27,74,79,18,15,179,184,192,27,237,36,200,128,27,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,35,223,129,130,219,152,97,151,138,129,151,156,221,197,113,
+180,94,11,143,0,207,253,130,7,192,138,226,84,123,35,107,111,22,204,140,49,167,164,244,84,203,105,148,56,127,152,212,169,37,167,183,132,120,135,148,107,153,91,230,252,78,130,249,245,35,221,178,190,45,30,160,201,52,21,92,189,101,85,252,216,190,246,255,
+0,249,47,243,109,18,59,7,57,55,132,181,55,120,57,117,137,118,137,244,57,116,152,169,114,59,154,151,202,47,176,82,156,180,145,142,189,94,146,57,118,236,181,219,55,44,90,210,53,36,180,238,142,145,23,90,15,146,139,216,103,235,25,12,54,247,205,46,225,87,
+153,61,253,92,230,34,238,219,203,208,148,23,63,188,185,18,49,42,194,154,195,144,228,84,212,166,221,65,161,196,156,87,52,50,50,208,203,224,141,226,120,238,17,56,56,202,123,159,177,254,6,185,28,54,250,50,77,71,122,246,162,218,166,35,44,200,113,168,175,
+116,141,37,102,77,57,161,151,18,117,228,122,31,80,231,53,246,21,86,160,245,90,238,125,40,219,41,237,108,45,165,163,55,144,219,141,56,135,218,81,165,104,81,41,42,46,178,50,237,20,161,57,83,146,148,94,244,77,40,169,71,71,193,156,186,196,162,171,213,222,
+169,240,112,155,198,74,82,123,143,66,215,235,23,55,215,62,119,117,42,223,173,191,195,121,74,218,139,163,69,83,232,54,200,180,45,8,89,183,161,116,150,134,162,27,64,8,106,192,13,166,13,13,9,62,193,29,164,67,68,104,109,36,196,117,68,54,77,9,148,134,168,
+108,144,185,188,165,152,169,55,198,96,44,236,169,219,47,45,230,45,42,95,186,117,104,204,121,221,37,70,118,132,211,102,146,230,106,76,116,54,101,253,96,199,171,249,2,192,85,174,13,113,139,212,91,235,75,102,63,82,28,90,235,147,127,100,225,156,166,226,78,
+190,35,78,202,28,32,181,127,90,92,59,151,188,155,93,154,217,83,107,38,89,26,195,108,187,46,34,90,168,209,109,198,158,184,13,9,211,142,167,36,206,76,195,62,253,30,117,104,47,67,100,43,227,55,207,17,196,234,215,230,111,119,82,220,188,9,176,171,87,105,101,
+8,62,58,111,235,47,161,71,34,236,24,163,38,68,14,246,174,106,138,209,193,27,3,39,118,253,71,134,93,219,87,93,197,113,52,218,185,148,8,122,181,25,10,47,154,185,11,113,126,49,136,116,12,137,99,183,113,82,238,75,213,91,43,173,241,238,94,243,78,205,55,58,
+40,80,92,251,223,245,253,112,43,141,135,57,110,60,190,108,248,181,102,212,233,221,13,98,249,117,203,154,167,196,141,21,193,32,146,152,169,61,121,242,140,219,74,211,189,195,30,109,229,131,30,249,115,59,215,140,30,176,161,165,40,254,207,173,254,54,215,
+97,214,114,22,24,176,252,191,9,73,105,42,158,155,237,225,225,161,152,68,132,151,96,230,27,72,221,244,67,129,38,125,65,180,131,75,66,159,144,217,148,135,12,203,173,103,246,139,196,253,4,101,41,175,65,29,38,34,43,201,176,246,190,249,245,55,66,154,163,245,
+71,112,197,213,142,178,190,164,190,148,126,242,45,239,247,89,84,234,126,226,50,119,49,225,147,251,81,46,233,90,124,78,12,84,143,219,80,167,16,250,54,120,192,245,4,166,117,236,0,124,249,55,160,1,175,147,151,112,1,208,23,112,1,208,23,205,0,105,228,222,
+128,7,210,88,34,236,0,13,146,50,234,0,124,156,125,123,0,26,147,26,118,0,62,186,31,0,3,162,211,176,128,31,68,130,46,96,13,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,79,191,0,247,14,20,101,226,62,191,14,228,184,149,166,157,209,224,151,222,15,129,21,196,237,182,
+71,199,54,182,111,97,25,25,245,219,10,86,158,50,228,31,222,60,39,202,107,255,0,215,151,239,233,254,236,79,85,228,53,166,84,181,250,191,22,100,105,36,136,104,141,182,110,6,162,0,236,168,92,227,56,127,165,251,133,42,175,70,99,238,189,117,212,114,93,140,
+151,4,137,150,174,38,209,83,200,143,94,18,17,213,144,209,155,237,178,72,16,108,138,71,216,151,104,152,6,208,2,80,0,0,0,0,0,0,27,21,74,165,54,135,76,147,90,173,74,75,16,225,199,114,68,199,220,61,18,211,40,73,173,106,51,238,36,145,159,168,85,165,78,165,
+106,138,157,53,172,155,73,46,150,247,47,18,149,106,145,163,73,206,79,68,136,40,217,179,102,204,218,149,183,38,30,38,222,48,23,46,138,119,132,203,222,180,195,169,61,17,78,130,162,114,36,117,23,106,77,69,13,141,15,177,90,15,122,187,74,121,71,35,210,176,
+167,198,16,141,62,185,53,233,62,215,180,207,49,121,89,99,121,130,87,18,225,41,57,118,46,11,220,143,76,220,106,81,154,150,173,84,103,170,143,188,251,71,41,58,2,73,45,16,36,154,148,72,79,194,81,145,39,94,243,1,39,178,181,60,200,103,18,238,169,237,126,219,
+137,46,212,161,79,118,69,183,58,241,110,218,163,58,210,181,38,40,20,227,82,94,125,6,93,68,180,55,37,255,0,164,247,164,117,59,203,232,100,156,137,86,246,94,180,32,229,215,57,110,138,251,78,43,176,208,104,91,207,48,102,24,80,92,37,45,63,101,113,125,218,
+178,119,169,116,186,109,18,155,30,143,69,132,136,208,226,71,67,16,227,54,157,18,203,72,73,37,8,34,236,36,164,136,139,192,120,50,173,90,149,170,58,149,30,178,109,182,250,91,222,223,121,233,186,84,227,70,154,132,86,137,28,145,76,170,106,93,101,226,1,240,
+58,23,203,249,195,165,249,199,246,139,181,189,25,74,126,162,41,124,100,127,201,112,126,236,148,95,209,218,213,37,251,34,58,99,35,132,199,111,20,160,190,156,62,242,44,177,87,179,134,214,127,69,251,136,232,220,174,137,211,109,36,196,57,60,63,19,130,146,
+207,95,26,173,52,135,209,131,198,135,167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,3,123,241,14,173,54,62,91,154,47,130,117,139,160,207,196,154,165,233,246,152,62,4,87,18,172,217,72,217,55,179,151,7,210,95,254,142,108,250,251,
+222,120,254,241,224,254,82,91,121,235,16,255,0,152,253,200,245,118,71,90,101,107,95,170,140,132,26,57,182,128,7,103,66,213,49,156,215,242,159,112,163,91,138,44,46,189,117,212,115,69,18,216,0,0,0,0,0,0,0,0,0,0,0,0,12,77,219,97,152,98,203,214,207,27,214,
+68,9,221,5,82,240,109,187,98,148,105,95,10,141,82,248,137,243,45,57,242,140,135,249,247,153,14,151,201,46,7,242,230,121,182,82,90,194,142,181,101,251,30,175,248,220,77,51,61,98,95,39,229,234,187,47,73,79,208,95,181,199,195,82,212,238,141,229,133,116,
+44,44,196,236,222,86,160,26,93,184,42,140,90,214,243,174,35,159,147,69,34,147,45,73,62,212,169,215,99,167,197,131,238,30,156,207,183,187,85,169,90,167,193,109,62,183,185,120,39,222,113,252,175,109,166,221,102,189,159,143,245,236,38,64,115,195,115,49,
+207,107,38,105,139,39,59,61,177,59,27,224,84,10,61,93,155,117,116,203,105,90,249,222,233,205,63,37,142,105,46,211,65,184,167,124,26,49,151,192,108,190,80,197,169,81,124,53,213,245,45,239,240,49,56,197,215,154,216,78,75,143,4,67,158,236,150,92,189,220,
+196,155,251,53,53,168,70,166,104,84,246,237,234,27,235,230,71,42,78,142,201,81,126,114,89,67,105,215,186,65,247,140,111,229,5,143,58,22,22,184,61,55,190,163,117,37,245,99,186,61,142,77,191,217,43,242,95,134,42,183,149,111,166,183,69,108,174,183,189,247,
+45,59,201,144,30,86,59,120,0,0,29,20,210,254,118,239,235,79,237,23,113,245,76,165,63,81,117,20,86,98,31,242,108,191,223,114,123,91,178,234,234,47,84,23,140,101,176,37,181,141,218,174,154,148,254,252,76,126,53,187,8,175,245,37,238,102,4,110,80,69,53,231,
+235,21,38,25,124,12,29,82,53,250,85,104,39,252,35,232,153,227,134,122,93,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,5,27,239,209,122,76,38,203,204,237,57,181,114,220,45,235,244,163,65,63,225,7,192,138,226,118,219,35,164,46,86,205,
+220,35,113,211,212,202,216,82,15,193,50,228,36,190,162,30,19,229,57,105,159,111,210,253,127,221,137,234,188,135,171,202,150,175,232,252,89,145,163,67,55,0,0,237,40,159,139,43,245,159,113,10,53,189,114,194,235,215,93,71,48,81,45,128,0,0,0,0,0,0,0,0,0,
+0,0,0,134,45,230,60,194,59,118,99,109,139,149,218,20,165,58,205,177,73,93,102,172,195,92,245,155,52,201,12,160,200,190,82,88,104,140,139,254,241,233,30,175,252,159,240,63,55,194,110,113,106,139,125,89,108,71,234,195,123,107,216,228,244,253,147,134,114,
+157,137,121,124,66,149,156,30,232,45,95,92,184,119,47,121,53,187,50,50,192,156,157,100,55,12,50,254,244,36,177,81,164,91,12,200,175,161,41,208,206,165,43,89,82,204,251,204,157,121,72,240,65,119,11,172,106,247,229,12,82,173,117,193,189,221,75,114,240,
+33,132,219,59,91,40,65,241,211,127,89,126,6,40,202,16,123,189,189,155,131,151,94,195,156,145,91,149,51,232,161,48,171,182,234,105,181,158,134,235,156,113,224,182,173,59,82,217,73,115,67,252,178,12,116,188,135,97,164,42,94,73,113,244,87,189,252,17,164,
+102,123,173,170,177,160,158,229,189,255,0,93,230,86,108,159,203,47,248,40,100,66,197,195,202,148,14,130,181,81,131,238,237,198,74,78,139,242,217,132,151,77,10,244,182,215,66,215,249,161,228,222,82,179,7,249,73,156,110,110,98,245,167,23,228,225,245,97,
+187,197,237,75,180,237,185,55,11,249,43,1,165,78,75,73,73,109,75,173,239,240,90,46,195,35,134,132,109,64,0,0,116,114,255,0,25,119,233,159,218,47,33,234,163,41,75,244,104,183,185,172,127,201,114,187,137,50,191,39,135,213,181,115,244,64,124,102,178,218,
+218,204,86,107,166,173,63,191,19,25,143,61,48,91,151,244,39,247,89,132,123,147,17,184,179,161,140,19,127,39,133,209,209,175,210,169,176,127,194,62,135,30,59,103,164,224,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,121,190,229,74,
+113,236,183,96,101,116,139,204,141,125,213,88,53,119,27,144,91,81,127,186,48,124,1,192,216,213,81,69,75,102,134,20,186,149,106,109,82,166,50,124,251,81,80,148,145,225,158,85,96,233,231,251,228,249,229,23,223,8,158,168,228,253,169,229,43,103,236,126,18,
+102,79,14,122,110,128,1,217,208,255,0,21,81,254,127,220,66,149,110,40,199,220,254,144,230,138,5,184,0,0,0,0,0,0,0,0,0,0,0,109,74,149,18,20,103,38,79,144,150,88,101,181,56,251,203,61,18,218,18,90,169,70,125,196,68,103,234,19,66,50,156,146,138,213,190,
+29,101,58,147,141,56,57,62,8,130,28,151,219,146,118,174,237,217,129,120,215,33,170,85,189,54,250,126,231,169,33,100,102,150,232,148,223,124,97,149,23,205,82,25,140,207,139,190,145,239,91,59,24,228,236,133,74,202,59,165,10,106,61,115,151,172,254,211,108,
+243,29,123,137,99,153,142,117,222,245,41,55,251,43,114,240,73,30,155,53,53,168,212,231,194,51,51,81,122,79,153,142,88,111,201,40,173,17,182,235,141,52,131,118,67,233,105,180,150,174,58,181,104,72,73,117,168,207,176,136,181,51,240,4,155,123,136,78,74,
+49,108,243,20,154,163,187,93,182,233,204,186,164,19,147,45,154,221,254,228,179,35,62,36,34,220,166,23,189,32,245,248,36,184,241,155,71,210,123,210,58,86,104,196,22,75,228,246,181,88,189,42,70,27,49,255,0,153,83,114,238,111,94,195,72,193,237,94,96,204,
+244,224,247,197,203,87,245,99,191,199,77,58,217,62,29,103,175,9,39,95,146,93,69,232,33,225,19,211,9,108,173,0,19,0,0,1,209,202,61,100,186,127,164,63,180,94,67,213,70,82,151,232,209,108,179,149,39,201,114,135,138,143,252,204,56,174,31,254,65,225,159,202,
+171,107,51,216,175,248,212,190,250,49,89,133,233,128,221,63,248,115,251,172,196,13,200,248,220,89,161,198,217,156,63,23,135,244,196,126,244,245,31,240,143,161,40,241,225,232,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,70,250,
+221,37,167,246,124,225,141,108,254,28,92,98,105,178,240,114,149,59,95,246,8,1,104,182,17,207,92,221,153,54,43,78,171,83,139,81,172,180,94,130,42,139,234,34,254,208,241,71,44,144,80,229,2,233,174,117,77,255,0,254,113,95,3,211,188,154,212,115,202,116,83,
+230,114,95,227,145,152,3,151,27,248,0,118,148,63,197,15,245,134,45,234,113,49,215,127,165,236,57,130,153,64,0,0,0,0,0,0,0,0,0,0,0,49,159,107,246,63,43,46,155,61,49,18,236,131,48,217,169,214,169,133,111,81,212,149,104,175,40,156,125,2,148,147,239,75,38,
+250,255,0,96,116,30,75,176,95,151,179,189,165,25,45,97,9,121,73,117,67,126,254,185,108,174,211,82,206,184,143,201,217,122,180,147,210,82,91,43,174,91,188,22,175,176,199,77,209,60,179,165,154,86,42,230,254,175,79,243,159,118,53,163,64,125,109,243,36,164,
+147,50,105,164,207,175,153,195,78,165,220,100,61,85,159,175,119,210,180,94,217,63,114,248,156,95,43,91,122,83,174,250,151,199,224,77,88,231,6,234,98,78,220,12,216,127,130,6,205,92,68,190,105,117,51,141,95,184,224,21,175,108,169,11,36,175,203,39,146,154,
+83,136,244,183,31,202,29,244,27,100,54,12,179,97,242,134,49,78,13,122,49,244,159,82,252,94,136,194,227,151,94,107,97,45,56,189,203,250,241,35,3,118,63,45,156,12,98,14,109,43,112,62,31,71,107,219,206,184,223,61,11,130,76,197,17,159,132,84,106,95,156,67,
+84,252,160,241,237,246,152,53,55,211,86,107,190,48,253,231,220,101,57,47,194,253,42,215,243,95,65,123,229,240,241,37,180,121,152,236,192,0,0,8,181,61,0,29,12,159,198,28,253,97,253,162,238,43,209,70,86,159,168,186,139,77,158,233,5,19,36,216,187,39,230,
+225,173,107,255,0,178,116,108,217,54,59,89,182,193,127,198,167,247,209,132,205,18,217,203,183,111,254,28,254,235,49,123,114,26,41,175,29,113,234,105,23,197,218,20,54,245,250,83,36,159,240,143,160,103,144,79,69,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,2,28,247,212,222,224,217,193,135,76,113,25,113,227,68,67,229,213,202,149,81,254,240,5,142,216,42,131,70,204,251,57,95,62,183,90,81,127,227,156,47,184,120,175,150,103,255,0,175,238,62,173,63,184,143,77,114,96,180,202,148,250,
+229,247,153,153,35,149,157,8,0,59,74,39,226,95,7,229,255,0,112,161,87,214,49,183,63,165,57,130,145,68,0,0,0,0,0,0,0,0,0,0,0,34,43,121,235,31,77,82,240,215,44,84,217,100,105,109,185,55,53,105,132,175,181,70,113,98,234,94,130,76,165,115,249,196,61,59,249,
+61,224,222,133,230,45,37,209,74,47,252,83,253,197,216,113,142,84,177,22,234,80,178,139,233,147,247,47,137,42,251,22,178,215,254,10,251,51,176,171,14,166,211,206,61,86,163,111,166,225,175,33,105,209,126,89,81,63,42,52,171,210,134,214,203,127,230,244,27,
+30,99,188,243,236,102,173,68,247,39,178,186,163,187,249,246,152,204,14,219,205,240,248,107,197,239,239,50,152,96,204,209,1,155,216,25,178,127,17,243,41,100,100,182,208,156,167,226,88,212,191,117,235,177,163,159,23,73,86,158,68,76,180,105,46,102,166,226,
+165,179,47,235,74,29,79,35,217,70,222,202,165,228,247,109,110,77,254,170,226,251,253,198,131,153,46,93,107,181,66,63,55,222,255,0,175,18,65,182,126,229,174,62,82,114,121,98,96,90,227,33,21,10,101,21,15,87,148,146,248,117,41,30,255,0,40,204,251,116,113,
+102,130,244,54,145,227,76,237,143,203,51,102,139,172,67,93,99,41,53,15,169,31,70,62,11,94,182,119,252,181,134,44,35,6,165,110,215,164,150,178,250,207,123,241,47,40,212,204,248,0,0,26,151,89,120,128,124,14,129,213,107,33,223,164,127,104,187,92,12,173,
+63,81,22,95,104,172,164,194,200,86,50,72,87,45,48,214,174,69,226,113,150,146,250,204,109,153,22,46,121,207,14,95,241,169,253,228,204,6,108,146,142,90,187,111,253,220,254,235,49,251,113,238,34,207,18,179,19,48,219,62,20,80,173,166,248,244,237,55,234,7,
+167,212,61,250,121,20,244,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,143,125,126,79,6,65,48,178,33,127,73,140,40,87,238,210,166,255,0,120,2,211,236,33,100,218,217,141,98,40,203,78,146,163,90,87,87,255,0,82,124,190,225,226,126,
+89,30,188,160,221,117,83,255,0,199,19,211,220,154,110,202,52,122,231,247,228,102,0,229,230,252,0,29,181,27,241,2,250,66,133,95,88,198,220,254,148,229,10,69,16,0,0,0,0,0,0,0,0,0,1,162,143,205,79,51,51,208,139,210,4,173,164,64,158,101,162,43,105,110,221,
+198,48,134,150,241,205,163,84,177,34,159,105,178,105,230,148,211,32,169,45,75,113,63,155,194,212,167,117,252,237,71,185,178,13,132,178,183,38,180,92,214,147,112,117,31,214,159,164,151,98,113,93,135,155,51,45,215,202,249,170,166,158,174,210,138,234,142,
+231,227,171,61,56,198,98,44,118,17,22,12,116,180,195,105,36,48,210,11,66,66,8,180,74,72,187,8,136,136,189,67,159,54,219,213,155,140,22,196,82,56,23,133,217,64,176,109,42,173,243,118,206,76,106,93,22,153,34,161,84,144,179,208,154,140,195,74,117,213,25,
+246,104,132,40,196,212,169,206,181,69,8,241,109,37,214,201,43,84,84,169,57,190,8,243,55,144,26,61,199,181,11,108,156,188,126,196,184,203,145,13,119,52,219,230,190,195,165,196,134,216,97,210,84,56,189,220,36,226,162,52,68,127,33,7,220,55,158,82,241,88,
+229,46,79,106,82,162,244,156,210,163,30,185,47,73,245,236,169,62,179,85,202,86,47,28,204,208,148,215,163,23,182,250,151,5,223,167,97,61,198,106,51,213,92,204,207,83,62,243,30,31,61,30,150,136,1,48,0,0,26,151,89,120,128,124,14,129,242,247,231,11,78,165,
+159,218,47,121,145,149,167,234,35,28,118,183,87,85,110,236,224,197,217,201,86,134,237,174,81,117,215,242,210,152,100,203,216,179,27,223,38,84,124,190,124,176,143,68,245,251,49,147,248,26,158,123,169,228,242,165,212,190,142,157,237,47,137,209,110,65,91,
+13,177,134,89,132,188,212,215,159,42,191,111,66,74,204,186,137,168,243,92,50,255,0,90,145,238,197,192,242,155,226,78,232,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,102,223,92,166,173,253,159,184,95,85,73,158,145,241,137,180,25,
+125,58,84,239,253,160,11,69,176,129,254,155,102,61,138,217,159,197,84,235,72,255,0,212,159,63,226,30,40,229,146,59,60,160,221,123,99,79,255,0,28,79,78,242,105,45,114,149,21,208,231,247,228,102,16,229,198,254,0,29,181,23,241,4,253,53,11,106,158,177,141,
+184,253,43,57,66,66,136,0,0,0,0,0,0,0,0,0,1,108,51,155,152,8,25,89,202,213,247,143,179,157,66,92,182,237,215,223,167,37,106,208,157,154,178,232,162,183,251,79,184,217,123,70,195,149,48,74,153,139,49,90,225,209,254,242,105,63,100,86,249,62,200,166,97,
+177,252,66,56,86,19,90,229,252,216,189,58,249,151,107,208,140,237,212,188,182,79,197,92,230,94,121,178,186,163,46,68,107,2,222,92,120,114,223,78,188,117,122,154,148,223,17,40,250,212,81,209,40,207,187,164,73,246,143,108,231,123,184,218,225,148,237,41,
+238,218,124,62,140,121,187,244,238,60,243,151,104,74,181,243,175,45,250,115,251,95,245,226,122,8,28,164,223,204,8,222,65,205,47,248,56,108,200,185,109,90,69,68,153,173,98,117,65,139,86,158,148,159,158,81,156,35,122,106,200,187,188,157,165,52,103,250,
+114,239,27,86,79,177,243,204,102,50,107,117,53,181,219,193,120,189,123,13,123,49,92,170,54,46,9,239,150,239,235,176,195,157,217,252,186,21,161,151,203,199,50,245,120,36,153,151,157,105,52,170,67,138,47,242,8,90,155,138,79,113,46,67,138,73,255,0,87,46,
+225,204,249,127,199,188,235,27,183,194,160,253,26,49,218,151,214,159,14,232,173,127,104,218,185,48,195,21,43,42,183,178,91,230,244,93,81,252,94,189,196,154,143,62,157,92,0,0,0,0,0,232,166,22,146,157,47,210,159,218,47,33,234,163,41,75,212,93,70,29,237,
+220,175,46,139,179,62,246,142,219,156,42,169,84,232,240,203,210,74,156,211,134,94,198,204,117,30,70,232,42,217,254,217,191,155,26,146,255,0,3,95,19,67,229,42,183,146,202,117,98,190,115,138,255,0,18,101,224,220,170,178,206,153,179,231,18,239,167,27,34,
+85,99,23,93,142,149,105,214,136,244,200,122,23,181,229,123,71,181,207,49,147,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,15,125,22,150,252,189,152,86,77,77,164,234,136,152,215,78,233,61,28,116,202,153,23,214,64,12,119,216,21,
+32,164,108,216,182,152,34,230,197,199,89,109,69,233,242,174,47,226,30,46,229,166,58,103,218,207,166,20,223,248,116,61,47,201,131,215,43,65,116,74,95,121,153,160,57,65,209,64,3,183,163,255,0,217,200,250,74,251,69,189,78,38,58,227,244,172,228,138,101,0,
+0,0,0,0,0,0,0,0,0,2,44,119,153,51,64,154,6,28,89,121,71,160,84,56,100,220,19,14,226,184,91,66,185,166,36,115,83,81,80,162,238,91,198,242,255,0,204,36,199,163,121,0,203,222,94,254,227,25,170,183,83,94,78,31,90,91,230,215,84,116,95,180,206,69,202,126,40,
+163,70,149,132,30,249,122,82,234,92,59,223,184,207,125,223,44,165,43,42,91,52,44,231,43,148,191,38,184,113,9,107,187,171,132,182,205,43,74,101,37,37,13,181,107,204,184,98,33,147,208,250,148,226,134,249,155,47,213,246,51,61,151,232,195,209,93,156,124,
+117,53,236,191,105,230,214,42,77,111,150,243,55,204,200,139,83,26,209,158,60,244,111,72,102,98,165,152,28,249,90,249,69,176,156,114,115,24,117,73,106,42,225,70,81,168,221,174,212,141,183,92,108,139,168,212,150,188,141,190,242,87,25,14,175,147,109,169,
+225,248,60,239,107,61,20,181,109,190,104,199,93,254,246,115,236,126,188,239,47,227,66,158,253,55,105,237,127,210,37,39,41,88,15,78,203,6,90,44,140,0,166,165,31,245,90,220,143,14,91,136,34,209,233,124,60,114,93,229,243,159,91,170,245,143,17,102,108,102,
+166,97,199,238,113,41,255,0,123,54,215,178,60,34,187,34,146,61,21,129,225,241,194,240,170,54,171,230,197,107,215,206,251,94,242,227,12,9,151,0,0,0,0,0,58,41,124,229,57,250,195,23,113,245,76,173,63,81,117,24,33,188,67,80,84,45,159,8,136,131,252,115,16,
+41,77,40,181,235,34,106,82,254,212,144,236,156,134,211,83,206,205,244,82,155,241,130,248,156,215,149,73,56,229,165,237,169,21,224,223,192,204,237,207,106,73,83,182,69,42,90,81,167,151,226,165,113,245,122,76,155,136,215,252,63,168,123,20,243,129,42,64,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,43,183,194,104,167,86,217,16,82,255,0,249,110,41,208,228,254,242,37,179,255,0,20,1,134,91,187,245,68,212,54,123,28,82,86,167,10,253,170,180,101,221,196,220,103,63,136,120,231,151,24,108,
+103,125,122,105,65,248,201,124,15,72,114,85,45,172,180,253,147,146,247,63,137,157,67,142,157,48,0,59,74,33,235,11,78,229,24,161,87,214,49,183,63,165,57,130,145,68,0,0,0,0,0,0,0,0,0,69,196,100,141,72,181,61,53,62,193,21,196,149,189,22,164,6,214,41,85,
+29,177,27,112,99,88,177,164,184,245,181,90,189,211,77,109,196,153,154,89,182,233,132,163,121,196,153,124,30,56,236,58,231,211,127,210,61,219,149,112,216,228,158,79,169,83,107,74,138,27,82,255,0,153,61,254,13,165,212,143,52,99,55,82,204,25,158,164,147,
+214,46,90,47,171,29,222,58,107,214,207,78,144,96,193,166,194,102,157,77,136,220,104,204,52,150,163,71,105,58,37,166,210,68,148,32,139,176,146,146,34,34,238,33,205,164,220,158,172,221,41,193,83,130,138,230,58,108,82,196,139,99,6,240,206,225,197,203,218,
+81,51,70,181,168,146,234,245,87,84,122,105,30,51,42,121,207,89,165,6,69,233,50,21,40,81,157,197,104,210,135,25,52,151,110,226,75,154,177,161,66,83,124,200,243,99,178,98,207,185,182,132,237,107,159,153,108,79,138,114,209,76,172,206,190,235,221,47,158,
+223,149,169,253,98,51,169,246,19,238,182,100,95,53,131,238,27,119,43,88,196,50,198,66,149,165,23,164,171,105,70,61,77,122,111,236,166,186,218,53,188,145,96,241,140,201,26,181,22,232,107,55,215,205,227,191,176,158,95,164,173,125,38,60,80,122,48,0,0,0,
+0,0,0,58,25,71,172,151,63,88,127,104,188,135,170,140,173,63,81,117,17,225,188,147,92,76,12,150,90,148,45,60,234,134,35,199,50,47,67,80,165,168,255,0,218,47,104,238,92,130,82,219,205,149,234,126,173,23,227,56,126,7,43,229,110,166,152,21,40,116,212,95,
+118,68,140,238,157,91,79,80,246,47,216,213,39,91,52,251,177,116,92,51,83,169,118,123,162,227,36,127,234,71,173,143,61,18,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,83,123,46,148,115,182,48,94,179,72,181,242,11,174,221,124,253,
+31,227,6,219,255,0,136,0,142,189,219,106,170,102,100,150,233,166,23,92,60,76,148,71,224,184,48,212,95,97,143,35,242,245,75,99,54,208,151,235,81,143,132,230,122,27,146,74,138,88,5,88,244,84,127,118,36,133,142,30,117,96,0,236,232,127,139,47,245,159,113,
+10,53,189,115,31,117,235,174,163,154,40,150,224,0,0,0,0,0,0,0,0,22,51,105,62,61,158,89,242,53,137,88,185,22,113,71,168,69,183,29,133,70,115,94,101,58,94,145,88,50,244,165,78,241,254,193,141,199,32,224,223,47,230,251,59,57,45,98,230,165,47,171,15,74,93,
+233,105,218,107,185,167,16,88,102,5,94,186,123,246,116,93,111,114,241,102,16,110,140,101,157,186,222,43,98,126,109,235,48,53,106,222,163,199,182,40,47,172,181,47,41,150,174,158,74,147,220,164,178,195,73,240,144,125,227,216,89,246,241,194,133,43,84,253,
+102,228,250,150,229,226,223,113,193,178,205,186,157,196,171,62,109,203,250,238,39,104,115,3,123,48,3,121,87,49,233,192,109,151,215,21,157,78,168,244,53,92,75,172,195,182,97,165,39,231,28,115,87,149,75,61,59,186,24,253,25,254,184,187,198,215,147,108,252,
+235,26,140,218,221,4,229,219,193,120,189,123,13,123,49,220,42,86,46,11,140,183,127,93,154,152,159,187,69,129,71,103,101,106,238,199,170,156,52,162,85,237,115,148,56,78,154,121,174,20,4,26,117,35,238,55,222,120,188,91,28,183,151,252,103,206,179,21,190,
+29,7,232,209,134,175,235,84,122,253,213,23,218,109,220,151,216,121,44,54,173,219,227,57,104,186,163,252,219,36,156,112,35,169,128,0,0,0,0,26,151,89,120,128,124,14,133,243,213,247,62,153,253,162,241,122,166,86,159,168,136,197,222,102,170,27,88,37,133,
+148,93,121,63,118,84,30,52,247,244,113,27,78,191,235,12,122,15,242,126,166,158,45,125,62,138,112,93,242,127,129,199,121,95,147,243,59,104,244,201,248,47,230,76,38,237,141,25,186,30,196,204,8,138,148,104,111,81,42,82,84,125,230,237,94,114,254,195,33,234,
+83,132,25,206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,31,121,202,219,102,225,216,137,141,156,101,231,65,141,69,150,223,46,214,235,80,126,227,48,4,75,238,207,212,212,238,92,241,38,134,103,202,61,241,25,226,255,0,57,8,136,255,
+0,221,16,242,183,47,244,210,199,108,231,211,73,174,233,255,0,51,189,242,69,81,252,159,113,31,166,159,124,87,224,73,96,224,7,97,0,14,206,135,206,42,204,191,41,247,10,53,184,162,194,235,215,93,71,52,81,45,128,0,0,0,0,0,0,0,0,34,199,121,191,48,42,162,97,
+134,31,101,146,147,52,210,237,122,168,245,195,89,109,10,47,197,227,36,216,142,74,46,229,58,235,202,241,100,187,135,163,127,39,220,17,85,196,46,241,105,173,208,138,167,30,185,122,82,238,73,46,211,145,114,163,136,236,208,163,101,23,235,61,167,212,183,46,
+246,223,113,32,59,191,57,105,60,180,108,184,195,248,181,42,127,147,85,239,134,222,187,171,4,109,240,168,206,105,145,198,35,35,231,169,68,110,55,95,81,153,141,235,53,222,121,230,55,81,167,186,30,138,236,227,227,169,175,224,22,222,111,135,197,190,50,223,
+223,252,180,51,84,107,134,116,243,233,189,83,153,201,184,205,157,43,67,40,86,83,235,148,206,30,81,80,185,177,35,159,17,185,89,169,244,110,116,122,23,90,147,29,49,82,93,198,226,136,117,108,149,105,11,60,46,165,229,77,202,92,239,245,99,207,223,175,113,
+160,102,43,137,87,189,141,24,111,217,247,191,235,196,147,92,154,96,36,92,175,229,98,195,192,70,90,66,94,182,173,184,241,170,38,223,83,147,84,93,36,165,250,223,91,166,60,79,154,241,153,102,28,199,117,136,190,21,38,218,250,188,34,187,34,145,232,108,2,193,
+97,152,69,27,127,213,138,215,175,159,196,185,195,93,51,32,0,0,0,0,6,165,214,94,32,31,2,159,123,227,150,127,158,127,104,187,143,4,101,163,234,162,44,55,156,164,105,104,96,228,68,153,249,213,90,218,253,141,195,47,188,122,55,242,124,95,233,88,132,190,141,
+47,124,206,47,203,3,252,213,162,246,207,221,18,111,55,126,225,21,63,99,102,95,99,145,105,197,97,161,223,223,146,250,255,0,136,122,112,225,166,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,36,222,53,134,169,219,20,241,242,58,19,
+169,149,179,13,221,61,8,170,67,89,253,128,8,104,221,149,125,42,194,140,89,141,175,52,92,148,165,159,174,52,130,251,135,151,127,40,21,254,178,176,151,208,159,222,137,221,121,33,223,109,117,245,163,238,100,159,15,60,157,156,0,59,58,25,233,21,101,250,79,
+184,133,26,190,178,49,247,75,211,93,71,52,81,45,192,0,0,0,0,0,0,0,17,26,143,66,45,76,249,17,119,152,18,183,162,212,129,44,243,189,87,218,107,182,189,140,6,179,165,42,68,7,239,8,22,53,41,214,85,169,51,18,51,188,19,31,47,205,37,249,91,186,151,97,15,113,
+114,111,134,199,42,242,117,74,173,69,164,231,23,90,93,115,223,21,246,118,81,230,252,215,119,242,206,104,156,98,247,38,160,186,163,199,199,83,211,77,2,131,70,181,232,80,173,155,118,18,35,83,169,208,218,137,79,142,217,104,150,152,105,4,219,104,34,236,34,
+66,82,94,161,161,206,114,169,55,41,113,102,219,74,154,165,77,71,160,87,235,180,91,90,133,54,231,184,166,166,53,58,155,13,217,117,9,43,228,150,163,180,131,113,197,25,247,18,18,163,245,4,33,42,147,81,143,23,184,133,106,138,149,55,39,204,121,152,200,20,
+74,190,210,157,181,79,227,229,233,21,114,161,57,119,84,47,170,171,79,167,136,154,97,135,120,225,178,125,154,19,138,136,217,23,114,116,27,223,41,120,154,202,220,157,85,163,77,233,57,197,81,143,92,183,73,253,149,38,106,153,74,205,227,57,158,18,146,221,
+22,230,251,56,120,232,79,95,63,148,122,159,105,247,143,15,30,144,91,144,2,32,0,0,0,0,6,165,214,94,32,31,2,158,116,244,113,103,222,103,246,139,205,52,70,90,62,169,20,123,206,143,233,27,6,99,107,214,245,113,90,105,232,132,67,210,95,147,218,244,177,23,255,
+0,43,247,206,37,203,11,254,198,190,191,238,147,187,176,162,55,146,236,129,203,195,93,90,225,133,57,127,188,74,87,222,61,44,113,35,44,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,28,111,2,37,43,216,217,152,36,175,67,47,192,53,158,
+135,222,82,88,50,0,66,46,236,131,170,252,18,198,54,190,73,85,168,166,69,233,232,166,16,243,31,229,6,151,157,97,239,232,212,247,192,238,124,143,107,228,110,250,225,238,145,41,163,206,103,105,0,14,206,135,202,50,203,244,159,113,10,53,189,100,99,238,191,
+73,216,115,69,18,220,0,0,0,0,0,0,0,11,127,154,172,109,131,151,12,182,223,56,235,57,105,34,181,173,137,115,227,161,71,241,146,18,217,165,132,120,169,229,54,159,88,206,101,188,38,120,246,61,109,135,199,251,217,198,47,171,95,73,246,71,86,98,113,171,248,
+225,152,93,107,151,243,98,223,111,50,237,123,136,180,221,87,203,220,204,98,207,117,223,154,59,181,149,203,107,15,173,135,86,204,215,211,196,103,87,169,173,76,165,124,93,70,174,128,166,43,191,206,35,30,223,206,183,16,180,194,105,218,211,220,164,210,211,
+232,197,112,247,30,116,203,212,101,113,136,58,210,230,223,218,255,0,166,122,19,28,160,232,38,27,109,242,204,35,185,117,217,95,137,245,138,116,227,98,165,117,67,98,212,165,169,43,225,81,174,160,231,70,247,9,245,234,81,83,36,249,119,13,139,42,217,187,204,
+110,146,107,116,125,39,217,195,199,67,5,143,92,121,12,62,90,113,123,187,255,0,145,29,187,176,248,24,154,110,28,226,70,100,42,17,12,156,171,213,99,91,180,167,22,157,52,102,58,10,68,142,19,238,53,188,193,31,234,198,143,249,66,99,30,82,254,207,11,139,221,
+8,186,146,235,147,217,143,114,140,187,204,255,0,37,182,26,81,175,121,37,197,168,174,205,239,222,187,137,83,30,113,58,240,0,0,0,0,0,0,106,93,101,226,1,240,41,243,208,212,163,244,159,218,47,23,3,47,30,4,70,239,58,84,146,171,175,7,40,232,94,166,213,54,183,
+33,73,211,177,78,196,73,31,246,21,236,30,156,252,159,41,191,54,196,39,211,42,107,185,77,252,78,19,202,252,211,185,180,143,58,83,253,211,208,94,198,106,20,155,111,101,22,93,169,51,27,225,117,56,61,65,90,210,125,156,112,208,231,241,15,70,28,104,201,160,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,135,27,192,196,233,236,108,204,15,66,157,85,248,8,190,90,118,121,75,26,253,90,128,33,27,118,65,104,252,14,198,52,106,92,94,235,209,140,203,209,209,76,30,99,252,160,211,243,172,63,234,212,
+247,192,238,124,143,63,204,221,245,195,221,34,83,7,156,206,210,0,29,165,16,191,155,40,255,0,72,127,97,10,21,125,99,29,113,250,67,152,41,20,0,0,0,104,103,212,64,1,232,93,103,167,136,3,225,79,178,142,183,146,94,42,33,29,25,20,164,249,141,14,92,79,254,41,
+178,253,178,13,151,208,60,157,78,134,71,166,242,6,60,51,99,100,158,147,131,212,170,130,124,174,254,187,89,110,67,72,115,154,161,66,79,148,57,234,233,142,49,14,229,200,62,12,239,51,101,75,217,175,70,133,54,215,214,159,162,191,195,180,115,94,83,175,39,
+107,131,66,223,122,117,37,225,29,239,199,66,253,110,189,229,217,56,63,179,77,140,82,159,78,54,106,88,157,116,204,172,45,199,18,68,165,66,142,126,69,24,190,142,173,62,178,253,110,189,163,176,231,91,181,113,140,121,36,247,83,73,118,189,239,222,187,141,
+11,45,91,249,43,55,81,173,242,126,4,142,141,60,217,136,71,222,241,204,137,27,248,77,148,122,84,210,50,66,101,221,213,230,18,174,122,168,206,28,61,75,193,51,21,207,231,16,233,57,6,207,72,213,186,107,162,43,222,254,6,145,154,110,54,170,66,138,235,127,15,
+137,148,155,39,176,49,57,119,217,249,134,150,20,216,196,197,70,101,8,171,85,116,40,203,136,165,78,81,201,82,85,233,74,28,109,31,177,160,242,119,41,88,195,199,115,181,229,196,94,177,82,216,143,213,135,163,187,173,166,251,78,221,147,240,233,97,185,122,
+133,54,180,109,109,62,185,111,240,215,67,35,6,134,109,35,67,46,178,0,0,0,0,0,0,8,244,61,68,87,16,83,230,90,153,159,164,197,217,152,92,8,99,222,94,170,45,252,203,225,221,15,139,84,198,176,29,120,139,184,220,156,249,31,212,217,15,86,242,3,79,76,191,119,
+83,166,170,93,208,143,226,121,239,149,201,63,150,104,71,232,107,223,39,248,30,158,114,35,66,69,171,146,60,29,181,219,108,146,154,110,22,91,209,73,36,93,93,29,50,58,126,225,222,206,78,93,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,137,219,115,160,123,163,178,23,49,12,26,56,184,112,178,166,238,159,65,4,189,127,179,168,2,7,119,98,167,146,255,0,150,122,114,85,212,170,19,196,159,71,243,228,234,60,215,249,66,65,235,135,75,254,106,255,0,198,118,222,71,164,181,188,143,212,253,242,
+87,199,154,206,222,12,200,186,192,28,218,68,232,140,68,62,145,242,215,164,62,69,207,184,82,169,9,57,22,53,233,84,157,93,200,222,93,114,57,114,105,165,171,210,124,132,170,147,37,86,179,124,89,176,186,228,157,125,237,148,167,210,122,152,153,82,69,85,105,
+14,118,109,174,169,80,87,193,127,79,4,145,9,246,34,84,86,244,151,49,180,185,50,85,240,164,40,255,0,108,196,116,143,65,81,83,166,184,35,224,205,71,214,163,63,17,18,125,200,0,0,8,72,222,4,197,58,174,57,103,182,222,203,197,152,149,77,118,210,162,197,166,
+177,17,147,226,53,212,234,14,37,229,36,180,249,70,149,197,71,137,15,94,114,31,132,199,12,202,53,47,234,45,29,121,185,107,244,33,232,175,29,166,121,195,149,28,65,222,230,40,218,195,122,165,20,191,106,91,223,134,201,232,151,44,88,41,74,203,118,93,44,92,
+191,209,80,146,143,102,90,80,40,196,164,245,45,108,48,132,56,191,21,56,75,81,250,84,48,183,215,50,188,188,169,93,252,230,223,123,46,236,104,171,123,88,83,92,201,21,214,134,102,73,73,106,163,61,18,93,230,45,75,166,210,90,179,204,182,208,235,145,237,164,
+219,121,234,214,13,46,95,150,81,92,196,8,118,132,3,73,234,148,83,105,198,150,100,173,61,233,62,138,83,191,182,99,170,78,238,57,87,33,213,188,123,165,10,114,159,237,75,213,241,113,70,137,70,222,88,222,102,133,186,225,41,168,246,47,91,195,86,77,236,118,
+35,198,105,44,68,105,45,180,132,146,89,109,37,161,33,4,90,37,37,232,34,208,189,67,194,146,148,165,45,100,245,124,231,172,161,29,136,40,174,99,112,140,203,224,168,203,192,196,9,183,51,237,50,164,35,154,95,89,105,249,198,26,71,160,149,211,166,248,163,113,
+186,148,244,115,242,131,63,164,68,98,71,78,4,142,222,147,230,55,17,91,147,242,208,218,187,207,168,75,228,162,82,118,144,230,108,223,69,117,163,228,236,117,23,113,165,90,136,58,47,77,204,145,218,201,112,102,242,42,176,86,69,239,218,107,243,203,65,35,167,
+36,82,116,42,174,99,125,14,182,225,113,54,226,85,244,79,81,46,141,50,140,148,147,209,163,160,23,107,129,153,92,8,72,222,73,152,110,103,98,214,136,103,201,140,51,141,161,119,113,76,154,99,215,60,130,71,76,165,93,244,214,151,220,129,231,78,86,100,222,98,
+166,191,225,175,189,35,213,198,93,160,149,51,0,172,122,110,154,121,61,161,76,107,78,238,24,141,23,220,59,121,203,138,204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,173,167,182,107,56,131,179,135,30,172,231,127,203,240,122,228,
+109,7,166,186,44,169,175,169,63,218,73,0,60,184,108,28,206,126,12,101,83,27,238,171,83,26,174,35,163,65,190,169,240,98,64,172,200,34,40,145,165,48,235,138,73,72,89,159,189,33,68,234,146,78,104,105,73,233,196,105,35,226,46,55,203,46,83,197,179,38,13,66,
+181,132,54,229,65,201,184,175,89,198,73,107,178,185,218,211,93,56,190,109,94,227,164,242,107,142,216,224,216,165,74,119,114,217,141,84,146,147,224,154,111,77,95,54,186,241,225,210,77,218,107,106,150,202,36,67,113,179,105,212,18,218,113,181,18,137,105,
+50,212,148,70,92,140,140,185,145,151,35,30,67,242,59,45,169,113,71,165,98,225,37,181,29,230,211,142,186,233,234,227,134,175,19,19,164,151,2,99,176,164,30,177,148,157,62,89,253,132,40,213,226,75,47,88,229,10,68,160,0,0,0,0,0,1,162,139,84,153,119,144,2,
+12,118,149,210,113,39,34,187,94,99,230,170,185,102,196,174,211,228,94,144,111,107,93,170,139,71,228,149,38,216,117,165,174,42,140,181,209,77,184,217,182,173,53,52,234,218,244,209,68,61,165,201,118,37,99,152,50,5,59,42,82,210,116,162,233,77,115,197,239,
+209,245,73,111,93,171,152,242,254,121,177,186,194,115,76,235,212,90,198,109,78,47,153,173,218,174,199,199,177,243,147,159,146,253,178,217,0,207,5,187,6,77,129,142,212,139,126,228,148,217,28,187,38,242,168,53,79,169,199,116,203,85,54,146,117,68,220,162,
+35,62,75,101,74,35,46,102,73,63,52,176,88,142,93,197,112,201,189,186,110,81,253,101,189,120,112,237,208,190,178,198,108,174,160,189,45,31,67,59,157,160,27,78,50,195,144,108,13,170,98,93,253,137,212,121,85,229,83,221,43,78,212,165,84,217,126,125,90,111,
+1,147,73,67,104,82,141,13,18,205,42,91,203,34,66,18,71,204,212,105,73,201,132,224,183,184,165,202,167,8,61,157,119,183,185,37,207,255,0,193,54,33,138,218,218,208,114,218,213,243,46,146,15,119,121,48,106,224,197,76,227,220,249,149,185,24,114,76,123,86,
+137,32,215,80,121,38,124,117,58,130,141,4,100,163,228,106,232,188,165,71,218,92,73,62,209,83,151,92,98,149,142,87,165,134,193,233,42,211,91,190,132,55,190,205,173,149,222,86,228,179,13,157,230,59,59,201,47,70,156,120,253,41,127,45,73,169,30,73,61,20,
+0,0,0,0,0,0,0,1,74,52,17,153,107,234,61,0,131,90,148,229,122,240,165,89,212,41,119,61,207,112,197,167,83,41,241,212,252,249,245,25,9,105,136,205,36,181,82,220,90,204,137,9,46,243,49,127,66,210,173,213,104,210,163,7,41,201,232,146,90,182,250,18,92,228,
+43,213,183,183,165,42,181,100,163,21,189,182,244,73,123,89,1,187,94,243,95,135,89,215,206,89,222,184,58,167,228,209,105,52,40,182,252,26,131,205,240,21,69,109,60,242,149,33,180,31,156,150,212,167,180,79,23,156,100,158,35,34,226,208,189,169,201,102,88,
+196,50,174,87,86,215,186,42,147,155,155,75,126,206,210,138,81,111,131,107,77,250,110,230,222,121,103,62,227,150,120,246,60,235,91,106,225,24,168,166,249,244,109,182,189,155,247,106,123,46,195,154,99,180,123,2,135,73,121,28,43,141,71,138,210,211,220,105,
+101,9,50,250,135,69,52,179,187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,174,57,88,229,137,184,51,118,225,193,245,87,237,138,133,52,255,0,207,198,113,175,227,0,120,154,201,142,74,175,220,237,99,13,87,2,48,254,227,167,82,238,40,
+118,228,202,149,61,170,177,173,44,76,118,50,155,37,70,55,18,71,209,26,146,165,25,44,200,211,170,72,143,66,62,34,213,243,118,106,179,201,248,108,47,238,96,229,77,206,48,150,207,24,169,107,233,104,248,232,214,245,174,189,29,15,49,130,224,245,241,203,183,
+111,70,73,79,101,181,175,7,166,155,189,156,75,219,133,249,201,218,65,178,58,251,107,6,49,106,214,169,149,22,50,143,130,202,188,208,183,33,184,214,165,171,144,36,164,207,129,61,202,97,106,111,83,230,147,49,168,98,89,83,33,114,155,103,231,246,83,143,148,
+127,222,83,209,75,94,138,145,221,171,246,73,41,116,52,109,24,110,101,205,89,38,186,182,172,155,130,249,147,222,180,250,50,230,236,109,107,197,18,23,149,93,183,217,51,204,83,145,237,219,206,184,246,28,220,47,153,36,160,93,110,167,200,221,89,233,201,169,
+169,209,190,179,208,186,82,104,207,210,56,126,99,228,135,53,224,73,213,161,21,113,73,115,211,215,105,47,108,56,253,157,163,174,224,124,165,101,252,85,170,117,165,228,102,249,167,234,246,75,135,126,134,105,219,179,98,79,166,34,124,9,77,63,29,253,22,196,
+150,92,37,182,234,76,185,26,84,147,50,81,122,72,199,36,175,9,66,166,204,150,141,113,79,138,55,237,184,84,74,81,122,166,118,2,137,16,0,0,0,0,0,0,0,45,254,99,178,195,129,249,177,195,199,112,191,29,236,72,245,186,90,215,210,199,53,234,137,16,158,211,66,
+122,59,201,209,108,184,69,203,84,158,134,92,148,74,46,67,57,128,230,44,99,44,223,171,188,58,171,132,248,62,117,37,209,37,193,174,190,28,86,143,121,135,197,176,92,59,28,182,116,47,32,165,30,110,148,250,83,226,159,245,192,141,12,125,221,165,185,219,168,
+189,81,203,30,97,32,72,134,181,25,179,72,190,34,45,151,89,46,239,41,140,133,165,207,19,105,3,191,96,188,191,80,116,212,113,107,70,165,250,212,154,105,254,204,154,107,237,51,144,226,124,146,92,41,185,88,87,77,116,79,115,93,177,79,95,178,138,87,8,119,107,
+243,19,82,186,90,44,112,198,171,70,135,67,74,210,114,23,110,174,68,249,142,163,94,105,66,92,105,166,210,102,92,184,148,163,34,235,225,62,161,147,196,249,124,192,41,219,191,147,237,170,78,166,155,182,246,99,20,253,173,57,55,212,150,254,148,89,216,114,
+77,139,212,172,188,234,180,35,14,125,157,100,252,82,93,187,250,137,91,203,102,90,176,131,41,184,77,79,193,156,20,182,138,157,70,128,70,181,173,197,241,200,154,250,180,227,144,251,154,17,184,234,180,45,85,161,17,17,18,82,73,73,17,23,155,113,252,193,138,
+102,108,78,119,215,243,218,156,187,20,87,52,98,185,146,254,109,182,219,59,86,17,131,216,224,118,49,181,180,142,145,93,237,244,183,206,223,255,0,27,138,248,97,12,192,0,0,0,0,0,0,52,51,50,73,17,153,159,81,17,115,48,32,218,75,121,138,121,211,219,1,148,108,
+156,181,50,219,145,116,38,242,188,89,74,146,139,78,216,144,135,84,203,157,210,164,115,106,49,107,214,147,226,112,191,38,99,164,229,62,75,179,62,106,113,170,161,228,104,63,239,38,180,213,125,8,241,151,177,238,143,210,52,92,193,159,112,76,9,58,123,94,82,
+170,249,177,230,127,73,240,94,255,0,97,22,215,254,61,109,21,219,71,138,137,194,219,6,219,150,253,17,167,210,235,118,165,4,212,197,30,150,142,47,54,68,215,214,122,41,68,95,210,60,163,61,117,38,208,90,240,143,70,89,96,185,23,146,108,59,206,238,102,149,
+70,180,242,146,223,82,79,245,97,21,195,170,43,235,62,115,140,226,24,214,104,207,151,158,66,9,236,126,164,119,65,123,100,249,223,181,246,37,192,160,113,75,38,85,44,170,109,2,181,178,159,116,93,49,110,10,139,53,235,113,186,172,200,49,212,134,13,233,135,
+25,213,180,223,31,156,164,39,165,224,37,40,146,106,211,94,20,235,161,109,217,75,50,83,205,184,36,49,58,84,220,33,57,77,69,61,239,72,201,197,55,166,228,222,154,232,181,211,134,172,214,241,204,38,120,37,252,173,39,45,169,69,45,90,225,171,90,238,234,241,
+232,61,178,163,159,180,254,209,178,152,131,232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,117,119,29,199,14,223,140,151,29,213,111,58,174,24,241,210,122,41,197,118,23,160,181,235,49,20,181,32,222,135,145,253,134,74,91,123,92,165,
+55,80,108,169,242,21,79,185,147,228,13,249,201,233,56,86,102,206,167,207,68,232,163,215,175,204,46,241,200,57,112,77,228,42,154,45,127,57,79,179,210,227,240,237,55,174,79,63,250,150,31,86,95,2,110,177,99,6,112,159,29,173,7,108,28,101,195,154,45,209,71,
+116,245,85,62,185,79,68,134,210,175,158,142,34,213,181,247,41,38,74,46,241,227,172,55,22,196,240,123,149,113,99,90,84,166,185,226,218,125,189,43,216,245,71,125,189,195,236,177,10,94,78,230,154,156,122,26,212,142,172,221,110,217,96,221,244,169,23,78,80,
+49,17,235,46,122,204,214,86,205,198,167,38,211,22,124,252,214,223,45,95,142,90,252,238,152,188,7,116,203,28,189,226,182,154,81,198,232,249,104,254,188,52,140,215,92,125,89,118,108,246,156,219,25,228,206,210,182,181,48,249,236,63,213,123,227,223,197,120,
+245,24,99,59,11,182,197,236,147,169,61,54,135,26,236,165,91,140,187,196,236,218,41,251,179,110,200,73,115,226,90,52,113,166,245,231,241,136,109,126,3,171,194,255,0,146,238,83,105,37,83,98,117,122,37,249,186,171,169,238,147,236,114,70,150,161,157,50,117,
+77,105,185,70,30,207,74,15,179,122,93,169,50,254,101,211,121,86,183,21,12,81,243,83,128,140,205,73,104,151,107,246,68,158,137,207,21,68,125,70,133,31,111,154,234,61,4,52,140,119,144,42,50,214,120,69,211,95,66,170,213,125,184,173,123,226,250,205,191,9,
+229,106,172,52,134,33,67,85,250,208,254,23,252,93,134,111,96,150,214,157,159,152,240,219,12,90,249,142,163,82,103,58,100,146,165,93,170,85,41,242,81,252,157,100,17,54,163,250,11,81,14,69,139,242,105,157,176,102,221,91,57,78,43,231,83,252,226,235,244,
+119,174,212,142,137,135,103,172,179,137,232,161,112,163,39,205,47,69,248,232,159,99,102,68,83,231,66,171,192,110,169,75,150,220,168,174,167,137,153,81,156,39,26,113,61,134,149,164,205,38,94,6,52,89,194,116,230,225,53,163,92,207,115,238,102,213,78,173,
+58,177,78,13,52,205,226,82,21,240,86,71,224,98,82,177,168,0,0,0,0,0,0,0,0,0,0,0,0,25,145,117,158,158,32,15,151,157,105,134,23,41,229,146,26,109,60,78,58,179,209,40,46,243,51,228,69,226,38,73,201,232,184,146,74,113,135,22,98,214,107,182,194,228,147,42,
+241,37,83,101,98,76,123,198,227,101,38,77,219,86,115,232,150,231,73,243,94,144,71,208,48,90,245,241,40,212,69,212,131,234,29,19,45,114,91,155,179,36,227,37,69,209,164,254,125,68,226,180,246,71,214,151,179,69,167,180,210,113,204,253,151,240,104,184,170,
+158,82,167,234,195,127,123,224,189,186,189,125,132,103,99,30,211,77,164,155,77,111,103,112,75,46,214,197,98,147,75,168,234,132,89,216,122,211,171,144,235,38,122,25,204,152,68,78,41,29,138,51,54,153,208,249,164,122,15,7,228,247,34,100,11,69,125,137,78,
+51,156,127,188,171,166,137,253,8,112,79,163,214,151,67,56,254,41,156,115,70,105,172,237,237,83,140,31,205,134,186,233,244,165,199,175,130,246,25,23,146,93,218,57,207,148,75,243,61,119,217,199,78,132,239,224,29,167,44,148,225,246,240,74,156,90,165,61,
+198,134,9,71,220,233,13,67,53,242,235,8,169,80,192,105,234,255,0,222,205,110,253,152,113,126,199,45,62,169,147,193,57,58,169,81,170,152,148,244,95,171,31,139,252,59,36,74,14,15,96,126,17,229,242,196,141,134,216,39,135,116,171,102,133,19,155,116,234,76,
+82,109,42,86,156,220,90,185,169,215,15,181,197,154,148,125,166,60,217,138,98,248,158,55,120,238,175,235,74,165,71,207,39,175,98,230,75,216,146,94,195,175,88,225,214,120,101,5,70,218,10,49,92,203,250,222,253,172,133,60,240,56,155,159,120,138,153,74,66,
+141,69,252,173,89,112,250,181,208,203,220,210,50,229,221,169,143,107,242,65,79,201,242,121,101,237,83,125,245,36,121,227,61,77,75,51,220,105,244,126,234,61,116,50,180,56,223,26,20,74,73,153,153,25,30,164,101,168,233,70,164,110,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,164,201,106,28,119,37,62,173,16,218,13,107,62,226,34,212,192,22,158,171,94,147,87,174,123,179,52,207,147,201,82,80,92,248,16,74,212,146,94,175,105,138,154,104,72,222,167,148,218,109,70,246,216,247,182,158,168,
+254,96,109,243,114,61,10,239,158,221,90,76,86,20,73,151,71,168,147,156,21,8,197,242,146,108,62,151,146,158,124,208,164,114,50,61,52,172,255,0,151,42,230,172,169,113,135,82,122,84,146,82,143,67,148,90,146,79,216,244,211,94,109,117,54,28,179,138,199,6,
+198,105,93,73,107,20,244,125,79,115,125,156,73,180,196,204,204,97,254,24,97,229,43,27,234,47,46,165,135,211,152,67,243,239,10,18,21,49,138,116,87,18,149,51,57,196,52,74,90,161,158,186,45,228,18,186,45,82,165,167,131,141,72,240,230,31,151,239,177,11,217,
+225,241,91,55,49,122,42,114,244,92,164,189,104,38,244,74,107,154,47,77,173,233,61,116,79,209,119,120,197,189,173,180,46,159,165,69,241,146,223,162,124,27,211,155,165,243,113,225,171,85,149,155,123,89,216,139,108,196,189,176,254,235,166,214,232,243,219,
+37,195,171,82,39,55,38,52,132,159,106,28,108,205,42,246,234,49,55,118,119,86,23,18,161,115,78,80,156,120,198,73,166,186,211,222,100,173,238,173,238,233,42,148,102,165,23,193,167,170,59,234,114,180,55,16,71,167,18,124,226,215,172,187,143,188,132,45,222,
+246,66,226,41,165,169,143,185,145,217,55,144,60,211,56,253,83,18,114,245,73,133,88,144,102,165,220,22,177,29,42,105,172,254,90,148,198,136,116,255,0,88,133,141,251,3,229,23,56,101,244,163,109,117,39,5,243,39,233,199,171,210,222,191,101,163,84,196,114,
+158,7,137,234,234,82,74,93,49,220,252,56,246,234,96,206,57,238,183,210,158,233,170,25,108,205,27,204,233,196,108,82,47,138,65,44,140,251,8,229,69,211,218,108,142,179,132,242,253,81,105,28,78,207,94,153,83,151,238,203,248,141,42,251,147,62,46,210,191,
+100,151,197,105,238,49,201,221,148,251,108,242,143,53,106,193,170,77,206,113,90,89,168,165,97,173,244,149,180,238,157,189,2,30,109,195,215,185,77,122,134,234,243,255,0,37,89,150,58,95,56,106,249,171,82,222,191,105,197,174,233,24,8,229,252,235,131,189,
+109,156,146,250,19,221,221,170,126,7,21,253,163,251,108,114,153,43,135,25,92,188,91,138,201,240,155,24,139,97,241,180,189,63,78,182,80,179,241,39,4,63,200,30,73,243,36,127,208,213,61,95,61,42,186,63,178,164,215,124,74,240,205,249,239,8,122,86,148,180,
+232,156,62,58,39,226,85,212,45,229,92,218,197,142,134,238,28,16,195,169,203,47,132,227,13,78,143,175,168,164,171,65,137,173,200,22,89,114,214,149,205,104,245,236,63,221,70,82,159,43,56,226,90,78,141,55,246,151,239,50,171,164,111,56,98,59,13,165,55,6,
+81,173,249,43,237,84,43,178,75,37,236,91,78,125,163,27,87,242,125,176,147,252,221,252,215,93,56,191,116,145,121,79,149,235,232,175,78,218,47,170,77,126,235,42,251,79,121,190,207,144,174,27,235,40,149,56,136,51,248,202,69,222,211,199,251,174,199,71,218,
+49,119,63,147,237,210,95,232,248,132,95,214,166,215,186,79,220,95,209,229,126,147,95,157,181,107,170,105,251,210,43,120,27,202,185,60,117,37,238,158,9,226,83,10,249,68,220,122,123,164,94,191,41,78,190,193,136,159,32,89,161,63,70,230,139,237,154,253,198,
+100,161,202,230,10,253,122,53,23,100,127,136,237,98,111,32,100,81,239,143,176,113,49,175,26,36,37,105,236,150,45,223,32,249,197,112,171,69,254,212,255,0,128,175,254,118,114,227,227,78,167,217,143,241,28,230,55,139,178,4,239,198,209,49,21,175,165,109,
+71,63,178,80,183,151,33,121,213,112,149,23,251,114,254,2,170,229,95,45,191,153,83,236,175,226,57,95,244,136,54,122,244,102,178,252,62,215,230,254,10,183,175,255,0,113,160,151,252,199,103,127,248,95,109,255,0,9,55,249,213,203,61,19,251,63,204,164,174,
+173,229,28,164,83,100,27,22,126,9,98,5,88,139,250,105,41,133,13,39,225,171,206,31,212,67,39,109,200,30,102,168,181,175,115,74,29,91,114,253,212,139,11,142,87,48,120,203,74,52,103,46,189,149,251,204,164,235,59,205,152,104,212,37,42,221,202,77,192,251,
+255,0,209,162,109,214,195,72,215,210,104,97,71,245,12,149,47,201,251,16,115,94,82,254,9,123,41,182,252,100,139,41,242,191,110,151,161,106,219,246,201,47,131,45,53,241,188,189,153,90,154,150,156,59,203,229,143,70,73,252,19,170,201,153,61,105,245,165,198,
+82,127,186,54,91,62,64,112,10,90,121,205,221,89,253,85,24,47,116,159,137,131,184,229,111,24,150,190,70,132,35,215,172,189,206,37,8,246,214,109,177,57,158,145,238,94,13,174,174,142,149,90,28,92,58,176,9,197,248,19,157,19,206,23,143,25,12,220,57,51,228,
+183,0,91,119,170,47,78,122,181,116,240,214,43,192,196,212,206,249,219,21,244,104,73,173,121,161,15,142,146,126,38,243,219,63,54,234,103,22,66,41,248,169,64,196,71,169,210,116,233,23,136,55,127,145,67,104,187,205,135,158,35,245,37,179,63,64,154,57,187,
+146,60,173,29,171,55,69,73,127,186,167,181,39,251,74,62,249,22,245,48,172,241,141,61,155,135,81,175,167,45,18,236,215,224,100,206,86,119,97,40,180,233,49,238,44,226,227,159,186,36,142,21,174,216,177,27,83,77,40,250,205,46,77,125,4,163,46,195,38,218,73,
+247,44,134,141,143,242,245,86,113,116,240,107,109,159,167,83,123,236,132,94,157,242,125,70,193,134,114,109,163,82,191,171,175,209,143,226,254,9,117,146,103,128,89,108,192,172,175,88,205,97,206,1,97,133,38,215,164,54,69,210,177,78,143,163,146,84,69,167,
+72,251,170,213,199,215,249,206,41,70,56,78,49,142,226,249,130,237,220,226,21,165,82,126,215,185,123,34,184,69,123,18,72,232,246,24,93,142,25,73,82,182,166,162,189,159,23,197,191,107,42,11,238,254,179,112,214,216,126,238,191,110,72,148,154,107,42,75,103,
+42,99,188,36,183,86,124,40,105,5,214,227,171,81,146,80,218,8,214,181,25,18,82,102,122,11,43,91,59,171,250,222,70,222,14,82,105,238,93,11,139,124,201,37,189,183,162,75,123,101,205,123,170,22,145,219,171,45,23,245,226,249,132,103,142,108,86,222,76,119,
+91,83,200,73,165,167,145,194,180,154,139,224,168,187,21,207,67,46,195,24,119,29,153,53,175,14,142,29,134,82,53,20,160,164,65,126,24,213,109,252,192,239,40,91,149,171,118,106,235,212,201,121,137,134,228,105,52,182,141,210,121,152,146,81,231,167,189,180,
+148,115,51,95,87,2,13,69,169,15,160,92,158,217,86,195,242,77,133,10,176,113,146,167,22,211,226,155,223,191,191,135,49,229,204,207,94,23,56,229,205,72,61,83,147,209,245,110,248,30,171,240,174,228,121,75,85,191,45,206,36,169,38,228,115,51,234,62,181,39,
+195,183,218,55,38,185,204,10,101,116,37,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,187,201,14,187,107,79,67,36,124,94,76,163,229,220,93,127,80,138,226,65,240,45,57,158,167,168,156,144,193,45,183,59,25,44,237,168,216,91,22,240,177,
+37,195,161,98,245,163,5,198,237,90,212,163,224,141,85,140,102,107,58,100,197,17,106,148,26,204,212,211,220,250,21,173,90,145,161,106,210,13,106,136,167,161,11,153,40,218,55,154,109,145,184,163,83,202,94,107,112,194,180,253,169,77,169,45,138,245,145,89,
+107,163,168,80,156,89,249,238,194,55,15,129,72,89,31,25,180,102,108,188,71,196,133,39,136,214,124,159,148,46,75,240,236,227,23,121,109,37,70,237,45,210,249,179,211,130,158,155,247,115,73,111,94,212,146,55,124,177,156,46,176,41,121,26,171,110,131,227,
+30,117,175,234,254,28,31,177,153,130,254,78,104,56,203,111,200,206,134,195,108,218,46,201,159,81,119,202,42,246,68,41,230,213,18,92,147,46,37,50,244,69,146,138,3,231,249,39,155,83,71,203,135,163,73,241,31,29,89,166,182,21,93,96,89,254,195,203,198,59,
+163,85,173,106,37,193,53,53,166,220,126,148,100,165,211,171,220,111,79,6,133,237,55,136,229,155,159,38,222,247,13,125,22,250,28,121,159,177,173,61,139,137,76,88,27,123,115,33,149,75,233,56,47,180,207,40,245,10,117,82,63,152,253,110,221,96,162,72,113,
+4,122,116,201,140,233,155,18,82,125,124,108,58,148,31,97,12,181,126,71,48,12,126,213,223,229,91,245,40,63,155,55,180,151,179,105,122,81,126,201,197,190,146,206,158,125,197,112,218,138,219,24,183,106,75,157,110,111,219,163,220,250,211,208,207,188,177,
+109,6,201,230,112,105,236,201,192,140,114,163,84,167,186,157,87,111,76,124,162,85,25,62,210,84,71,184,92,61,62,114,9,73,62,197,24,228,152,254,76,204,185,106,163,87,246,210,140,87,206,94,148,31,84,150,171,177,232,253,134,237,134,102,28,35,22,138,243,122,
+169,191,213,123,165,220,247,252,11,206,122,37,92,42,35,37,118,164,203,67,26,185,155,77,62,6,134,73,81,115,73,31,136,17,14,182,151,216,84,119,139,141,165,150,138,105,126,114,20,94,148,159,35,17,139,113,122,174,36,142,17,151,20,82,21,156,189,96,5,198,250,
+164,92,88,19,101,79,113,127,13,201,182,148,23,84,175,19,83,70,102,50,84,177,172,98,130,210,157,205,72,245,78,107,226,89,75,12,195,166,245,149,40,190,180,138,58,191,179,219,33,215,67,202,145,93,201,166,24,72,113,95,9,207,192,152,104,81,250,208,217,12,
+157,28,231,155,173,214,148,239,235,47,250,146,248,178,214,174,93,192,234,191,74,218,31,101,126,5,29,116,236,129,217,157,120,178,108,85,114,111,104,199,212,180,226,164,183,34,10,139,215,29,212,12,157,191,41,89,234,217,235,11,249,191,173,164,190,242,101,
+165,76,161,151,106,250,214,241,236,221,238,208,160,42,27,191,91,45,38,186,110,51,129,85,120,186,252,152,183,181,68,136,188,56,221,80,204,195,150,60,255,0,5,163,185,139,235,167,15,130,70,62,121,3,45,201,234,169,181,251,82,252,78,181,253,221,221,152,207,
+124,12,62,187,90,253,93,237,35,248,146,98,180,57,105,207,107,141,88,63,250,113,41,62,79,178,255,0,234,191,180,255,0,19,135,35,119,47,102,171,255,0,23,64,190,26,250,23,145,159,251,76,152,168,185,108,207,43,140,169,191,250,127,204,149,242,121,129,63,214,
+251,76,226,255,0,209,187,217,190,78,116,156,24,132,101,243,14,239,70,135,255,0,150,212,84,255,0,61,249,223,79,238,191,237,191,226,36,255,0,55,88,15,76,251,255,0,145,87,90,59,2,118,93,90,218,42,86,2,207,173,56,69,205,218,221,221,61,195,63,217,105,198,
+211,245,12,117,207,44,57,250,227,133,202,135,213,167,15,138,111,196,188,163,144,178,229,45,242,164,229,215,41,126,37,99,71,216,219,179,18,135,37,50,161,228,234,216,113,105,61,72,166,201,155,33,62,180,184,250,136,253,100,49,117,57,77,207,149,99,179,43,
+249,246,40,175,21,29,75,184,228,220,183,7,170,183,94,47,222,203,181,135,249,79,202,238,20,178,150,112,207,46,22,37,4,147,212,170,93,167,13,165,254,249,55,196,126,209,174,222,102,60,127,17,122,221,93,213,159,214,156,159,134,186,25,74,24,54,23,108,146,
+165,70,49,234,138,69,125,13,148,199,96,162,83,154,232,219,73,124,84,116,240,164,191,101,60,134,30,77,201,235,46,62,211,33,179,78,11,130,44,206,97,118,133,228,171,42,232,125,56,221,152,187,102,149,57,132,153,185,69,139,55,203,106,58,247,121,44,98,91,164,
+127,72,136,189,35,104,193,114,94,104,204,13,121,141,172,229,23,243,154,217,135,218,150,139,185,152,124,67,49,96,216,102,190,94,178,77,115,113,125,203,86,97,214,46,111,57,229,50,215,113,112,240,127,4,239,91,185,212,23,189,201,168,46,61,38,51,135,217,161,
+168,222,112,253,104,35,29,51,13,228,27,49,92,104,239,46,41,210,93,11,89,191,221,94,38,161,119,202,86,29,77,233,111,74,83,235,210,43,226,252,14,22,28,109,18,219,79,158,20,160,242,175,146,91,103,15,232,18,249,38,242,189,81,37,108,50,131,249,104,114,81,
+182,135,180,253,27,14,120,10,215,217,43,146,236,169,175,202,216,140,235,212,95,221,211,217,213,251,26,142,173,126,212,226,81,161,152,51,142,52,180,179,182,84,226,254,116,181,221,212,222,154,246,38,94,235,111,7,240,203,37,109,49,155,221,168,25,202,110,
+247,191,96,176,181,81,234,247,52,146,143,77,162,41,73,50,91,116,90,90,11,155,198,70,105,233,144,223,74,101,201,36,217,26,181,212,238,49,43,252,212,165,131,229,107,15,35,111,47,90,48,223,57,244,58,213,31,205,231,217,114,217,79,139,123,180,204,82,180,180,
+193,218,190,198,174,124,165,69,195,95,86,61,59,17,92,254,212,181,125,230,4,237,8,219,219,137,121,148,143,39,47,89,37,182,106,214,253,10,178,191,115,228,87,150,209,157,110,176,78,31,7,65,29,182,141,94,74,135,53,225,209,38,167,150,71,166,168,212,210,125,
+103,34,114,39,105,131,86,133,254,55,37,86,180,119,198,11,125,56,190,102,219,223,54,186,148,83,230,123,153,167,230,94,80,174,49,24,74,218,193,56,83,123,156,159,172,250,186,23,143,81,157,123,186,91,15,175,204,155,78,115,59,25,186,183,138,155,136,21,58,
+83,144,236,235,62,66,72,223,183,98,62,157,30,147,43,177,18,221,71,189,147,69,205,150,212,190,51,37,175,133,29,253,45,14,100,222,164,193,216,40,113,87,124,34,104,186,148,163,86,157,220,7,168,62,4,23,18,234,9,9,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,15,151,27,67,168,54,150,146,52,168,180,81,25,117,144,2,213,93,182,212,139,110,166,166,13,6,113,220,51,56,238,119,167,187,196,191,254,196,233,234,72,214,135,84,34,64,198,237,162,251,43,178,157,180,215,15,83,107,227,205,168,113,46,26,
+116,117,34,218,191,40,168,67,117,90,65,158,166,72,37,153,105,33,141,121,156,119,117,65,234,102,147,66,188,241,6,181,34,158,132,15,230,51,100,70,214,221,142,152,137,51,26,114,251,58,187,95,182,97,164,205,24,129,134,141,184,243,103,24,140,207,134,163,7,
+69,45,148,151,90,146,234,28,103,185,197,117,140,70,51,129,97,24,253,163,182,196,104,70,172,58,36,184,62,148,248,197,251,83,76,191,176,196,175,48,218,234,181,173,71,9,123,57,250,215,6,189,140,168,112,191,111,46,21,99,213,148,140,21,218,147,149,26,61,243,
+68,81,112,123,191,64,128,217,60,210,143,151,75,228,174,41,61,27,157,166,228,119,90,81,118,36,113,91,206,70,239,240,59,231,127,149,47,165,70,127,169,54,244,126,205,164,158,171,217,56,203,172,223,232,231,187,124,70,221,91,99,54,234,164,127,89,45,253,122,
+62,127,106,107,216,142,35,219,39,50,37,156,89,106,187,182,95,231,230,145,26,170,181,230,172,197,100,146,163,117,52,151,4,222,210,238,150,166,143,91,4,194,174,30,179,162,187,22,158,237,25,111,107,59,42,242,113,84,53,28,43,66,177,77,53,30,191,204,110,7,
+140,139,192,157,227,25,186,92,163,230,152,122,213,35,46,184,47,134,134,58,166,82,194,36,253,24,181,212,223,197,179,10,113,231,119,103,38,88,135,139,181,235,145,88,165,136,212,233,18,230,241,56,219,21,24,46,32,143,132,139,145,46,46,189,157,227,5,121,203,
+150,105,177,186,157,47,33,74,73,62,120,205,126,249,147,161,201,190,15,115,66,51,85,42,38,253,177,254,18,223,84,55,96,112,14,74,184,168,57,168,188,163,35,177,50,168,48,222,50,245,165,104,251,4,180,255,0,40,76,102,43,243,150,52,223,84,164,189,233,135,201,
+101,171,126,141,196,151,90,79,240,58,185,91,174,86,10,191,17,206,93,109,29,221,45,150,202,190,201,68,46,99,249,68,94,47,91,14,143,253,199,252,4,143,146,170,75,133,211,251,63,204,165,171,91,173,247,26,31,82,237,252,232,211,221,70,190,105,78,177,157,65,
+233,233,52,74,80,200,210,252,162,40,105,249,204,57,174,170,169,251,224,139,58,188,149,215,79,208,186,79,174,63,254,199,74,246,235,206,50,151,226,217,177,180,148,95,164,183,102,39,236,51,23,75,242,134,194,159,27,26,159,110,63,129,65,242,93,127,205,94,
+63,101,254,39,25,253,215,220,194,37,63,205,243,61,98,47,187,164,165,207,79,240,24,169,31,202,19,3,124,108,170,253,168,126,37,63,243,93,138,115,86,143,115,56,146,119,97,115,70,142,113,243,23,135,107,238,227,98,122,127,224,24,168,191,40,60,186,248,218,
+86,239,135,241,7,201,118,47,254,250,30,63,129,205,182,55,95,241,230,99,188,55,158,104,172,184,13,235,240,169,148,121,146,215,167,130,201,146,250,197,43,143,202,19,6,135,232,44,170,73,253,41,70,62,237,162,106,124,150,226,58,233,82,188,87,82,111,223,161,
+115,109,237,215,156,54,101,148,21,215,156,10,244,149,153,123,231,185,214,123,12,164,252,58,73,11,208,96,43,126,80,215,237,191,37,135,197,117,212,111,221,20,101,41,242,87,65,47,74,229,190,168,165,241,101,204,195,173,219,44,135,218,174,166,77,237,120,98,
+5,210,191,148,204,154,187,16,153,63,217,142,201,47,251,99,94,190,229,239,56,220,45,45,233,210,165,213,23,39,254,41,105,224,101,45,185,49,193,41,45,106,206,114,125,105,47,4,159,137,136,27,118,114,193,146,76,150,210,172,28,21,203,102,14,70,162,220,149,
+149,73,172,87,42,142,86,37,203,146,152,45,251,195,45,25,190,234,200,146,227,166,242,143,66,35,247,130,231,167,33,212,185,28,204,57,187,53,213,186,191,197,110,28,233,67,72,70,59,49,138,218,126,148,159,163,21,193,104,184,252,227,75,207,152,94,9,130,249,
+27,91,58,91,51,122,202,79,86,222,156,23,22,248,189,123,137,110,216,17,147,139,127,43,123,56,44,42,197,102,210,130,213,219,123,176,187,170,181,80,118,156,130,148,130,153,162,162,179,210,41,60,105,36,69,75,30,110,164,68,165,172,244,230,98,235,53,98,51,
+190,197,234,70,47,209,135,162,183,238,221,199,199,82,92,10,202,20,44,163,57,47,73,239,239,254,70,111,155,166,233,234,226,141,103,222,179,212,254,177,172,25,229,21,24,232,136,30,222,211,205,83,151,126,55,225,238,76,237,185,198,228,107,78,150,171,134,224,
+142,209,234,74,168,77,46,142,51,102,69,242,145,25,6,162,254,181,233,29,71,33,217,42,86,181,47,37,243,158,139,169,113,125,254,227,69,204,215,46,173,204,104,174,111,127,245,239,51,187,103,62,91,91,202,110,75,236,28,21,126,34,90,169,66,162,34,101,193,161,
+115,58,140,175,127,145,169,246,240,173,125,31,131,100,60,113,158,241,231,116,241,48,250,252,117,108,77,142,189,117,36,54,230,137,146,68,147,228,71,209,59,250,195,235,23,107,148,76,219,150,161,228,115,78,25,39,5,185,213,165,163,139,93,45,111,134,255,0,
+173,31,170,91,255,0,147,24,54,42,246,240,123,180,165,250,146,220,215,83,245,188,31,89,218,183,99,239,32,228,77,9,141,67,155,120,221,148,10,114,125,237,152,210,35,221,49,86,217,124,146,105,222,57,8,78,157,132,148,153,16,183,119,92,136,230,231,172,213,
+58,85,37,210,165,70,90,245,173,34,251,217,82,52,243,246,11,234,185,78,43,163,73,173,58,183,201,120,29,133,15,121,67,57,56,82,104,183,243,23,148,43,118,77,65,149,112,186,100,138,133,17,245,105,215,196,219,164,234,73,94,9,34,244,10,21,185,13,203,24,143,
+231,48,219,233,168,191,169,81,119,173,151,226,85,135,40,120,205,175,161,117,110,181,93,113,126,58,151,62,200,222,149,193,89,164,132,226,70,83,238,154,106,180,46,145,84,43,146,44,226,35,244,37,214,217,51,246,140,5,223,32,24,164,117,243,107,232,75,235,
+66,81,247,57,25,74,60,166,219,53,249,219,118,186,154,126,253,11,155,107,239,42,108,246,173,173,40,174,91,216,147,68,215,173,201,150,204,119,146,159,244,50,84,127,80,192,215,228,55,57,82,245,39,74,125,83,107,223,4,101,41,242,143,129,79,140,102,186,210,
+248,54,87,180,221,190,219,44,42,8,74,156,204,60,216,170,50,230,220,187,46,166,147,79,143,11,10,47,172,98,106,114,61,159,224,247,90,167,213,82,159,198,72,189,134,125,203,114,91,234,181,251,50,252,10,142,131,182,191,101,205,196,231,69,15,55,84,102,21,255,
+0,212,105,21,24,197,237,114,49,16,176,173,201,102,126,162,181,118,50,125,82,131,247,72,186,142,116,203,83,225,112,187,164,189,233,21,44,61,171,27,55,167,104,108,231,87,15,147,175,95,77,90,54,255,0,219,73,11,25,114,123,157,225,199,15,171,246,117,247,50,
+178,205,185,127,255,0,236,71,189,29,140,125,165,251,60,229,124,86,118,176,195,246,175,8,201,251,84,66,139,200,153,206,47,126,31,91,254,220,191,2,170,204,216,4,184,92,195,237,47,196,250,153,180,171,103,180,4,146,228,231,99,11,200,143,230,94,81,86,126,
+196,40,196,35,145,115,156,222,236,62,183,253,185,47,122,35,44,203,128,69,111,185,135,218,95,137,211,85,182,178,108,217,162,180,110,205,206,141,136,178,46,178,137,82,92,131,246,52,218,140,197,213,62,78,115,205,87,164,112,250,157,169,47,123,69,9,102,236,
+189,30,55,17,239,212,182,119,206,240,22,204,43,53,199,24,167,227,29,102,225,113,179,208,211,64,180,101,173,39,224,183,210,210,79,218,51,214,156,142,103,203,173,54,168,70,154,250,83,143,186,46,76,198,220,103,236,187,69,233,26,142,93,81,127,20,139,5,139,
+187,209,152,51,71,91,145,112,55,44,23,21,112,201,70,150,230,93,53,150,41,173,159,231,116,108,165,245,25,122,13,68,99,111,195,121,1,196,234,37,43,251,200,67,217,8,185,190,247,178,188,25,129,187,229,50,222,58,171,106,13,253,102,151,187,82,205,43,110,86,
+215,28,211,84,14,141,149,44,185,192,134,219,138,224,105,86,149,143,42,178,251,103,222,167,159,55,26,47,30,2,33,180,46,74,57,57,203,241,219,197,174,219,127,78,164,105,174,197,29,31,139,49,31,229,166,107,196,222,150,116,190,204,92,159,107,123,188,13,101,
+100,155,120,119,59,6,81,113,195,19,171,182,245,42,65,249,241,238,123,205,170,92,101,36,250,245,131,79,213,71,203,176,218,16,142,106,228,99,42,239,177,163,26,147,92,240,166,230,254,221,77,223,226,37,249,31,61,226,255,0,167,155,140,95,76,182,87,116,127,
+2,180,179,55,116,50,243,129,244,162,191,51,231,157,200,84,232,108,104,236,200,180,183,24,165,71,208,185,153,28,185,202,53,175,95,205,104,140,251,6,50,239,150,188,107,22,169,230,248,6,28,229,39,185,57,107,55,246,97,185,118,201,162,238,142,66,176,179,130,
+171,137,93,36,189,154,37,222,245,247,34,175,166,231,95,96,6,207,86,77,220,185,97,124,91,218,229,134,157,26,168,81,104,46,84,165,41,125,254,232,212,184,80,217,25,243,51,103,212,93,131,25,60,173,203,22,116,122,98,85,157,26,79,154,82,80,142,159,242,233,
+234,223,237,119,151,113,198,50,62,4,181,180,167,229,38,185,210,109,235,245,165,240,101,139,204,54,242,30,111,241,170,98,236,140,174,97,101,54,199,42,130,252,158,28,182,210,170,205,101,102,163,209,36,209,173,4,210,20,125,132,150,84,100,125,71,218,55,28,
+7,144,172,191,97,40,212,196,106,202,188,151,205,245,33,220,155,147,251,75,168,194,226,60,162,98,119,41,194,210,10,146,124,254,179,252,60,25,191,150,61,222,61,169,251,67,46,6,177,179,53,215,44,203,2,155,86,81,60,253,127,19,228,200,151,91,148,210,185,241,
+53,0,207,166,34,231,200,158,83,9,238,228,59,61,150,31,101,135,91,170,22,148,163,78,11,130,138,73,119,35,66,184,186,184,186,170,234,86,155,148,159,59,122,191,18,102,182,115,236,86,201,30,205,168,113,238,12,47,179,23,114,95,137,104,211,39,17,174,166,144,
+245,68,140,203,206,40,168,34,232,224,160,245,50,209,162,233,12,185,41,197,139,196,180,45,181,102,92,8,144,43,220,51,181,93,128,202,171,179,219,52,186,242,56,88,66,139,154,81,222,126,147,251,60,68,178,100,209,69,94,37,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,37,90,145,2,183,17,80,42,44,146,219,87,181,39,222,71,216,96,11,121,115,88,21,90,9,170,76,84,42,84,82,231,210,33,62,114,11,243,139,239,46,94,2,116,211,36,107,67,161,17,32,106,133,45,181,146,219,90,146,162,234,82,79,67,
+47,89,0,49,51,57,251,17,246,112,103,158,76,187,143,21,176,10,45,22,232,150,74,53,222,86,51,165,73,168,45,102,90,116,142,147,105,54,36,171,210,243,75,51,239,16,209,17,213,145,103,154,157,209,44,199,216,179,93,185,114,93,152,90,21,233,13,183,58,72,212,
+75,181,62,227,85,26,34,230,148,161,244,241,198,117,90,252,163,83,62,4,37,112,77,104,201,148,244,122,152,255,0,90,193,125,227,125,159,16,10,181,58,219,198,202,117,30,18,249,61,18,81,220,84,182,146,93,170,75,106,146,210,81,161,118,145,16,212,241,44,139,
+148,113,100,252,230,198,155,111,157,69,69,253,168,232,252,76,205,174,98,198,172,244,242,87,18,209,115,55,170,238,122,163,149,109,111,32,103,114,138,95,131,120,229,131,216,117,121,55,31,222,229,55,90,183,93,139,33,70,93,100,162,67,156,4,127,230,139,192,
+104,87,92,135,101,121,73,206,206,181,106,47,232,201,52,187,214,191,226,54,74,60,160,98,202,27,21,233,194,107,218,154,247,61,60,10,141,123,109,178,1,138,172,36,179,17,178,26,204,150,233,252,100,202,63,144,45,71,222,105,53,195,109,101,225,199,235,24,245,
+201,94,113,195,222,184,118,59,81,46,137,109,175,116,218,240,46,158,113,192,238,97,165,214,31,22,250,86,143,222,147,241,62,106,89,207,221,214,191,162,28,123,163,103,117,231,69,90,254,18,232,237,147,70,147,244,41,138,146,126,207,80,140,50,207,45,54,111,
+90,88,173,57,253,109,255,0,122,147,31,43,228,42,240,252,229,156,147,246,110,247,73,20,252,90,198,237,85,206,249,169,251,91,28,109,196,153,242,73,188,183,18,94,199,30,49,119,42,124,185,91,173,211,183,169,220,190,17,45,148,178,5,71,194,164,123,255,0,22,
+105,85,195,77,219,42,211,60,20,220,200,227,77,17,93,233,166,58,239,212,168,42,17,167,127,203,133,39,233,218,91,207,246,146,255,0,238,32,232,100,25,240,173,85,119,255,0,11,58,115,203,190,239,35,250,156,125,160,56,190,193,159,81,61,104,45,95,101,60,92,
+252,181,203,50,255,0,248,186,15,246,215,255,0,148,160,236,114,59,123,174,234,47,217,127,192,125,183,149,61,223,169,156,163,237,44,196,102,117,255,0,226,44,135,127,254,9,8,60,195,203,20,120,225,20,159,85,69,255,0,228,38,88,102,73,124,47,101,246,95,240,
+28,103,114,195,176,6,159,43,161,149,180,139,18,229,36,190,84,59,1,210,47,105,195,63,176,84,88,247,44,51,142,177,194,104,174,186,171,248,201,37,135,100,184,61,60,242,111,170,47,248,14,76,76,13,221,216,162,173,47,79,206,214,52,213,203,172,217,139,108,155,
+58,250,57,192,45,61,162,156,241,110,90,106,173,35,135,91,199,174,122,255,0,247,9,227,103,145,161,235,92,212,125,75,255,0,208,237,220,188,247,109,48,230,39,75,15,9,113,154,255,0,144,223,192,68,201,142,199,75,135,226,82,35,145,23,168,91,171,94,92,47,167,
+163,175,111,65,62,132,158,159,225,153,89,86,200,22,235,95,39,82,167,127,227,19,226,30,214,141,156,184,17,32,159,202,134,200,235,89,19,17,241,21,187,238,168,137,143,54,125,134,68,166,222,81,126,203,169,241,19,79,147,172,237,140,45,49,108,114,123,60,241,
+167,29,149,224,226,187,226,200,71,51,224,54,91,236,236,35,175,76,158,191,9,63,19,110,179,188,95,180,82,250,90,109,76,30,176,172,91,117,10,46,24,144,109,187,77,217,142,164,187,146,151,157,113,62,196,10,182,188,135,228,250,82,219,184,157,90,178,231,218,
+154,90,253,148,159,137,45,110,80,113,185,45,41,70,16,94,197,248,191,129,183,6,231,222,64,206,203,71,75,181,237,204,117,151,6,95,34,85,14,218,114,129,9,73,62,195,121,182,163,163,135,210,107,208,109,246,28,155,228,140,54,74,84,172,96,218,231,146,115,127,
+227,114,48,151,89,171,31,188,215,202,92,73,107,209,164,126,238,133,113,133,219,173,123,86,177,230,174,197,209,143,247,93,161,102,121,81,235,58,77,219,119,174,171,80,65,119,155,113,9,254,37,122,20,226,124,70,227,66,218,141,181,61,138,80,81,138,230,73,
+37,220,140,13,74,211,171,45,169,182,223,183,127,188,205,220,186,238,138,100,174,194,84,90,174,100,113,214,246,196,57,109,17,28,138,125,37,13,80,233,238,31,105,31,15,77,32,203,193,196,31,128,172,162,145,79,105,146,31,150,108,136,228,227,39,20,212,83,242,
+199,150,219,74,207,113,45,146,23,83,166,210,210,186,131,196,69,214,228,199,184,228,44,252,92,245,9,137,75,179,218,102,125,102,122,153,159,105,128,55,34,67,151,57,244,197,135,25,110,186,175,130,132,39,83,0,87,22,150,27,55,9,105,168,215,248,28,121,39,170,
+35,151,52,160,251,207,231,31,213,226,37,114,38,72,172,4,164,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,69,94,176,168,21,181,41,211,96,227,188,175,233,152,61,53,63,73,117,31,218,34,155,68,52,69,37,86,195,43,134,158,102,184,
+60,19,27,46,163,108,248,87,251,167,247,24,155,105,16,113,58,9,81,100,194,123,161,153,29,198,86,93,105,117,6,147,250,196,73,79,128,6,173,45,108,47,165,97,106,109,127,61,10,52,159,180,128,20,182,33,96,126,10,98,228,71,33,98,182,13,218,55,59,47,17,147,168,
+184,173,136,115,184,136,250,245,55,155,81,253,96,12,125,191,182,30,236,148,196,130,112,171,249,11,177,34,169,221,120,156,160,51,38,150,162,244,151,146,60,218,75,212,66,26,34,58,178,211,86,119,97,54,61,85,30,83,176,112,70,236,166,17,159,197,211,177,18,
+119,9,120,116,221,33,253,97,162,26,178,149,185,183,80,246,85,87,91,224,164,63,138,84,101,124,232,119,179,47,125,79,68,80,108,162,59,76,164,166,110,131,108,236,121,102,113,49,239,25,88,35,234,47,117,41,107,211,219,8,131,101,13,166,117,239,110,124,100,
+53,70,103,23,51,120,190,223,119,25,210,151,255,0,44,66,27,40,109,51,133,39,115,195,38,42,87,243,44,219,226,147,127,173,165,83,28,251,18,144,217,67,105,155,209,119,61,50,58,150,139,203,115,81,139,46,185,218,166,162,210,219,47,97,178,175,180,54,80,218,
+103,58,6,232,6,207,184,252,234,57,137,198,57,39,175,82,37,210,154,35,46,239,197,20,35,178,134,211,46,5,149,186,165,178,130,216,83,107,175,210,241,34,227,225,248,72,170,223,4,202,28,241,40,177,218,61,60,12,131,101,16,213,151,235,9,246,34,108,157,193,133,
+52,245,161,145,107,34,83,237,104,104,147,115,50,253,101,100,101,212,127,207,157,117,58,250,120,67,68,53,102,72,217,152,121,135,248,113,9,20,236,58,176,104,86,244,118,147,163,76,80,104,177,225,37,5,220,68,194,19,160,137,3,186,121,215,100,30,178,94,91,
+167,222,234,205,71,245,128,62,64,3,50,46,179,0,115,105,150,229,118,176,101,238,117,45,215,18,127,210,26,120,83,251,199,200,53,208,105,169,83,209,176,153,195,50,118,189,63,66,252,140,111,189,71,247,23,172,75,180,76,162,85,148,186,37,46,136,199,65,76,132,
+134,139,229,26,75,154,188,79,172,196,164,199,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,212,168,113,102,55,209,76,138,219,168,249,174,32,148,95,88,3,165,157,134,246,180,205,77,16,213,29,71,242,163,172,203,234,61,
+72,71,86,67,68,116,243,112,135,145,170,159,90,240,75,237,125,229,253,194,59,68,54,78,174,78,24,221,44,25,244,45,48,249,23,228,222,208,253,138,208,71,84,67,70,117,242,45,27,158,46,189,53,6,78,133,214,104,111,136,191,179,168,142,168,104,206,27,208,166,
+199,229,34,19,200,250,109,40,190,210,2,6,201,169,36,122,26,139,218,0,113,36,250,148,94,208,6,160,0,1,169,23,89,128,52,227,71,206,47,104,3,84,145,175,224,17,171,232,150,160,14,75,20,106,196,191,197,169,50,151,175,87,12,117,127,112,106,136,232,206,116,
+91,14,238,147,205,20,87,17,233,117,105,79,218,98,26,161,163,59,24,152,79,95,119,67,151,50,51,37,218,68,102,179,250,136,132,54,145,29,150,118,240,112,142,146,214,138,168,84,95,120,254,106,8,144,95,121,253,97,180,54,78,230,159,102,219,116,205,14,37,33,
+174,34,249,110,23,26,189,170,212,67,86,71,68,118,132,68,69,161,16,129,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,105,200,81,30,248,216,141,43,233,54,70,0,217,93,10,136,225,121,244,104,167,227,
+29,63,220,35,171,33,162,54,213,107,91,106,61,78,133,19,255,0,14,159,238,13,89,29,17,167,224,165,181,255,0,200,162,127,225,211,253,193,171,26,35,237,54,213,188,143,131,67,137,255,0,135,79,247,6,172,104,141,198,232,244,150,249,181,76,142,159,162,194,75,
+238,13,88,209,27,200,101,166,139,70,154,74,126,138,72,132,1,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,28,7,144,172,191,97,40,212,196,106,202,188,151,205,245,33,220,155,147,251,75,168,194,226,60,162,98,119,41,194,210,10,146,124,254,179,252,
+60,25,191,150,61,222,61,169,251,67,46,6,177,179,53,215,44,203,2,155,86,81,60,253,127,19,228,200,151,91,148,210,185,241,53,0,207,166,34,231,200,158,83,9,238,228,59,61,150,31,101,135,91,170,22,148,163,78,11,130,138,73,119,35,66,184,186,184,186,170,234,
+86,155,148,159,59,122,191,18,102,182,115,236,86,201,30,205,168,113,238,12,47,179,23,114,95,137,104,211,39,17,174,166,144,245,68,140,203,206,40,168,34,232,224,160,245,50,209,162,233,12,185,41,197,139,196,180,45,181,102,92,8,144,43,220,51,181,93,128,202,
+171,179,219,52,186,242,56,88,66,139,154,81,222,126,147,251,60,68,178,100,209,69,94,37,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,37,90,145,2,183,17,80,42,44,146,219,87,181,39,222,71,216,96,11,121,115,88,21,90,9,170,76,84,42,84,
+82,231,210,33,62,114,11,243,139,239,46,94,2,116,211,36,107,67,161,17,32,106,133,45,181,146,219,90,146,162,234,82,79,67,47,89,0,49,51,57,251,17,246,112,103,158,76,187,143,21,176,10,45,22,232,150,74,53,222,86,51,165,73,168,45,102,90,116,142,147,105,54,
+36,171,210,243,75,51,239,16,209,17,213,145,103,154,157,209,44,199,216,179,93,185,114,93,152,90,21,233,13,183,58,72,212,75,181,62,227,85,26,34,230,148,161,244,241,198,117,90,252,163,83,62,4,37,112,77,104,201,148,244,122,152,255,0,90,193,125,227,125,159,
+16,10,181,58,219,198,202,117,30,18,249,61,18,81,220,84,182,146,93,170,75,106,146,210,81,161,118,145,16,212,241,44,139,148,113,100,252,230,198,155,111,157,69,69,253,168,232,252,76,205,174,98,198,172,244,242,87,18,209,115,55,170,238,122,163,149,109,111,
+32,103,114,138,95,131,120,229,131,216,117,121,55,31,222,229,55,90,183,93,139,33,70,93,100,162,67,156,4,127,230,139,192,104,87,92,135,101,121,73,206,206,181,106,47,232,201,52,187,214,191,226,54,74,60,160,98,202,27,21,233,194,107,218,154,247,61,60,10,141,
+123,109,178,1,138,172,36,179,17,178,26,204,150,233,252,100,202,63,144,45,71,222,105,53,195,109,101,225,199,235,24,245,201,94,113,195,222,184,118,59,81,46,137,109,175,116,218,240,46,158,113,192,238,97,165,214,31,22,250,86,143,222,147,241,62,106,89,207,
+221,214,191,162,28,123,163,103,117,231,69,90,254,18,232,237,147,70,147,244,41,138,146,126,207,80,140,50,207,45,54,111,90,88,173,57,253,109,255,0,122,147,31,43,228,42,240,252,229,156,147,246,110,247,73,20,252,90,198,237,85,206,249,169,251,91,28,109,196,
+153,242,73,188,183,18,94,199,30,49,119,42,124,185,91,173,211,183,169,220,190,17,45,148,178,5,71,194,164,123,255,0,22,105,85,195,77,219,42,211,60,20,220,200,227,77,17,93,233,166,58,239,212,168,42,17,167,127,203,133,39,233,218,91,207,246,146,255,0,238,
+32,232,100,25,240,173,85,119,255,0,11,58,115,203,190,239,35,250,156,125,160,56,190,193,159,81,61,104,45,95,101,60,92,252,181,203,50,255,0,248,186,15,246,215,255,0,148,160,236,114,59,123,174,234,47,217,127,192,125,183,149,61,223,169,156,163,237,44,196,
+102,117,255,0,226,44,135,127,254,9,8,60,195,203,20,120,225,20,159,85,69,255,0,228,38,88,102,73,124,47,101,246,95,240,28,103,114,195,176,6,159,43,161,149,180,139,18,229,36,190,84,59,1,210,47,105,195,63,176,84,88,247,44,51,142,177,194,104,174,186,171,248,
+201,37,135,100,184,61,60,242,111,170,47,248,14,76,76,13,221,216,162,173,47,79,206,214,52,213,203,172,217,139,108,155,58,250,57,192,45,61,162,156,241,110,90,106,173,35,135,91,199,174,122,255,0,247,9,227,103,145,161,235,92,212,125,75,255,0,208,237,220,
+188,247,109,48,230,39,75,15,9,113,154,255,0,144,223,192,68,201,142,199,75,135,226,82,35,145,23,168,91,171,94,92,47,167,163,175,111,65,62,132,158,159,225,153,89,86,200,22,235,95,39,82,167,127,227,19,226,30,214,141,156,184,17,32,159,202,134,200,235,89,
+19,17,241,21,187,238,168,137,143,54,125,134,68,166,222,81,126,203,169,241,19,79,147,172,237,140,45,49,108,114,123,60,241,167,29,149,224,226,187,226,200,71,51,224,54,91,236,236,35,175,76,158,191,9,63,19,110,179,188,95,180,82,250,90,109,76,30,176,172,91,
+117,10,46,24,144,109,187,77,217,142,164,187,146,151,157,113,62,196,10,182,188,135,228,250,82,219,184,157,90,178,231,218,154,90,253,148,159,137,45,110,80,113,185,45,41,70,16,94,197,248,191,129,183,6,231,222,64,206,203,71,75,181,237,204,117,151,6,95,34,
+85,14,218,114,129,9,73,62,195,121,182,163,163,135,210,107,208,109,246,28,155,228,140,54,74,84,172,96,218,231,146,115,127,227,114,48,151,89,171,31,188,215,202,92,73,107,209,164,126,238,133,113,133,219,173,123,86,177,230,174,197,209,143,247,93,161,102,
+121,81,235,58,77,219,119,10,35,49,217,135,194,156,169,96,149,199,152,12,106,186,35,82,173,219,102,150,236,201,143,63,41,150,151,33,73,73,154,35,51,211,45,9,114,67,170,34,109,166,248,136,220,113,105,73,115,50,0,89,153,187,91,178,145,43,1,113,43,49,88,
+109,81,171,98,5,11,10,230,147,23,59,56,115,228,117,169,29,23,144,34,106,165,160,163,73,82,19,21,40,83,173,155,238,173,180,116,145,31,45,77,40,37,168,10,159,19,246,128,97,126,29,89,56,113,112,209,240,214,249,188,43,184,175,73,42,157,151,97,217,244,118,
+36,214,36,196,40,205,73,125,247,18,227,237,199,101,182,80,251,36,226,214,241,36,148,234,18,147,81,168,181,3,133,136,251,68,108,139,6,224,182,236,26,62,94,241,98,236,187,171,214,155,87,53,66,203,181,173,70,157,169,219,180,183,22,109,165,250,139,111,72,
+105,12,153,186,151,27,38,144,183,29,90,153,112,144,133,112,234,0,219,191,182,149,224,134,29,227,172,204,16,171,216,215,180,132,81,174,10,13,6,235,188,33,209,153,85,30,222,170,86,73,147,166,195,150,181,62,151,201,110,249,68,127,57,166,92,109,179,125,190,
+145,104,212,244,3,130,141,164,140,67,204,181,171,150,11,183,37,88,217,64,170,94,149,137,208,173,234,229,86,153,68,58,116,134,162,32,215,34,105,155,53,87,31,76,84,35,129,70,225,179,169,116,173,164,210,75,90,82,96,117,216,125,181,199,46,24,135,65,171,93,
+241,108,75,246,153,69,143,135,117,171,230,215,172,213,232,145,218,143,119,80,169,74,74,102,74,167,26,100,169,90,164,220,107,70,228,148,117,168,158,66,137,60,38,106,32,57,52,45,168,118,84,140,9,147,152,91,255,0,42,248,197,101,209,94,114,136,197,165,18,
+228,161,211,23,54,237,149,86,116,154,133,22,154,204,58,132,131,91,171,90,154,35,39,141,146,79,76,131,51,208,150,105,3,183,162,237,21,179,238,172,54,168,93,246,110,91,177,114,179,114,209,47,3,182,46,60,51,167,90,209,213,94,163,84,60,152,165,23,149,18,
+165,20,70,152,84,117,54,234,100,28,158,133,100,235,105,66,212,181,18,64,23,31,43,249,148,195,108,220,224,141,31,31,48,156,234,40,163,214,23,37,146,139,88,132,113,166,67,147,26,67,145,164,70,125,163,51,224,117,183,153,113,181,17,25,145,154,117,73,169,
+38,70,96,87,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,178,123,68,48,79,19,179,23,148,139,163,5,240,146,224,168,211,234,183,9,197,130,249,211,74,7,19,208,93,146,219,82,208,163,156,218,
+219,36,20,117,186,179,208,137,195,232,244,65,234,122,24,24,237,118,101,147,56,184,95,179,127,28,240,114,151,102,93,248,187,126,99,21,114,248,166,69,166,191,83,182,41,203,166,196,168,42,167,22,13,81,215,83,228,108,41,14,199,40,47,58,209,41,110,33,82,120,
+16,218,18,133,33,0,81,120,141,146,236,123,197,91,95,47,184,195,138,153,0,147,121,43,15,176,202,163,97,222,248,45,90,190,233,44,190,241,45,152,62,75,83,105,246,229,156,39,154,39,161,25,155,107,119,141,4,227,78,37,6,235,73,34,2,219,222,219,36,179,121,66,
+176,224,198,188,48,90,38,51,221,151,38,93,41,150,99,87,3,183,242,33,170,192,186,96,174,103,146,213,56,228,184,133,72,101,134,230,32,147,33,148,185,37,42,138,178,74,9,47,171,80,43,124,92,217,231,157,42,246,103,63,148,130,195,153,23,13,244,197,237,101,
+77,181,241,158,53,219,6,53,1,138,61,41,152,105,148,205,102,142,227,132,244,249,68,234,106,78,180,247,64,251,132,185,44,27,111,199,38,73,36,6,86,91,248,35,141,245,141,163,152,151,152,203,146,222,102,21,18,157,132,84,123,87,9,235,18,165,50,243,78,62,244,
+153,147,42,139,54,16,225,186,222,143,34,158,149,154,210,142,145,45,32,146,106,36,25,144,24,137,149,61,158,217,175,193,251,145,234,204,156,159,180,68,254,12,92,22,246,46,208,174,204,72,128,253,19,16,171,19,158,101,213,123,136,136,253,50,168,113,100,59,
+229,78,58,223,67,21,163,75,140,160,216,226,108,157,32,42,28,57,200,46,32,71,131,140,183,83,251,56,138,215,195,219,142,151,108,179,109,101,226,153,137,240,225,203,151,88,167,204,91,207,215,227,205,133,32,227,83,37,37,10,107,162,54,223,66,222,84,82,55,
+22,209,171,80,7,113,131,89,76,204,254,10,96,150,43,92,210,242,161,118,212,230,99,109,248,204,138,181,137,109,227,225,199,185,237,218,52,74,115,17,34,188,170,219,242,75,203,38,186,228,99,114,65,148,210,46,25,28,36,183,72,148,131,3,34,118,89,96,94,51,101,
+183,37,86,206,12,227,133,2,155,71,169,82,38,212,125,204,162,83,222,142,250,233,180,199,38,188,236,72,242,159,140,132,51,42,90,90,90,122,105,8,79,190,184,106,89,154,212,165,45,64,100,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,217,0,0 };
+
+const char* juice_jpeg = (const char*) temp_binary_data_0;
+
+
+const char* getNamedResource (const char* resourceNameUTF8, int& numBytes)
+{
+    unsigned int hash = 0;
+
+    if (resourceNameUTF8 != nullptr)
+        while (*resourceNameUTF8 != 0)
+            hash = 31 * hash + (unsigned int) *resourceNameUTF8++;
+
+    switch (hash)
+    {
+        case 0xabd9f3e7:  numBytes = 57266; return juice_jpeg;
+        default: break;
+    }
+
+    numBytes = 0;
+    return nullptr;
+}
+
+const char* namedResourceList[] =
+{
+    "juice_jpeg"
+};
+
+const char* originalFilenames[] =
+{
+    "juice.jpeg"
+};
+
+const char* getNamedResourceOriginalFilename (const char* resourceNameUTF8)
+{
+    for (unsigned int i = 0; i < (sizeof (namedResourceList) / sizeof (namedResourceList[0])); ++i)
+    {
+        if (namedResourceList[i] == resourceNameUTF8)
+            return originalFilenames[i];
+    }
+
+    return nullptr;
+}
+
+}
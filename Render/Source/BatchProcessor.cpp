@@ -0,0 +1,267 @@
+/*
+  ==============================================================================
+
+    BatchProcessor.cpp
+    Offline processing of a whole directory of audio files with fixed settings.
+
+  ==============================================================================
+*/
+
+#include "BatchProcessor.h"
+#include "../../Source/PluginProcessor.h"
+
+// defined by the plugin sources, the same entry point a host would use
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+namespace
+{
+    // a very long ring-out is cut here; hiss and crackle, which never end, stop with the ring-out
+    constexpr double maxDefaultTailSeconds = 5.0;
+
+    struct FileResult
+    {
+        juce::String error;             // empty when the file went through
+        double audioSeconds = 0.0;
+        bool finished = false;          // false if the run stopped before a worker got to it
+    };
+
+    /** The files still to do, shared by every worker; each claims the next one with a single atomic increment. */
+    struct FileQueue
+    {
+        juce::Array<juce::File> files;
+        std::vector<FileResult> results;        // one per file, written only by the worker that claimed it
+        std::atomic<int> nextFile { 0 };
+        std::atomic<int> numFinished { 0 };
+    };
+
+    //==============================================================================
+    class BatchWorker : public juce::ThreadPoolJob
+    {
+    public:
+        BatchWorker (std::unique_ptr<LofijuicerAudioProcessor> processorToUse, FileQueue& queueToDrain,
+                     const BatchSettings& settingsToUse)
+            : juce::ThreadPoolJob ("batch worker"), processor (std::move (processorToUse)),
+              queue (queueToDrain), settings (settingsToUse)
+        {
+            formats.registerBasicFormats();
+        }
+
+        JobStatus runJob() override
+        {
+            for (int index = queue.nextFile++; index < queue.files.size(); index = queue.nextFile++)
+            {
+                if (shouldExit())
+                    break;
+
+                queue.results[(size_t) index] = processFile (queue.files.getReference (index));
+                ++queue.numFinished;
+            }
+
+            return jobHasFinished;
+        }
+
+    private:
+        FileResult processFile (const juce::File& input)
+        {
+            FileResult result;
+            result.finished = true;
+            std::unique_ptr<juce::AudioFormatReader> reader (formats.createReaderFor (input));
+
+            if (reader == nullptr)
+            {
+                result.error = "can't read";
+                return result;
+            }
+
+            const int numChannels = (int) reader->numChannels;
+            const double sampleRate = reader->sampleRate;
+            const int blockSize = settings.blockSize;
+
+            // a fresh start for every file, so the output doesn't depend on which worker took it
+            processor->releaseResources();
+
+            if (settings.state.getSize() > 0)
+                processor->setStateInformation (settings.state.getData(), (int) settings.state.getSize());
+
+            processor->setPlayConfigDetails (numChannels, numChannels, sampleRate, blockSize);
+            processor->prepareToPlay (sampleRate, blockSize);
+
+            const auto relativePath = input.getRelativePathFrom (settings.inputDirectory);
+            const auto output = settings.outputDirectory.getChildFile (relativePath).withFileExtension ("wav");
+            output.getParentDirectory().createDirectory();
+            output.deleteFile();
+
+            std::unique_ptr<juce::FileOutputStream> stream (output.createOutputStream());
+            juce::WavAudioFormat wav;
+            std::unique_ptr<juce::AudioFormatWriter> writer;
+
+            if (stream != nullptr)
+                writer.reset (wav.createWriterFor (stream.get(), sampleRate, (unsigned int) numChannels,
+                                                   settings.bitsPerSample, {}, 0));
+
+            if (writer == nullptr)
+            {
+                result.error = "can't write " + output.getFullPathName();
+                return result;
+            }
+
+            stream.release();   // the writer owns it now
+
+            // run on past the end for the tail, and drop the first samples so the output lines up with the input
+            const double tailSeconds = settings.tailSeconds >= 0.0 ? settings.tailSeconds : getDefaultTailSeconds();
+            const juce::int64 inputLength = reader->lengthInSamples;
+            const juce::int64 outputLength = inputLength + (juce::int64) std::ceil (tailSeconds * sampleRate);
+            const int latency = processor->getLatencySamples();
+
+            juce::AudioBuffer<float> buffer (numChannels, blockSize);
+            juce::MidiBuffer midi;
+
+            for (juce::int64 position = 0; position < outputLength + latency; position += blockSize)
+            {
+                if (shouldExit())
+                {
+                    result.error = "cancelled";
+                    return result;
+                }
+
+                const int numSamples = (int) juce::jmin ((juce::int64) blockSize, outputLength + latency - position);
+                const int numToRead = (int) juce::jlimit ((juce::int64) 0, (juce::int64) numSamples, inputLength - position);
+
+                buffer.clear();
+
+                if (numToRead > 0)
+                    reader->read (&buffer, 0, numToRead, position, true, true);
+
+                juce::AudioBuffer<float> block (buffer.getArrayOfWritePointers(), numChannels, numSamples);
+                processor->processBlock (block, midi);
+
+                const int skip = (int) juce::jlimit ((juce::int64) 0, (juce::int64) numSamples, latency - position);
+
+                if (numSamples > skip && ! writer->writeFromAudioSampleBuffer (block, skip, numSamples - skip))
+                {
+                    result.error = "write failed";
+                    return result;
+                }
+            }
+
+            result.audioSeconds = (double) inputLength / sampleRate;
+            return result;
+        }
+
+        double getDefaultTailSeconds() const
+        {
+            // the filter and chorus ring-out alone: the latency is compensated for separately,
+            // and the endless noise is left out of what decides the length
+            return juce::jmin (processor->getChainTailSeconds(), maxDefaultTailSeconds);
+        }
+
+        std::unique_ptr<LofijuicerAudioProcessor> processor;
+        FileQueue& queue;
+        const BatchSettings& settings;
+        juce::AudioFormatManager formats;       // one per worker, nothing shared while reading
+
+        JUCE_DECLARE_NON_COPYABLE (BatchWorker)
+    };
+
+    /** A processor set up for offline work: no realtime deadline, parameters fixed for
+        the whole file, so every block goes through in one piece. */
+    std::unique_ptr<LofijuicerAudioProcessor> createOfflineProcessor()
+    {
+        std::unique_ptr<juce::AudioProcessor> plugin (createPluginFilter());
+        auto* juicer = dynamic_cast<LofijuicerAudioProcessor*> (plugin.get());
+
+        if (juicer == nullptr)
+            return {};
+
+        plugin.release();
+        juicer->setNonRealtime (true);
+        juicer->setMaxSubBlockSize (0);
+        return std::unique_ptr<LofijuicerAudioProcessor> (juicer);
+    }
+}
+
+//==============================================================================
+int runBatch (const BatchSettings& settings)
+{
+    if (! settings.inputDirectory.isDirectory())
+    {
+        std::printf ("%s isn't a directory\n", settings.inputDirectory.getFullPathName().toRawUTF8());
+        return 1;
+    }
+
+    juce::AudioFormatManager formats;
+    formats.registerBasicFormats();
+
+    FileQueue queue;
+    queue.files = settings.inputDirectory.findChildFiles (juce::File::findFiles, settings.recursive,
+                                                          formats.getWildcardForAllFormats());
+    queue.files.sort();
+    queue.results.resize ((size_t) queue.files.size());
+
+    if (queue.files.isEmpty())
+    {
+        std::printf ("no audio files in %s\n", settings.inputDirectory.getFullPathName().toRawUTF8());
+        return 0;
+    }
+
+    const int numThreads = juce::jlimit (1, queue.files.size(),
+                                         settings.numThreads > 0 ? settings.numThreads : juce::SystemStats::getNumCpus());
+
+    std::printf ("%d files, %d threads, %d-sample blocks\n", queue.files.size(), numThreads, settings.blockSize);
+
+    const auto startTime = juce::Time::getMillisecondCounterHiRes();
+
+    // the instances are made and destroyed here on the message thread, as a host would,
+    // and only lent to the pool's threads for processing
+    std::vector<std::unique_ptr<BatchWorker>> workers;
+
+    for (int worker = 0; worker < numThreads; ++worker)
+        if (auto processor = createOfflineProcessor())
+            workers.push_back (std::make_unique<BatchWorker> (std::move (processor), queue, settings));
+
+    {
+        juce::ThreadPool pool (numThreads);
+
+        for (auto& worker : workers)
+            pool.addJob (worker.get(), false);
+
+        int reported = -1;
+
+        while (pool.getNumJobs() > 0)
+        {
+            const int finished = queue.numFinished.load();
+
+            if (finished != reported)
+            {
+                std::printf ("\r%d / %d", finished, queue.files.size());
+                std::fflush (stdout);
+                reported = finished;
+            }
+
+            juce::Thread::sleep (200);
+        }
+    }
+
+    const double wallSeconds = (juce::Time::getMillisecondCounterHiRes() - startTime) / 1000.0;
+    double audioSeconds = 0.0;
+    int numFailed = 0;
+
+    std::printf ("\r%d / %d\n", queue.numFinished.load(), queue.files.size());
+
+    for (int index = 0; index < queue.files.size(); ++index)
+    {
+        const auto& result = queue.results[(size_t) index];
+        audioSeconds += result.audioSeconds;
+
+        if (! result.finished || result.error.isNotEmpty())
+        {
+            const auto error = result.finished ? result.error : juce::String ("not processed");
+            std::printf ("FAILED %s: %s\n", queue.files[index].getFullPathName().toRawUTF8(), error.toRawUTF8());
+            ++numFailed;
+        }
+    }
+
+    std::printf ("%.1f s of audio in %.1f s, %.1fx realtime, %d failed\n",
+                 audioSeconds, wallSeconds, wallSeconds > 0.0 ? audioSeconds / wallSeconds : 0.0, numFailed);
+    return numFailed;
+}
@@ -0,0 +1,33 @@
+/*
+  ==============================================================================
+
+    BatchProcessor.h
+    Offline processing of a whole directory of audio files with fixed settings.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/** Settings for a batch run. */
+struct BatchSettings
+{
+    juce::File inputDirectory;
+    juce::File outputDirectory;         // mirrors the input's layout, every file written as WAV
+    juce::MemoryBlock state;            // getStateInformation() data to load, defaults if empty
+    bool recursive = false;             // include subdirectories
+    int numThreads = 0;                 // 0 = one per CPU core
+    int blockSize = 8192;
+    int bitsPerSample = 24;             // 16, 24, or 32 for float
+    double tailSeconds = -1.0;          // rendered past the end of each file, the effect's own tail when negative
+};
+
+/** Processes every readable audio file in the input directory on a ThreadPool. Each worker
+    owns one plugin instance, prepared for each file's sample rate and channel count, and
+    takes the next unclaimed file until none are left. The output is compensated for the
+    processor's latency. Prints progress and a summary, and returns the number of files
+    that failed. */
+int runBatch (const BatchSettings& settings);
@@ -0,0 +1,259 @@
+/*
+  ==============================================================================
+
+    Benchmark.cpp
+    Offline processBlock timing for LofijuicerAudioProcessor.
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+#include "../../Source/PluginProcessor.h"
+
+// defined by the plugin sources, the same entry point a host would use
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+namespace
+{
+    /** Accumulates the cost of one stage across a run. */
+    struct StageClock
+    {
+        juce::int64 totalTicks = 0;
+        juce::int64 worstTicks = 0;
+
+        void add (juce::int64 ticks)
+        {
+            totalTicks += ticks;
+            worstTicks = juce::jmax (worstTicks, ticks);
+        }
+
+        StageTiming toTiming (const juce::String& name, juce::int64 numSamples, int numChannels,
+                              double sampleRate, int blockSize) const
+        {
+            const double seconds = juce::Time::highResolutionTicksToSeconds (totalTicks);
+            const double worstSeconds = juce::Time::highResolutionTicksToSeconds (worstTicks);
+
+            StageTiming timing;
+            timing.stage = name;
+            timing.nsPerSample = seconds * 1.0e9 / (double) (numSamples * numChannels);
+            timing.realtimeFactor = seconds > 0.0 ? ((double) numSamples / sampleRate) / seconds : 0.0;
+            timing.worstBlockUs = worstSeconds * 1.0e6;
+            timing.worstBlockLoad = worstSeconds / ((double) blockSize / sampleRate);
+            return timing;
+        }
+    };
+
+    std::unique_ptr<LofijuicerAudioProcessor> createPrepared (double sampleRate, int blockSize, bool doublePrecision,
+                                                              const BenchmarkSettings& settings)
+    {
+        const int numChannels = settings.numChannels;
+
+        std::unique_ptr<juce::AudioProcessor> plugin (createPluginFilter());
+        auto* juicer = dynamic_cast<LofijuicerAudioProcessor*> (plugin.get());
+
+        if (juicer == nullptr)
+            return {};
+
+        plugin.release();
+        juicer->setPlayConfigDetails (numChannels, numChannels, sampleRate, blockSize);
+
+        if (settings.maxSubBlockSize >= 0)
+            juicer->setMaxSubBlockSize (settings.maxSubBlockSize);
+
+        juicer->setProcessingPrecision (doublePrecision ? juce::AudioProcessor::doublePrecision
+                                                        : juce::AudioProcessor::singlePrecision);
+        juicer->prepareToPlay (sampleRate, blockSize);
+        return std::unique_ptr<LofijuicerAudioProcessor> (juicer);
+    }
+
+    /** The same noise in either precision, so both runs see the same signal. */
+    template <typename SampleType>
+    void fillWithNoise (juce::AudioBuffer<SampleType>& buffer, juce::Random& random)
+    {
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+        {
+            auto* data = buffer.getWritePointer (channel);
+
+            for (int i = 0; i < buffer.getNumSamples(); ++i)
+                data[i] = (SampleType) (random.nextFloat() - 0.5f);
+        }
+    }
+
+    /** runBenchmark for one precision. */
+    template <typename SampleType>
+    juce::Array<StageTiming> timeStages (double sampleRate, int blockSize, const BenchmarkSettings& settings)
+    {
+        constexpr bool doublePrecision = std::is_same<SampleType, double>::value;
+
+        const int numBlocks = juce::jmax (1, juce::roundToInt (settings.secondsPerRun * sampleRate / blockSize));
+        const int numWarmUpBlocks = juce::roundToInt (settings.warmUpSeconds * sampleRate / blockSize);
+        const juce::int64 numSamples = (juce::int64) numBlocks * blockSize;
+
+        juce::AudioBuffer<SampleType> buffer (settings.numChannels, blockSize);
+        juce::MidiBuffer midi;
+        juce::Array<StageTiming> results;
+
+        // whole processBlock, exactly as a host would call it
+        {
+            auto juicer = createPrepared (sampleRate, blockSize, doublePrecision, settings);
+            jassert (juicer != nullptr);
+
+            juce::Random random (0x10f1);
+            StageClock clock;
+            StageTotals profileStart;
+
+            if (settings.profileStages)
+                juicer->stageProfiler.addListener();
+
+            for (int block = -numWarmUpBlocks; block < numBlocks; ++block)
+            {
+                fillWithNoise (buffer, random);
+
+                if (block == 0)
+                    profileStart = juicer->stageProfiler.getTotals();
+
+                const auto start = juce::Time::getHighResolutionTicks();
+                juicer->processBlock (buffer, midi);
+                const auto ticks = juce::Time::getHighResolutionTicks() - start;
+
+                if (block >= 0)
+                    clock.add (ticks);
+            }
+
+            auto timing = clock.toTiming ("processBlock", numSamples, settings.numChannels, sampleRate, blockSize);
+            timing.idleFraction = juicer->getIdleFraction();
+            results.add (timing);
+
+            // the same run as the processor's own timers split it up, only totals per stage
+            if (settings.profileStages)
+            {
+                const auto profiled = juicer->stageProfiler.getTotals() - profileStart;
+                juicer->stageProfiler.removeListener();
+
+                for (int stage = 0; stage < (int) ProfiledStage::numStages; ++stage)
+                {
+                    StageClock stageClock;
+                    stageClock.totalTicks = profiled.ticks[stage];
+
+                    auto stageTiming = stageClock.toTiming (juce::String ("> ") + StageProfiler::getStageName ((ProfiledStage) stage),
+                                                            numSamples, settings.numChannels, sampleRate, blockSize);
+                    stageTiming.worstBlockUs = stageTiming.worstBlockLoad = -1.0;
+                    results.add (stageTiming);
+                }
+            }
+        }
+
+        // an instance on an empty track: the warm-up is noise, everything timed is silence
+        {
+            auto juicer = createPrepared (sampleRate, blockSize, doublePrecision, settings);
+
+            juce::Random random (0x10f1);
+            StageClock clock;
+
+            for (int block = -numWarmUpBlocks; block < numBlocks; ++block)
+            {
+                if (block < 0)
+                    fillWithNoise (buffer, random);
+                else
+                    buffer.clear();
+
+                if (block == 0)
+                    juicer->resetIdleStatistics();
+
+                const auto start = juce::Time::getHighResolutionTicks();
+                juicer->processBlock (buffer, midi);
+                const auto ticks = juce::Time::getHighResolutionTicks() - start;
+
+                if (block >= 0)
+                    clock.add (ticks);
+            }
+
+            auto timing = clock.toTiming ("silence", numSamples, settings.numChannels, sampleRate, blockSize);
+            timing.idleFraction = juicer->getIdleFraction();
+            results.add (timing);
+        }
+
+        // the same signal again on a fresh instance, with each stage timed on its own
+        {
+            auto juicer = createPrepared (sampleRate, blockSize, doublePrecision, settings);
+
+            juce::Random random (0x10f1);
+            StageClock crusherClock, filterClock, chorusClock, noiseClock;
+
+            for (int block = -numWarmUpBlocks; block < numBlocks; ++block)
+            {
+                fillWithNoise (buffer, random);
+                juicer->updateParameters();
+
+                const auto start = juce::Time::getHighResolutionTicks();
+                juicer->processCrusher (buffer);
+                const auto crusherDone = juce::Time::getHighResolutionTicks();
+                juicer->processFilter (buffer);
+                const auto filterDone = juce::Time::getHighResolutionTicks();
+                juicer->processChorus (buffer);
+                const auto chorusDone = juce::Time::getHighResolutionTicks();
+                juicer->processNoise (buffer);
+                const auto noiseDone = juce::Time::getHighResolutionTicks();
+
+                if (block >= 0)
+                {
+                    crusherClock.add (crusherDone - start);
+                    filterClock.add (filterDone - crusherDone);
+                    chorusClock.add (chorusDone - filterDone);
+                    noiseClock.add (noiseDone - chorusDone);
+                }
+            }
+
+            results.add (crusherClock.toTiming ("crusher", numSamples, settings.numChannels, sampleRate, blockSize));
+            results.add (filterClock.toTiming ("filter", numSamples, settings.numChannels, sampleRate, blockSize));
+            results.add (chorusClock.toTiming ("chorus", numSamples, settings.numChannels, sampleRate, blockSize));
+            results.add (noiseClock.toTiming ("noise", numSamples, settings.numChannels, sampleRate, blockSize));
+        }
+
+        return results;
+    }
+}
+
+//==============================================================================
+juce::Array<StageTiming> runBenchmark (double sampleRate, int blockSize, bool doublePrecision,
+                                       const BenchmarkSettings& settings)
+{
+    return doublePrecision ? timeStages<double> (sampleRate, blockSize, settings)
+                           : timeStages<float> (sampleRate, blockSize, settings);
+}
+
+void runBenchmarks (const BenchmarkSettings& settings)
+{
+    std::printf ("%9s %6s %5s  %-13s %11s %12s %14s %10s %7s\n",
+                 "rate", "block", "bits", "stage", "ns/sample", "x realtime", "worst (us)", "worst/rt", "idle");
+
+    for (auto sampleRate : settings.sampleRates)
+    {
+        for (auto blockSize : settings.blockSizes)
+        {
+            for (auto precision : settings.precisions)
+            {
+                const bool doublePrecision = precision == 64;
+
+                for (auto& timing : runBenchmark (sampleRate, blockSize, doublePrecision, settings))
+                {
+                    const auto idle = timing.idleFraction >= 0.0 ? juce::String (timing.idleFraction * 100.0, 1) + "%"
+                                                                 : juce::String ("-");
+
+                    const bool hasWorst = timing.worstBlockUs >= 0.0;
+                    const auto worstUs = hasWorst ? juce::String (timing.worstBlockUs, 2) : juce::String ("-");
+                    const auto worstLoad = hasWorst ? juce::String (timing.worstBlockLoad * 100.0, 2) + "%" : juce::String ("-");
+
+                    std::printf ("%9.0f %6d %5d  %-13s %11.2f %12.1f %14s %10s %7s\n",
+                                 sampleRate, blockSize, precision, timing.stage.toRawUTF8(),
+                                 timing.nsPerSample, timing.realtimeFactor,
+                                 worstUs.toRawUTF8(), worstLoad.toRawUTF8(), idle.toRawUTF8());
+                }
+
+                if (auto juicer = createPrepared (sampleRate, blockSize, doublePrecision, settings))
+                    std::printf ("%9.0f %6d %5d  %-13s %8.1f KiB per instance\n", sampleRate, blockSize, precision,
+                                 "delay line", (double) juicer->getDelayLineBytes() / 1024.0);
+            }
+        }
+    }
+}
@@ -0,0 +1,49 @@
+/*
+  ==============================================================================
+
+    Benchmark.h
+    Offline processBlock timing for LofijuicerAudioProcessor.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/** Timing figures for one stage of processBlock at one sample rate / block size. */
+struct StageTiming
+{
+    juce::String stage;
+    double nsPerSample   = 0.0;     // average cost per sample per channel
+    double realtimeFactor = 0.0;    // seconds of audio rendered per second of CPU
+    double worstBlockUs  = 0.0;     // slowest single block, in microseconds, -1 where it isn't known
+    double worstBlockLoad = 0.0;    // slowest block as a fraction of the block's real-time budget
+    double idleFraction  = -1.0;    // share of samples skipped as silence, -1 where it doesn't apply
+};
+
+/** Settings for a benchmark run; every sample rate is measured at every block size,
+    once per precision (32 = float, 64 = double processBlock). */
+struct BenchmarkSettings
+{
+    juce::Array<double> sampleRates { 44100.0, 48000.0, 96000.0, 192000.0 };
+    juce::Array<int> blockSizes { 32, 64, 128, 256, 512, 1024 };
+    juce::Array<int> precisions { 32, 64 };
+    int numChannels = 2;
+    int maxSubBlockSize = -1;           // the processor's own default when negative, 0 = whole blocks
+    bool profileStages = false;         // also report the processor's own stage timers for the processBlock run
+    double secondsPerRun = 10.0;
+    double warmUpSeconds = 0.5;
+};
+
+/** Times a freshly created plugin instance at a single configuration, prepared for
+    double precision if asked to. Returns one entry for the whole processBlock, then
+    with profileStages one per stage as the processor's StageProfiler saw it inside
+    that run, then one for processBlock on silent input after a burst of noise, then
+    one per stage called on its own. */
+juce::Array<StageTiming> runBenchmark (double sampleRate, int blockSize, bool doublePrecision,
+                                       const BenchmarkSettings& settings);
+
+/** Runs every configuration in the settings and prints a table to stdout. */
+void runBenchmarks (const BenchmarkSettings& settings);
@@ -0,0 +1,170 @@
+/*
+  ==============================================================================
+
+    DspChecks.cpp
+    Quick checks on the state of the DSP classes, run without a host.
+
+  ==============================================================================
+*/
+
+#include "DspChecks.h"
+#include "../../Source/Bitcrusher.h"
+#include "../../Source/ChorusEnsemble.h"
+#include "../../Source/VinylNoise.h"
+
+namespace
+{
+    /** True if the two are within a part in a million of each other. */
+    bool isClose (double actual, double expected)
+    {
+        return std::abs (actual - expected) <= 1.0e-6 * std::abs (expected);
+    }
+
+    //==============================================================================
+    /** A re-prepare at another rate, then the same settings as before: the anti-alias
+        filter has to end up under the new rate's Nyquist, not the old one's. */
+    juce::String checkBitcrusherRePrepare()
+    {
+        Bitcrusher crusher;
+        constexpr float downsample = 4.0f;
+
+        crusher.prepare (44100.0, 2);
+        crusher.setParameters (8.0f, downsample, true);
+        crusher.prepare (96000.0, 2);
+        crusher.setParameters (8.0f, downsample, true);
+
+        const double expected = 0.45 * 96000.0 / downsample;
+        const double cutoff = crusher.getAntiAliasCutoff();
+
+        if (! isClose (cutoff, expected))
+            return "anti-alias cutoff " + juce::String (cutoff, 1) + " Hz, expected " + juce::String (expected, 1);
+
+        return {};
+    }
+
+    /** Input far past full scale, as a resonant filter can give, at a fixed and a runtime
+        bit depth: the quantizer has to clamp it to within one step of full scale, not overflow. */
+    juce::String checkBitcrusherFullScale()
+    {
+        for (auto bits : { 8.0f, 10.5f })
+        {
+            Bitcrusher crusher;
+            crusher.prepare (48000.0, 1);
+            crusher.setParameters (bits, 1.0f, false);
+
+            float samples[] { 1.0e6f, -1.0e6f, 3.0e9f, -3.0e9f };
+            float* channels[] { samples };
+            crusher.process (juce::dsp::AudioBlock<float> (channels, 1, 4));
+
+            const float step = 1.0f / std::exp2 (bits - 1.0f);
+
+            for (int i = 0; i < 4; ++i)
+            {
+                const float magnitude = i % 2 == 0 ? samples[i] : -samples[i];
+
+                if (magnitude > 1.0f || magnitude < 1.0f - step)
+                    return juce::String (bits) + " bits gives " + juce::String (samples[i]) + " for sample " + juce::String (i);
+            }
+        }
+
+        return {};
+    }
+
+    /** The same voices before and after a re-prepare at another rate: every voice's LFO
+        has to keep its rate in Hz, so its increment per sample has to follow the rate. */
+    juce::String checkEnsembleRePrepare()
+    {
+        ChorusEnsemble ensemble;
+        constexpr int numVoices = 4;
+        constexpr float detune = 0.5f, rateHz = 2.0f;
+
+        ensemble.prepare (44100.0);
+        ensemble.setVoices (numVoices, detune, rateHz);
+        ensemble.prepare (96000.0);
+        ensemble.setVoices (numVoices, detune, rateHz);
+
+        for (int voice = 0; voice < numVoices; ++voice)
+        {
+            const float spread = (float) voice / (float) (numVoices - 1) - 0.5f;
+            const double expected = rateHz * (1.0f + detune * spread) / 96000.0;
+            const double increment = ensemble.getVoiceIncrement (voice);
+
+            if (! isClose (increment, expected))
+                return "voice " + juce::String (voice) + " moves " + juce::String (increment * 96000.0, 3)
+                         + " Hz, expected " + juce::String (expected * 96000.0, 3);
+        }
+
+        return {};
+    }
+
+    /** A second of hiss and crackle made in 512-sample blocks, then again in blocks of
+        an odd size: every sample has to come out the same. */
+    juce::String checkVinylNoiseBlockSize()
+    {
+        constexpr double sampleRate = 48000.0;
+        constexpr int numChannels = 2, numSamples = 48000, maxBlockSize = 512;
+
+        auto render = [&] (int blockSize)
+        {
+            VinylNoise noise;
+            noise.prepare (sampleRate, numChannels, maxBlockSize);
+            noise.setLevels (0.7f, 1.0f);
+
+            juce::AudioBuffer<float> buffer (numChannels, numSamples);
+            buffer.clear();
+            juce::dsp::AudioBlock<float> block (buffer);
+
+            for (int start = 0; start < numSamples; start += blockSize)
+                noise.process (block.getSubBlock ((size_t) start, (size_t) juce::jmin (blockSize, numSamples - start)));
+
+            return buffer;
+        };
+
+        const auto whole = render (maxBlockSize);
+        const auto pieces = render (37);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            for (int i = 0; i < numSamples; ++i)
+                if (whole.getSample (channel, i) != pieces.getSample (channel, i))
+                    return "channel " + juce::String (channel) + " differs from sample " + juce::String (i);
+
+        return {};
+    }
+
+    //==============================================================================
+    struct DspCheck
+    {
+        const char* name;
+        juce::String (*run)();          // an empty string on success, what went wrong otherwise
+    };
+
+    const DspCheck dspChecks[] =
+    {
+        { "bitcrusher re-prepare",  checkBitcrusherRePrepare },
+        { "bitcrusher full scale",  checkBitcrusherFullScale },
+        { "ensemble re-prepare",    checkEnsembleRePrepare },
+        { "vinyl noise block size", checkVinylNoiseBlockSize }
+    };
+}
+
+//==============================================================================
+int runDspChecks()
+{
+    int numFailures = 0;
+
+    for (auto& check : dspChecks)
+    {
+        const auto error = check.run();
+
+        if (error.isEmpty())
+        {
+            std::printf ("%-32s ok\n", check.name);
+            continue;
+        }
+
+        std::printf ("%-32s FAIL %s\n", check.name, error.toRawUTF8());
+        ++numFailures;
+    }
+
+    return numFailures;
+}
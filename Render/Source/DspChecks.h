@@ -0,0 +1,18 @@
+/*
+  ==============================================================================
+
+    DspChecks.h
+    Quick checks on the state of the DSP classes, run without a host.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/** Runs each check on a fresh instance of the class it covers and prints one line
+    per check. These look at internal state that a render can hide, such as what is
+    left over from an earlier prepare(). Returns the number of checks that failed. */
+int runDspChecks();
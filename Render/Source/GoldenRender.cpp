@@ -0,0 +1,385 @@
+/*
+  ==============================================================================
+
+    GoldenRender.cpp
+    Renders fixed signals through LofijuicerAudioProcessor and compares them
+    against stored reference WAVs.
+
+  ==============================================================================
+*/
+
+#include "GoldenRender.h"
+#include "../../Source/PluginProcessor.h"
+
+// defined by the plugin sources, the same entry point a host would use
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+namespace
+{
+    constexpr int numChannels = 2;
+
+    //==============================================================================
+    /** A single full-scale sample, then two seconds for the filter and the chorus to ring. */
+    juce::AudioBuffer<float> makeImpulse (double sampleRate)
+    {
+        juce::AudioBuffer<float> buffer (numChannels, juce::roundToInt (sampleRate * 2.0));
+        buffer.clear();
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            buffer.setSample (channel, 0, 1.0f);
+
+        return buffer;
+    }
+
+    /** An exponential sine sweep from 20 Hz to 20 kHz over four seconds at -6 dBFS, then a second of silence. */
+    juce::AudioBuffer<float> makeSweep (double sampleRate)
+    {
+        const int sweepLength = juce::roundToInt (sampleRate * 4.0);
+        juce::AudioBuffer<float> buffer (numChannels, sweepLength + juce::roundToInt (sampleRate));
+        buffer.clear();
+
+        const double startHz = 20.0, endHz = juce::jmin (20000.0, sampleRate * 0.45);
+        const double rate = std::log (endHz / startHz) / sweepLength;
+        double phase = 0.0;
+
+        for (int i = 0; i < sweepLength; ++i)
+        {
+            const float sample = 0.5f * (float) std::sin (phase);
+
+            for (int channel = 0; channel < numChannels; ++channel)
+                buffer.setSample (channel, i, sample);
+
+            phase += juce::MathConstants<double>::twoPi * startHz * std::exp (rate * i) / sampleRate;
+        }
+
+        return buffer;
+    }
+
+    /** Two seconds of white noise at -12 dBFS, different on each channel, then a second of silence. */
+    juce::AudioBuffer<float> makeNoise (double sampleRate)
+    {
+        const int noiseLength = juce::roundToInt (sampleRate * 2.0);
+        juce::AudioBuffer<float> buffer (numChannels, noiseLength + juce::roundToInt (sampleRate));
+        buffer.clear();
+
+        juce::Random random (0x90de);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            for (int i = 0; i < noiseLength; ++i)
+                buffer.setSample (channel, i, 0.5f * (random.nextFloat() - 0.5f));
+
+        return buffer;
+    }
+
+    /** Two bars at 120 bpm: kick on 1 and 3, snare on 2 and 4, closed hats on the eighths,
+        synthesized so the loop is the same on every machine. */
+    juce::AudioBuffer<float> makeDrumLoop (double sampleRate)
+    {
+        const int samplesPerBeat = juce::roundToInt (sampleRate * 0.5);
+        juce::AudioBuffer<float> buffer (numChannels, samplesPerBeat * 8 + juce::roundToInt (sampleRate));
+        buffer.clear();
+
+        juce::Random random (0xd4d5);
+
+        auto addHit = [&] (int start, double seconds, float leftGain, float rightGain, auto&& voice)
+        {
+            const int length = juce::jmin (juce::roundToInt (seconds * sampleRate), buffer.getNumSamples() - start);
+
+            for (int i = 0; i < length; ++i)
+            {
+                const float sample = voice ((double) i / sampleRate);
+                buffer.addSample (0, start + i, sample * leftGain);
+                buffer.addSample (1, start + i, sample * rightGain);
+            }
+        };
+
+        for (int beat = 0; beat < 8; ++beat)
+        {
+            const int start = beat * samplesPerBeat;
+
+            if (beat % 2 == 0)
+            {
+                // a sine dropping from 150 Hz to 50 Hz
+                double phase = 0.0;
+
+                addHit (start, 0.3, 1.0f, 1.0f, [&] (double t)
+                {
+                    phase += juce::MathConstants<double>::twoPi * (50.0 + 100.0 * std::exp (-t * 30.0)) / sampleRate;
+                    return 0.8f * (float) (std::sin (phase) * std::exp (-t * 12.0));
+                });
+            }
+            else
+            {
+                // noise over a 190 Hz body
+                addHit (start, 0.2, 0.9f, 1.0f, [&] (double t)
+                {
+                    const double body = 0.3 * std::sin (juce::MathConstants<double>::twoPi * 190.0 * t);
+                    return (float) ((0.5 * (random.nextFloat() - 0.5f) + body) * std::exp (-t * 25.0));
+                });
+            }
+
+            for (int half = 0; half < 2; ++half)
+            {
+                // differenced noise, a crude high-pass
+                float previous = 0.0f;
+
+                addHit (start + half * samplesPerBeat / 2, 0.05, 1.0f, 0.7f, [&] (double t)
+                {
+                    const float noise = random.nextFloat() - 0.5f;
+                    const float hat = noise - previous;
+                    previous = noise;
+                    return 0.2f * hat * (float) std::exp (-t * 80.0);
+                });
+            }
+        }
+
+        return buffer;
+    }
+
+    //==============================================================================
+    struct TestSignal
+    {
+        const char* name;
+        juce::AudioBuffer<float> (*make) (double sampleRate);
+    };
+
+    /** Parameter values in their own units (choices by index, switches as 0 / 1);
+        anything not listed stays at its default. */
+    struct ParameterSet
+    {
+        const char* name;
+        std::vector<std::pair<const char*, float>> values;
+    };
+
+    const TestSignal testSignals[] =
+    {
+        { "impulse", makeImpulse },
+        { "sweep",   makeSweep },
+        { "noise",   makeNoise },
+        { "drums",   makeDrumLoop }
+    };
+
+    const std::vector<ParameterSet>& getParameterSets()
+    {
+        static const std::vector<ParameterSet> sets
+        {
+            { "default", {} },
+            { "crushed", { { ParamIDs::crushBits, 6.0f }, { ParamIDs::crushDownsample, 8.0f },
+                           { ParamIDs::crushAntiAlias, 0.0f } } },
+            { "chorus",  { { ParamIDs::chorusVoices, 4.0f }, { ParamIDs::chorusDetune, 0.6f },
+                           { ParamIDs::depth, 0.9f }, { ParamIDs::delayTime, 40.0f },
+                           { ParamIDs::interpolation, 2.0f }, { ParamIDs::lfoRate, 2.5f },
+                           { ParamIDs::wow, 0.5f }, { ParamIDs::flutter, 0.5f } } },
+            { "filter",  { { ParamIDs::cutoff, 120.0f }, { ParamIDs::resonance, 8.0f },
+                           { ParamIDs::saturation, 1.0f }, { ParamIDs::saturationDrive, 12.0f },
+                           { ParamIDs::saturationCurve, 2.0f }, { ParamIDs::oversampling, 2.0f },
+                           { ParamIDs::oversamplingQuality, 1.0f } } },
+            { "vinyl",   { { ParamIDs::hiss, 0.5f }, { ParamIDs::crackle, 0.5f } } }
+        };
+
+        return sets;
+    }
+
+    //==============================================================================
+    /** Runs the signal through a fresh instance, set up before prepareToPlay so nothing ramps. */
+    juce::AudioBuffer<float> render (const juce::AudioBuffer<float>& signal, const ParameterSet& set,
+                                     const GoldenSettings& settings)
+    {
+        std::unique_ptr<juce::AudioProcessor> plugin (createPluginFilter());
+        auto* juicer = dynamic_cast<LofijuicerAudioProcessor*> (plugin.get());
+
+        if (juicer == nullptr)
+            return {};
+
+        for (auto& value : set.values)
+            if (auto* parameter = juicer->parameters.getParameter (value.first))
+                parameter->setValueNotifyingHost (parameter->convertTo0to1 (value.second));
+
+        juicer->setPlayConfigDetails (numChannels, numChannels, settings.sampleRate, settings.blockSize);
+        juicer->setNonRealtime (true);
+        juicer->prepareToPlay (settings.sampleRate, settings.blockSize);
+
+        juce::AudioBuffer<float> output (signal);
+        juce::MidiBuffer midi;
+
+        for (int start = 0; start < output.getNumSamples(); start += settings.blockSize)
+        {
+            const int numSamples = juce::jmin (settings.blockSize, output.getNumSamples() - start);
+            juce::AudioBuffer<float> block (output.getArrayOfWritePointers(), numChannels, start, numSamples);
+            juicer->processBlock (block, midi);
+        }
+
+        juicer->releaseResources();
+        return output;
+    }
+
+    bool writeWav (const juce::File& file, const juce::AudioBuffer<float>& buffer, double sampleRate)
+    {
+        file.deleteFile();
+        std::unique_ptr<juce::FileOutputStream> stream (file.createOutputStream());
+
+        if (stream == nullptr)
+            return false;
+
+        // 32-bit float, so a reference holds exactly what was rendered
+        juce::WavAudioFormat wav;
+        std::unique_ptr<juce::AudioFormatWriter> writer (wav.createWriterFor (stream.get(), sampleRate,
+                                                                              (unsigned int) buffer.getNumChannels(),
+                                                                              32, {}, 0));
+
+        if (writer == nullptr)
+            return false;
+
+        stream.release();   // the writer owns it now
+        return writer->writeFromAudioSampleBuffer (buffer, 0, buffer.getNumSamples());
+    }
+
+    bool readWav (juce::AudioFormatManager& formats, const juce::File& file, juce::AudioBuffer<float>& buffer)
+    {
+        std::unique_ptr<juce::AudioFormatReader> reader (formats.createReaderFor (file));
+
+        if (reader == nullptr)
+            return false;
+
+        buffer.setSize ((int) reader->numChannels, (int) reader->lengthInSamples);
+        return reader->read (&buffer, 0, buffer.getNumSamples(), 0, true, true);
+    }
+
+    /** Largest difference between the two, or -1 if they don't even have the same shape. */
+    double getMaxDifference (const juce::AudioBuffer<float>& rendered, const juce::AudioBuffer<float>& reference)
+    {
+        if (rendered.getNumChannels() != reference.getNumChannels()
+             || rendered.getNumSamples() != reference.getNumSamples())
+            return -1.0;
+
+        double maxDifference = 0.0;
+
+        for (int channel = 0; channel < rendered.getNumChannels(); ++channel)
+        {
+            auto* renderedData = rendered.getReadPointer (channel);
+            auto* referenceData = reference.getReadPointer (channel);
+
+            for (int i = 0; i < rendered.getNumSamples(); ++i)
+                maxDifference = juce::jmax (maxDifference, std::abs ((double) renderedData[i] - (double) referenceData[i]));
+        }
+
+        return maxDifference;
+    }
+
+    /** Runs the baseline build's own golden command into the reference directory, with the same rate and block size. */
+    bool renderBaselineReferences (const GoldenSettings& settings)
+    {
+        if (! settings.baselineExecutable.existsAsFile())
+        {
+            std::printf ("no baseline build at %s\n", settings.baselineExecutable.getFullPathName().toRawUTF8());
+            return false;
+        }
+
+        std::printf ("rendering references with %s\n", settings.baselineExecutable.getFullPathName().toRawUTF8());
+
+        juce::StringArray command { settings.baselineExecutable.getFullPathName(), "golden", "--update",
+                                    "--reference", settings.referenceDirectory.getFullPathName(),
+                                    "--rate", juce::String (settings.sampleRate),
+                                    "--block", juce::String (settings.blockSize) };
+
+        juce::ChildProcess baseline;
+
+        if (! baseline.start (command))
+        {
+            std::printf ("can't start the baseline build\n");
+            return false;
+        }
+
+        // waits for it to finish
+        const auto output = baseline.readAllProcessOutput();
+
+        if (baseline.getExitCode() != 0)
+        {
+            std::printf ("%sthe baseline build failed to render the references\n", output.toRawUTF8());
+            return false;
+        }
+
+        return true;
+    }
+}
+
+//==============================================================================
+int runGoldenRenders (const GoldenSettings& settings)
+{
+    const auto writeDirectory = settings.updateReferences ? settings.referenceDirectory : settings.outputDirectory;
+
+    if (! writeDirectory.createDirectory().wasOk())
+    {
+        std::printf ("can't create %s\n", writeDirectory.getFullPathName().toRawUTF8());
+        return 1;
+    }
+
+    if (settings.baselineExecutable != juce::File() && ! settings.updateReferences
+         && ! renderBaselineReferences (settings))
+        return 1;
+
+    juce::AudioFormatManager formats;
+    formats.registerBasicFormats();
+
+    std::printf ("%-24s %12s %9s  %s\n", "render", "max diff", "dB", "result");
+
+    int numFailures = 0, numMissing = 0;
+
+    for (auto& signal : testSignals)
+    {
+        const auto input = signal.make (settings.sampleRate);
+
+        for (auto& set : getParameterSets())
+        {
+            const auto name = juce::String (signal.name) + "_" + set.name;
+            const auto fileName = name + ".wav";
+            const auto rendered = render (input, set, settings);
+
+            if (! writeWav (writeDirectory.getChildFile (fileName), rendered, settings.sampleRate))
+            {
+                std::printf ("%-24s %12s %9s  can't write %s\n", name.toRawUTF8(), "-", "-", fileName.toRawUTF8());
+                ++numFailures;
+                continue;
+            }
+
+            if (settings.updateReferences)
+            {
+                std::printf ("%-24s %12s %9s  updated\n", name.toRawUTF8(), "-", "-");
+                continue;
+            }
+
+            juce::AudioBuffer<float> reference;
+
+            if (! readWav (formats, settings.referenceDirectory.getChildFile (fileName), reference))
+            {
+                std::printf ("%-24s %12s %9s  MISSING reference\n", name.toRawUTF8(), "-", "-");
+                ++numFailures;
+                ++numMissing;
+                continue;
+            }
+
+            const double difference = getMaxDifference (rendered, reference);
+
+            if (difference < 0.0)
+            {
+                std::printf ("%-24s %12s %9s  FAIL (length or channels differ)\n", name.toRawUTF8(), "-", "-");
+                ++numFailures;
+                continue;
+            }
+
+            const bool passed = difference <= settings.tolerance;
+
+            std::printf ("%-24s %12.3g %9.1f  %s\n", name.toRawUTF8(), difference,
+                         juce::Decibels::gainToDecibels (difference, -200.0), passed ? "ok" : "FAIL");
+
+            if (! passed)
+                ++numFailures;
+        }
+    }
+
+    if (numMissing > 0)
+        std::printf ("no references in %s, render them with --update on a known-good build or pass --baseline\n",
+                     settings.referenceDirectory.getFullPathName().toRawUTF8());
+
+    return numFailures;
+}
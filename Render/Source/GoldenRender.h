@@ -0,0 +1,36 @@
+/*
+  ==============================================================================
+
+    GoldenRender.h
+    Renders fixed signals through LofijuicerAudioProcessor and compares them
+    against stored reference WAVs.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/** Settings for a golden render run. */
+struct GoldenSettings
+{
+    juce::File referenceDirectory;      // stored renders from a known-good build
+    juce::File outputDirectory;         // this run's renders, for listening to or diffing a failure
+    bool updateReferences = false;      // write the renders as the new references instead of comparing
+    juce::File baselineExecutable;      // a known-good build of this harness that renders the references first
+    double tolerance = 1.0e-4;          // largest sample difference allowed, 0 for bit-exact
+    double sampleRate = 48000.0;
+    int blockSize = 512;
+};
+
+/** Renders every test signal (impulse, sweep, noise, drum loop) through a fresh plugin
+    instance with every parameter set, writes each as a 32-bit float WAV and compares it
+    with the reference of the same name. Prints one line per render and returns the number
+    of renders that are missing a reference or differ by more than the tolerance.
+
+    With a baseline executable, that build is first run with --update into the reference
+    directory, so a fresh checkout (or CI) can compare against the commit it branched from
+    without any stored WAVs. */
+int runGoldenRenders (const GoldenSettings& settings);
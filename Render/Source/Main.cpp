@@ -0,0 +1,242 @@
+/*
+  ==============================================================================
+
+    This file contains the basic startup code for a JUCE application.
+
+    lo-fi-juicer-render: headless driver for LofijuicerAudioProcessor.
+
+        lo-fi-juicer-render bench [--rates 44100,48000] [--blocks 64,512]
+                                  [--channels 2] [--seconds 10] [--precision 32,64]
+                                  [--subblock 0] [--profile]
+        lo-fi-juicer-render rtcheck [--rates 44100,96000] [--blocks 64,512]
+                                    [--channels 2] [--precision 32,64] [--steps 200]
+        lo-fi-juicer-render golden [--reference golden] [--out golden-out]
+                                   [--tolerance 1e-4] [--rate 48000] [--block 512]
+                                   [--update | --baseline <known-good lo-fi-juicer-render>]
+        lo-fi-juicer-render batch <input dir> <output dir> [--state juicer.state] [--threads 0]
+                                  [--block 8192] [--bits 24] [--tail 2] [--recursive]
+        lo-fi-juicer-render check
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "Benchmark.h"
+#include "RealtimeCheck.h"
+#include "GoldenRender.h"
+#include "BatchProcessor.h"
+#include "DspChecks.h"
+#include "../../Source/StageProfiler.h"
+
+//==============================================================================
+static void printUsage()
+{
+    std::printf ("usage: lo-fi-juicer-render bench [--rates 44100,48000] [--blocks 64,512]\n"
+                 "                                 [--channels 2] [--seconds 10] [--precision 32,64]\n"
+                 "                                 [--subblock 0] [--profile]\n"
+                 "       lo-fi-juicer-render rtcheck [--rates 44100,96000] [--blocks 64,512]\n"
+                 "                                   [--channels 2] [--precision 32,64] [--steps 200]\n"
+                 "       lo-fi-juicer-render golden [--reference golden] [--out golden-out]\n"
+                 "                                  [--tolerance 1e-4] [--rate 48000] [--block 512]\n"
+                 "                                  [--update | --baseline <known-good lo-fi-juicer-render>]\n"
+                 "       lo-fi-juicer-render batch <input dir> <output dir> [--state juicer.state] [--threads 0]\n"
+                 "                                 [--block 8192] [--bits 24] [--tail 2] [--recursive]\n"
+                 "       lo-fi-juicer-render check\n");
+}
+
+static juce::StringArray splitList (const juce::String& list)
+{
+    return juce::StringArray::fromTokens (list, ",", {});
+}
+
+static int runBenchCommand (const juce::ArgumentList& args)
+{
+    BenchmarkSettings settings;
+
+    if (args.containsOption ("--rates"))
+    {
+        settings.sampleRates.clear();
+
+        for (auto& rate : splitList (args.getValueForOption ("--rates")))
+            settings.sampleRates.add (rate.getDoubleValue());
+    }
+
+    if (args.containsOption ("--blocks"))
+    {
+        settings.blockSizes.clear();
+
+        for (auto& size : splitList (args.getValueForOption ("--blocks")))
+            settings.blockSizes.add (size.getIntValue());
+    }
+
+    if (args.containsOption ("--channels"))
+        settings.numChannels = juce::jlimit (1, 16, args.getValueForOption ("--channels").getIntValue());
+
+    if (args.containsOption ("--seconds"))
+        settings.secondsPerRun = juce::jmax (0.1, args.getValueForOption ("--seconds").getDoubleValue());
+
+    if (args.containsOption ("--subblock"))
+        settings.maxSubBlockSize = juce::jmax (0, args.getValueForOption ("--subblock").getIntValue());
+
+    if (args.containsOption ("--profile"))
+    {
+        if (! StageProfiler::isCompiledIn())
+            std::printf ("stage timers aren't built in, use a Debug build or define LOFIJUICER_ENABLE_STAGE_TIMING=1\n");
+
+        settings.profileStages = StageProfiler::isCompiledIn();
+    }
+
+    if (args.containsOption ("--precision"))
+    {
+        settings.precisions.clear();
+
+        for (auto& bits : splitList (args.getValueForOption ("--precision")))
+            settings.precisions.addIfNotAlreadyThere (bits.getIntValue() == 64 ? 64 : 32);
+    }
+
+    runBenchmarks (settings);
+    return 0;
+}
+
+static int runRealtimeCheckCommand (const juce::ArgumentList& args)
+{
+    RealtimeCheckSettings settings;
+
+    if (args.containsOption ("--rates"))
+    {
+        settings.sampleRates.clear();
+
+        for (auto& rate : splitList (args.getValueForOption ("--rates")))
+            settings.sampleRates.add (rate.getDoubleValue());
+    }
+
+    if (args.containsOption ("--blocks"))
+    {
+        settings.blockSizes.clear();
+
+        for (auto& size : splitList (args.getValueForOption ("--blocks")))
+            settings.blockSizes.add (juce::jmax (1, size.getIntValue()));
+    }
+
+    if (args.containsOption ("--channels"))
+        settings.numChannels = juce::jlimit (1, 16, args.getValueForOption ("--channels").getIntValue());
+
+    if (args.containsOption ("--steps"))
+        settings.blocksPerStep = juce::jmax (1, args.getValueForOption ("--steps").getIntValue());
+
+    if (args.containsOption ("--precision"))
+    {
+        settings.precisions.clear();
+
+        for (auto& bits : splitList (args.getValueForOption ("--precision")))
+            settings.precisions.addIfNotAlreadyThere (bits.getIntValue() == 64 ? 64 : 32);
+    }
+
+    // nonzero on any violation, and when the hooks are missing, so a CI step fails either way
+    return runRealtimeChecks (settings) == 0 ? 0 : 1;
+}
+
+static int runGoldenCommand (const juce::ArgumentList& args)
+{
+    GoldenSettings settings;
+    const auto workingDirectory = juce::File::getCurrentWorkingDirectory();
+
+    settings.referenceDirectory = workingDirectory.getChildFile (args.containsOption ("--reference")
+                                                                     ? args.getValueForOption ("--reference")
+                                                                     : juce::String ("golden"));
+    settings.outputDirectory = workingDirectory.getChildFile (args.containsOption ("--out")
+                                                                  ? args.getValueForOption ("--out")
+                                                                  : juce::String ("golden-out"));
+    settings.updateReferences = args.containsOption ("--update");
+
+    if (args.containsOption ("--baseline"))
+        settings.baselineExecutable = workingDirectory.getChildFile (args.getValueForOption ("--baseline"));
+
+    if (args.containsOption ("--tolerance"))
+        settings.tolerance = juce::jmax (0.0, args.getValueForOption ("--tolerance").getDoubleValue());
+
+    if (args.containsOption ("--rate"))
+        settings.sampleRate = juce::jlimit (8000.0, 384000.0, args.getValueForOption ("--rate").getDoubleValue());
+
+    if (args.containsOption ("--block"))
+        settings.blockSize = juce::jmax (1, args.getValueForOption ("--block").getIntValue());
+
+    return runGoldenRenders (settings) == 0 ? 0 : 1;
+}
+
+static int runBatchCommand (const juce::ArgumentList& args)
+{
+    if (args.size() < 3)
+    {
+        printUsage();
+        return 1;
+    }
+
+    BatchSettings settings;
+    const auto workingDirectory = juce::File::getCurrentWorkingDirectory();
+
+    settings.inputDirectory = workingDirectory.getChildFile (args[1].text);
+    settings.outputDirectory = workingDirectory.getChildFile (args[2].text);
+    settings.recursive = args.containsOption ("--recursive");
+
+    if (args.containsOption ("--state"))
+    {
+        const auto stateFile = workingDirectory.getChildFile (args.getValueForOption ("--state"));
+
+        if (! stateFile.loadFileAsData (settings.state))
+        {
+            std::printf ("can't read %s\n", stateFile.getFullPathName().toRawUTF8());
+            return 1;
+        }
+    }
+
+    if (args.containsOption ("--threads"))
+        settings.numThreads = juce::jmax (0, args.getValueForOption ("--threads").getIntValue());
+
+    if (args.containsOption ("--block"))
+        settings.blockSize = juce::jlimit (64, 65536, args.getValueForOption ("--block").getIntValue());
+
+    if (args.containsOption ("--bits"))
+    {
+        const int bits = args.getValueForOption ("--bits").getIntValue();
+        settings.bitsPerSample = bits == 16 || bits == 32 ? bits : 24;
+    }
+
+    if (args.containsOption ("--tail"))
+        settings.tailSeconds = juce::jmax (0.0, args.getValueForOption ("--tail").getDoubleValue());
+
+    return runBatch (settings) == 0 ? 0 : 1;
+}
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    // the plugin's editor and parameter classes expect the message manager to exist
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::ArgumentList args (argc, argv);
+
+    if (args.size() == 0)
+    {
+        printUsage();
+        return 1;
+    }
+
+    if (args[0] == "bench")
+        return runBenchCommand (args);
+
+    if (args[0] == "rtcheck")
+        return runRealtimeCheckCommand (args);
+
+    if (args[0] == "golden")
+        return runGoldenCommand (args);
+
+    if (args[0] == "batch")
+        return runBatchCommand (args);
+
+    if (args[0] == "check")
+        return runDspChecks() == 0 ? 0 : 1;
+
+    printUsage();
+    return 1;
+}
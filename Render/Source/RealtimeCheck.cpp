@@ -0,0 +1,556 @@
+/*
+  ==============================================================================
+
+    RealtimeCheck.cpp
+    Allocation and lock tracking around LofijuicerAudioProcessor's audio callbacks.
+
+  ==============================================================================
+*/
+
+#include "RealtimeCheck.h"
+#include "../../Source/PluginProcessor.h"
+
+#if JUCE_LINUX
+ #include <cerrno>
+ #include <dlfcn.h>
+ #include <pthread.h>
+#endif
+
+// defined by the plugin sources, the same entry point a host would use
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+//==============================================================================
+namespace
+{
+    // set on the thread running the audio callbacks while it is inside one; the hooks
+    // only count there, and never print or allocate themselves
+    thread_local bool insideAudioCallback = false;
+    std::atomic<int> allocationCount { 0 }, deallocationCount { 0 }, lockCount { 0 };
+
+    void noteAllocation() noexcept
+    {
+        if (insideAudioCallback)
+            allocationCount.fetch_add (1, std::memory_order_relaxed);
+    }
+
+    void noteDeallocation() noexcept
+    {
+        if (insideAudioCallback)
+            deallocationCount.fetch_add (1, std::memory_order_relaxed);
+    }
+
+    void noteLock() noexcept
+    {
+        if (insideAudioCallback)
+            lockCount.fetch_add (1, std::memory_order_relaxed);
+    }
+
+    /** Arms the hooks on the calling thread for as long as it exists. */
+    struct ScopedAudioCallback
+    {
+        ScopedAudioCallback() noexcept   { insideAudioCallback = true; }
+        ~ScopedAudioCallback() noexcept  { insideAudioCallback = false; }
+    };
+
+    RealtimeViolations takeViolations() noexcept
+    {
+        RealtimeViolations violations;
+        violations.allocations = allocationCount.exchange (0);
+        violations.deallocations = deallocationCount.exchange (0);
+        violations.locks = lockCount.exchange (0);
+        return violations;
+    }
+}
+
+//==============================================================================
+#if JUCE_LINUX
+// glibc's allocator under its internal names, which the replacements below forward to;
+// operator new and every CriticalSection end up in these, so they're covered too
+extern "C" void* __libc_malloc (size_t);
+extern "C" void* __libc_calloc (size_t, size_t);
+extern "C" void* __libc_realloc (void*, size_t);
+extern "C" void* __libc_memalign (size_t, size_t);
+extern "C" void __libc_free (void*);
+
+namespace
+{
+    using MutexFunction = int (*) (pthread_mutex_t*);
+    std::atomic<MutexFunction> realMutexLock { nullptr }, realMutexTryLock { nullptr };
+
+    // looked up on first use; dlsym takes the loader's own lock, not these hooks
+    MutexFunction getRealFunction (std::atomic<MutexFunction>& function, const char* name) noexcept
+    {
+        auto resolved = function.load (std::memory_order_relaxed);
+
+        if (resolved == nullptr)
+        {
+            resolved = (MutexFunction) dlsym (RTLD_NEXT, name);
+            function.store (resolved, std::memory_order_relaxed);
+        }
+
+        return resolved;
+    }
+}
+
+extern "C"
+{
+    void* malloc (size_t size) noexcept
+    {
+        noteAllocation();
+        return __libc_malloc (size);
+    }
+
+    void* calloc (size_t numElements, size_t elementSize) noexcept
+    {
+        noteAllocation();
+        return __libc_calloc (numElements, elementSize);
+    }
+
+    void* realloc (void* data, size_t size) noexcept
+    {
+        noteAllocation();
+        return __libc_realloc (data, size);
+    }
+
+    void* aligned_alloc (size_t alignment, size_t size) noexcept
+    {
+        noteAllocation();
+        return __libc_memalign (alignment, size);
+    }
+
+    int posix_memalign (void** result, size_t alignment, size_t size) noexcept
+    {
+        noteAllocation();
+        *result = __libc_memalign (alignment, size);
+        return *result != nullptr ? 0 : ENOMEM;
+    }
+
+    void free (void* data) noexcept
+    {
+        if (data != nullptr)
+            noteDeallocation();
+
+        __libc_free (data);
+    }
+
+    int pthread_mutex_lock (pthread_mutex_t* mutex) noexcept
+    {
+        noteLock();
+        return getRealFunction (realMutexLock, "pthread_mutex_lock") (mutex);
+    }
+
+    int pthread_mutex_trylock (pthread_mutex_t* mutex) noexcept
+    {
+        noteLock();
+        return getRealFunction (realMutexTryLock, "pthread_mutex_trylock") (mutex);
+    }
+}
+#else
+// elsewhere only the C++ allocator can be replaced portably, so malloc and locks go unseen
+void* operator new (std::size_t size)
+{
+    noteAllocation();
+
+    if (auto* data = std::malloc (size))
+        return data;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[] (std::size_t size)                             { return operator new (size); }
+void* operator new (std::size_t size, const std::nothrow_t&) noexcept   { noteAllocation(); return std::malloc (size); }
+void* operator new[] (std::size_t size, const std::nothrow_t&) noexcept { noteAllocation(); return std::malloc (size); }
+
+void operator delete (void* data) noexcept
+{
+    if (data != nullptr)
+        noteDeallocation();
+
+    std::free (data);
+}
+
+void operator delete[] (void* data) noexcept                        { operator delete (data); }
+void operator delete (void* data, std::size_t) noexcept             { operator delete (data); }
+void operator delete[] (void* data, std::size_t) noexcept           { operator delete (data); }
+#endif
+
+//==============================================================================
+namespace
+{
+    /** Stands in for the plugin wrapper, which listens to the processor in every host. */
+    struct HostListener : public juce::AudioProcessorListener
+    {
+        void audioProcessorParameterChanged (juce::AudioProcessor*, int, float) override {}
+       #if JUCE_VERSION >= 0x60100
+        void audioProcessorChanged (juce::AudioProcessor*, const ChangeDetails&) override {}
+       #else
+        void audioProcessorChanged (juce::AudioProcessor*) override {}
+       #endif
+    };
+
+    /** A transport the scenario moves along by hand. */
+    struct TransportPlayHead : public juce::AudioPlayHead
+    {
+        TransportPlayHead()     { position.resetToDefault(); }
+
+        bool getCurrentPosition (CurrentPositionInfo& result) override
+        {
+            result = position;
+            return true;
+        }
+
+        void advance (int numSamples, double sampleRate)
+        {
+            position.timeInSamples += numSamples;
+            position.timeInSeconds = (double) position.timeInSamples / sampleRate;
+            position.ppqPosition += numSamples / sampleRate * position.bpm / 60.0;
+        }
+
+        CurrentPositionInfo position;
+    };
+
+    /** Moves a few parameters around from its own thread, the way host automation or the
+        editor does while the audio thread is inside processBlock. */
+    class AutomationThread : public juce::Thread
+    {
+    public:
+        explicit AutomationThread (LofijuicerAudioProcessor& processorToAutomate)
+            : juce::Thread ("rtcheck automation"), processor (processorToAutomate) {}
+
+        void run() override
+        {
+            juce::Random random (0xa070);
+            const char* ids[] = { ParamIDs::cutoff, ParamIDs::resonance, ParamIDs::depth, ParamIDs::delayTime,
+                                  ParamIDs::crushBits, ParamIDs::saturationDrive, ParamIDs::wow, ParamIDs::morph };
+
+            while (! threadShouldExit())
+            {
+                for (auto* id : ids)
+                    processor.parameters.getParameter (id)->setValueNotifyingHost (random.nextFloat());
+
+                wait (1);
+            }
+        }
+
+    private:
+        LofijuicerAudioProcessor& processor;
+    };
+
+    /** Runs a function on a thread of its own, so the processor sees a real audio thread
+        (and takes its audio thread paths, e.g. for program changes). */
+    class AudioThread : public juce::Thread
+    {
+    public:
+        explicit AudioThread (std::function<void()> functionToRun)
+            : juce::Thread ("rtcheck audio"), function (std::move (functionToRun)) {}
+
+        void run() override     { function(); }
+
+    private:
+        std::function<void()> function;
+    };
+
+    struct StepResult
+    {
+        juce::String step;
+        RealtimeViolations violations;
+    };
+
+    /** The check for one precision; everything outside the audio callbacks happens on the
+        same thread, between blocks, with the hooks disarmed. */
+    template <typename SampleType>
+    class Scenario
+    {
+    public:
+        Scenario (LofijuicerAudioProcessor& processorToCheck, double rate, int blockSizeToUse,
+                  const RealtimeCheckSettings& settingsToUse)
+            : processor (processorToCheck), sampleRate (rate), blockSize (blockSizeToUse),
+              settings (settingsToUse), buffer (settingsToUse.numChannels, blockSizeToUse)
+        {
+        }
+
+        juce::Array<StepResult> run()
+        {
+            processor.setPlayHead (&playHead);
+            processor.prepareToPlay (sampleRate, blockSize);
+            processor.getStateInformation (defaultState);
+
+            runStep ("steady", [] (int) {});
+
+            runStep ("parameter sweep", [this] (int)
+            {
+                for (auto* parameter : processor.getParameters())
+                    parameter->setValueNotifyingHost (random.nextFloat());
+            });
+
+            {
+                startStep();
+                AutomationThread automation (processor);
+                automation.startThread();
+
+                for (int block = 0; block < settings.blocksPerStep; ++block)
+                    processNextBlock();
+
+                automation.stopThread (1000);
+                finishStep ("automation");
+            }
+
+            runStep ("program change", [] (int) {}, [this] (int block)
+            {
+                // hosts do this from the audio thread, it goes through the silent path there
+                if (block % 10 == 0)
+                    processor.setCurrentProgram ((block / 10) % processor.getNumPrograms());
+            });
+
+            runStep ("morph", [this] (int block)
+            {
+                if (block == 0)
+                {
+                    processor.presetMorph.capture (0);
+                    setParameter (ParamIDs::cutoff, 0.2f);
+                    setParameter (ParamIDs::chorusVoices, 1.0f);
+                    setParameter (ParamIDs::crushBits, 0.1f);
+                    processor.presetMorph.capture (1);
+                }
+
+                setParameter (ParamIDs::morph, (float) (block % 50) / 49.0f);
+            });
+
+            runStep ("tempo sync", [this] (int block)
+            {
+                if (block == 0)
+                {
+                    setParameter (ParamIDs::lfoSync, 1.0f);
+                    playHead.position.isPlaying = true;
+                    playHead.position.bpm = 128.0;
+                }
+
+                if (block == settings.blocksPerStep / 2)
+                {
+                    playHead.position.bpm = 93.0;
+                    setParameter (ParamIDs::lfoDivision, 0.7f);
+                }
+            });
+
+            playHead.position.resetToDefault();
+
+            runStep ("bypass", [] (int) {}, {}, [] (int block) { return (block / 7) % 2 == 1; });
+
+            {
+                // long enough for the tail to die away and the processor to go idle, then wake it up
+                const double tailSeconds = processor.getTailLengthSeconds();
+                const int tailBlocks = tailSeconds < LofijuicerAudioProcessor::endlessTailSeconds
+                                         ? (int) std::ceil ((tailSeconds + 0.5) * sampleRate / blockSize) : 0;
+                const int numBlocks = settings.blocksPerStep + tailBlocks;
+
+                runStep ("silence", [] (int) {}, {}, {}, [numBlocks] (int block)
+                {
+                    return block > 10 && block < numBlocks - 10;
+                }, numBlocks);
+            }
+
+            {
+                juce::MemoryBlock sweptState;
+
+                for (auto* parameter : processor.getParameters())
+                    parameter->setValueNotifyingHost (random.nextFloat());
+
+                processor.getStateInformation (sweptState);
+
+                runStep ("set state", [this, &sweptState] (int block)
+                {
+                    if (block % 5 == 0)
+                    {
+                        const auto& state = (block / 5) % 2 == 0 ? sweptState : defaultState;
+                        processor.setStateInformation (state.getData(), (int) state.getSize());
+                    }
+                });
+            }
+
+            runStep ("prepare again", [this] (int block)
+            {
+                if (block == 0)
+                {
+                    processor.releaseResources();
+                    processor.prepareToPlay (sampleRate, blockSize);
+                }
+            });
+
+            processor.setPlayHead (nullptr);
+            return results;
+        }
+
+    private:
+        /** Starts a step from the default state, then for every block runs the message thread
+            side, and the audio thread side and the block itself with the hooks armed. */
+        void runStep (const juce::String& name,
+                      std::function<void (int)> betweenBlocks,
+                      std::function<void (int)> onAudioThread = {},
+                      std::function<bool (int)> isBypassed = {},
+                      std::function<bool (int)> isSilent = {},
+                      int numBlocks = -1)
+        {
+            startStep();
+
+            if (numBlocks < 0)
+                numBlocks = settings.blocksPerStep;
+
+            for (int block = 0; block < numBlocks; ++block)
+            {
+                betweenBlocks (block);
+                processNextBlock (onAudioThread ? [&] { onAudioThread (block); } : std::function<void()>(),
+                                  isBypassed && isBypassed (block),
+                                  isSilent && isSilent (block));
+            }
+
+            finishStep (name);
+        }
+
+        void startStep()
+        {
+            processor.setStateInformation (defaultState.getData(), (int) defaultState.getSize());
+            processor.presetMorph.clear();
+            takeViolations();
+        }
+
+        void finishStep (const juce::String& name)
+        {
+            results.add ({ name, takeViolations() });
+        }
+
+        /** One host callback, of a different size each time and never above the prepared size. */
+        void processNextBlock (const std::function<void()>& onAudioThread = {}, bool bypassed = false, bool silent = false)
+        {
+            const int sizes[] = { blockSize, blockSize / 2 + 1, 1, juce::jmax (1, blockSize - 3), blockSize / 3 + 1 };
+            const int numSamples = juce::jmin (blockSize, sizes[blockCount++ % juce::numElementsInArray (sizes)]);
+
+            for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            {
+                auto* data = buffer.getWritePointer (channel);
+
+                for (int i = 0; i < numSamples; ++i)
+                    data[i] = silent ? SampleType() : (SampleType) (random.nextFloat() - 0.5f);
+            }
+
+            juce::AudioBuffer<SampleType> block (buffer.getArrayOfWritePointers(), buffer.getNumChannels(), numSamples);
+
+            {
+                ScopedAudioCallback callback;
+
+                if (onAudioThread)
+                    onAudioThread();
+
+                if (bypassed)
+                    processor.processBlockBypassed (block, midi);
+                else
+                    processor.processBlock (block, midi);
+            }
+
+            playHead.advance (numSamples, sampleRate);
+        }
+
+        void setParameter (const char* id, float normalisedValue)
+        {
+            processor.parameters.getParameter (id)->setValueNotifyingHost (normalisedValue);
+        }
+
+        LofijuicerAudioProcessor& processor;
+        const double sampleRate;
+        const int blockSize;
+        const RealtimeCheckSettings& settings;
+
+        juce::AudioBuffer<SampleType> buffer;
+        juce::MidiBuffer midi;
+        juce::Random random { 0x7e57 };
+        TransportPlayHead playHead;
+        juce::MemoryBlock defaultState;
+        int blockCount = 0;
+        juce::Array<StepResult> results;
+    };
+
+    /** Makes sure the hooks are really in this build, so a clean run means something. */
+    bool hooksAreActive()
+    {
+        static void* volatile probe = nullptr;
+
+        {
+            ScopedAudioCallback callback;
+            probe = std::malloc (16);
+            std::free (probe);
+        }
+
+        return takeViolations().allocations > 0;
+    }
+}
+
+//==============================================================================
+int runRealtimeChecks (const RealtimeCheckSettings& settings)
+{
+    if (! hooksAreActive())
+    {
+        std::printf ("allocation hooks aren't active in this build, nothing can be checked\n");
+        return -1;
+    }
+
+    std::printf ("%9s %6s %5s  %-16s %7s %7s %7s\n", "rate", "block", "bits", "step", "allocs", "frees", "locks");
+
+    int totalViolations = 0;
+
+    for (auto sampleRate : settings.sampleRates)
+    {
+        for (auto blockSize : settings.blockSizes)
+        {
+            for (auto precision : settings.precisions)
+            {
+                const bool doublePrecision = precision == 64;
+
+                std::unique_ptr<juce::AudioProcessor> plugin (createPluginFilter());
+                auto* juicer = dynamic_cast<LofijuicerAudioProcessor*> (plugin.get());
+
+                if (juicer == nullptr)
+                    return -1;
+
+                HostListener hostListener;
+                juicer->addListener (&hostListener);
+                juicer->setPlayConfigDetails (settings.numChannels, settings.numChannels, sampleRate, blockSize);
+
+                // sub-blocks are off by default; the automation steps should go through them too
+                juicer->setMaxSubBlockSize (64);
+                juicer->setProcessingPrecision (doublePrecision ? juce::AudioProcessor::doublePrecision
+                                                                : juce::AudioProcessor::singlePrecision);
+
+                juce::Array<StepResult> results;
+
+                AudioThread audioThread ([&]
+                {
+                    if (doublePrecision)
+                        results = Scenario<double> (*juicer, sampleRate, blockSize, settings).run();
+                    else
+                        results = Scenario<float> (*juicer, sampleRate, blockSize, settings).run();
+                });
+
+                audioThread.startThread();
+                audioThread.waitForThreadToExit (-1);
+                juicer->removeListener (&hostListener);
+
+                for (auto& result : results)
+                {
+                    const auto& violations = result.violations;
+
+                    std::printf ("%9.0f %6d %5d  %-16s %7d %7d %7d%s\n", sampleRate, blockSize, precision,
+                                 result.step.toRawUTF8(), violations.allocations, violations.deallocations,
+                                 violations.locks, violations.total() > 0 ? "  FAIL" : "");
+
+                    totalViolations += violations.total();
+                }
+            }
+        }
+    }
+
+    if (totalViolations == 0)
+        std::printf ("no realtime violations\n");
+    else
+        std::printf ("%d realtime violations\n", totalViolations);
+
+    return totalViolations;
+}
@@ -0,0 +1,41 @@
+/*
+  ==============================================================================
+
+    RealtimeCheck.h
+    Allocation and lock tracking around LofijuicerAudioProcessor's audio callbacks.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/** What the hooks saw on the audio thread while it was inside processBlock. */
+struct RealtimeViolations
+{
+    int allocations = 0;        // malloc / calloc / realloc / operator new
+    int deallocations = 0;      // free / operator delete
+    int locks = 0;              // pthread mutex lock or trylock, including every CriticalSection
+
+    int total() const noexcept  { return allocations + deallocations + locks; }
+};
+
+/** Settings for a realtime check; the whole sequence runs for every sample rate,
+    block size and precision (32 = float, 64 = double processBlock). */
+struct RealtimeCheckSettings
+{
+    juce::Array<double> sampleRates { 44100.0, 96000.0 };
+    juce::Array<int> blockSizes { 64, 512 };
+    juce::Array<int> precisions { 32, 64 };
+    int numChannels = 2;
+    int blocksPerStep = 200;
+};
+
+/** Runs a fresh plugin instance through prepareToPlay, parameter sweeps, automation from
+    a second thread, program changes on the audio thread, morphing, tempo sync, bypass,
+    silence and setStateInformation, with the hooks armed only around the audio callbacks.
+    Prints one line per step and returns the number of violations seen, or -1 if the
+    hooks aren't active in this build. */
+int runRealtimeChecks (const RealtimeCheckSettings& settings);
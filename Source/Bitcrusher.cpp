@@ -0,0 +1,116 @@
+/*
+  ==============================================================================
+
+    Bitcrusher.cpp
+    Bit-depth reduction and sample-and-hold decimation ("lower-fi").
+
+  ==============================================================================
+*/
+
+#include "Bitcrusher.h"
+
+//==============================================================================
+void Bitcrusher::prepare (double sampleRate, int numChannels)
+{
+    fs = sampleRate;
+    numPreparedChannels = numChannels;
+    heldSample.allocate ((size_t) numChannels, true);
+
+    antiAliasFilter.prepare (fs, numChannels, (float) (0.45 * fs), juce::MathConstants<float>::sqrt2 * 0.5f);
+    reset();
+
+    // the filter was just set for no decimation, so the next setParameters() must not skip
+    bitDepth = -1.0f;
+}
+
+void Bitcrusher::reset()
+{
+    holdPhase = 1.0f;                   // take the very first sample
+    juce::FloatVectorOperations::clear (heldSample.get(), numPreparedChannels);
+    antiAliasFilter.reset();
+}
+
+void Bitcrusher::setParameters (float bits, float downsample, bool antiAlias)
+{
+    if (bits == bitDepth && downsample == downsampleFactor && antiAlias == antiAliasEnabled)
+        return;
+
+    bitDepth = bits;
+    downsampleFactor = downsample;
+    antiAliasEnabled = antiAlias;
+    quantizing = bits < 24.0f;
+    quantizeScale = std::exp2 (bits - 1.0f);
+    quantizeInvScale = 1.0f / quantizeScale;
+
+    decimating = downsample > 1.0f;
+    holdIncrement = 1.0f / juce::jmax (1.0f, downsample);
+
+    // Butterworth low-pass just under the new Nyquist, ramped like the main filter
+    filtering = decimating && antiAlias;
+
+    if (filtering)
+        antiAliasFilter.setTargetParameters ((float) (0.45 * fs) * holdIncrement, juce::MathConstants<float>::sqrt2 * 0.5f);
+}
+
+template <typename SampleType>
+void Bitcrusher::process (const juce::dsp::AudioBlock<SampleType>& block)
+{
+    if (! isActive())
+        return;
+
+    const int numChannels = juce::jmin ((int) block.getNumChannels(), numPreparedChannels);
+    const int numSamples = (int) block.getNumSamples();
+
+    if (filtering)
+        antiAliasFilter.process (block);
+
+    // every channel is held on the same clock
+    const float startPhase = holdPhase;
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        SampleType* data = block.getChannelPointer ((size_t) channel);
+
+        if (decimating)
+            sampleAndHold (data, channel, numSamples, startPhase);
+
+        if (quantizing)
+            quantize (data, numSamples);
+    }
+}
+
+//==============================================================================
+template <typename SampleType>
+void Bitcrusher::quantize (SampleType* data, int numSamples) const noexcept
+{
+    // the common depths get their constants baked in
+    if (bitDepth == 16.0f)      quantizeFixed<16> (data, numSamples);
+    else if (bitDepth == 12.0f) quantizeFixed<12> (data, numSamples);
+    else if (bitDepth == 8.0f)  quantizeFixed<8>  (data, numSamples);
+    else                        quantizeWithScale (data, numSamples, (SampleType) quantizeScale, (SampleType) quantizeInvScale);
+}
+
+template <typename SampleType>
+void Bitcrusher::sampleAndHold (SampleType* data, int channel, int numSamples, float startPhase) noexcept
+{
+    const float increment = holdIncrement;
+    float phase = startPhase;
+    SampleType held = (SampleType) heldSample[channel];
+
+    // a new sample is taken each time the phase passes 1, a fractional factor
+    // therefore alternates between hold lengths, which keeps the rate continuous
+    for (int i = 0; i < numSamples; ++i)
+    {
+        phase += increment;
+        const bool take = phase >= 1.0f;
+        phase -= take ? 1.0f : 0.0f;
+        held = take ? data[i] : held;
+        data[i] = held;
+    }
+
+    heldSample[channel] = held;
+    holdPhase = phase;
+}
+
+template void Bitcrusher::process<float> (const juce::dsp::AudioBlock<float>&);
+template void Bitcrusher::process<double> (const juce::dsp::AudioBlock<double>&);
@@ -0,0 +1,86 @@
+/*
+  ==============================================================================
+
+    Bitcrusher.h
+    Bit-depth reduction and sample-and-hold decimation ("lower-fi").
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "SvfLowpass.h"
+
+//==============================================================================
+/**
+    Quantizes to a continuously variable bit depth and holds samples for a
+    continuously variable downsampling factor. An optional low-pass before the
+    sample-and-hold keeps the decimation from folding the top octave down.
+
+    8, 12 and 16 bits use quantizers with compile-time constants; any other depth
+    uses the same loop with a runtime scale. Both are branch-free and vectorize.
+*/
+class Bitcrusher
+{
+public:
+    Bitcrusher() = default;
+
+    void prepare (double sampleRate, int numChannels);
+    void reset();
+
+    /** bits: 2 to 24 (24 = no quantization), downsample: 1 to 32 (1 = no decimation). */
+    void setParameters (float bits, float downsample, bool antiAlias);
+
+    /** True if the current settings change the signal at all. */
+    bool isActive() const noexcept      { return quantizing || decimating; }
+
+    /** The cutoff the anti-alias filter is heading for, in Hz. */
+    float getAntiAliasCutoff() const noexcept   { return antiAliasFilter.getCutoff(); }
+
+    /** Float or double; the held samples are kept in double for either. */
+    template <typename SampleType>
+    void process (const juce::dsp::AudioBlock<SampleType>& block);
+
+private:
+    template <typename SampleType>
+    void quantize (SampleType* data, int numSamples) const noexcept;
+
+    template <typename SampleType>
+    void sampleAndHold (SampleType* data, int channel, int numSamples, float startPhase) noexcept;
+
+    template <int Bits, typename SampleType>
+    static void quantizeFixed (SampleType* data, int numSamples) noexcept
+    {
+        constexpr SampleType scale = (SampleType) (1 << (Bits - 1));
+        quantizeWithScale (data, numSamples, scale, SampleType (1) / scale);
+    }
+
+    template <typename SampleType>
+    static void quantizeWithScale (SampleType* data, int numSamples, SampleType scale, SampleType invScale) noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            // clamp to full scale first: a hot input would overflow the int cast, and the
+            // reducer's range is symmetric anyway. Then round half away from zero, written
+            // as a select so the loop stays vectorizable
+            const SampleType scaled = juce::jlimit (-scale, scale, data[i] * scale);
+            data[i] = (SampleType) (int) (scaled + (scaled >= SampleType (0) ? SampleType (0.5) : SampleType (-0.5))) * invScale;
+        }
+    }
+
+    double fs = 48000.0;
+    int numPreparedChannels = 0;
+
+    float bitDepth = -1.0f, quantizeScale = 1.0f, quantizeInvScale = 1.0f;
+    bool quantizing = false;
+
+    float downsampleFactor = 1.0f;
+    bool antiAliasEnabled = false;
+    float holdIncrement = 1.0f;         // 1 / downsampling factor
+    float holdPhase = 0.0f;
+    bool decimating = false, filtering = false;
+
+    juce::HeapBlock<double> heldSample; // one per channel
+    SvfLowpass antiAliasFilter;
+};
@@ -0,0 +1,185 @@
+/*
+  ==============================================================================
+
+    ChorusEnsemble.cpp
+    Multi-voice chorus read, with the voices computed side by side in SIMD lanes.
+
+  ==============================================================================
+*/
+
+#include "ChorusEnsemble.h"
+
+namespace
+{
+    using Voices = juce::dsp::SIMDRegister<float>;
+    constexpr int lanes = (int) Voices::SIMDNumElements;
+
+    /** Lfo::fastSin for a register of phases (in cycles, 0 to 1). */
+    inline Voices fastSin (Voices cycles) noexcept
+    {
+        const Voices zero (Voices::expand (0.0f));
+        const Voices two (Voices::expand (2.0f));
+
+        const Voices t = cycles - 0.5f;
+        const Voices folded = Voices::expand (0.25f) - Voices::abs (Voices::expand (0.25f) - Voices::abs (t));
+        const Voices x = folded * juce::MathConstants<float>::twoPi;
+        const Voices x2 = x * x;
+
+        const Voices s = x * ((((x2 * (1.0f / 362880.0f) + (-1.0f / 5040.0f)) * x2 + (1.0f / 120.0f)) * x2 + (-1.0f / 6.0f)) * x2 + 1.0f);
+
+        // +1 where t < 0, -1 elsewhere
+        const Voices sign = (two & Voices::lessThan (t, zero)) - 1.0f;
+        return s * sign;
+    }
+}
+
+//==============================================================================
+void ChorusEnsemble::prepare (double sampleRate)
+{
+    static_assert (maxVoices % lanes == 0, "the voices must fill whole registers");
+
+    fs = sampleRate;
+    updateVoices();
+    reset();
+}
+
+void ChorusEnsemble::reset()
+{
+    for (int voice = 0; voice < maxVoices; ++voice)
+        phases[voice] = (float) voice / (float) juce::jmax (1, numVoices);
+}
+
+void ChorusEnsemble::setVoices (int newNumVoices, float detune, float rateHz)
+{
+    newNumVoices = juce::jlimit (1, maxVoices, newNumVoices);
+
+    if (newNumVoices == numVoices && detune == voiceDetune && rateHz == voiceRate)
+        return;
+
+    const bool respread = newNumVoices != numVoices;
+
+    numVoices = newNumVoices;
+    voiceDetune = detune;
+    voiceRate = rateHz;
+    updateVoices();
+
+    if (respread)
+        reset();
+}
+
+void ChorusEnsemble::syncPhases (double cycles) noexcept
+{
+    for (int voice = 0; voice < maxVoices; ++voice)
+    {
+        // the same spread and offset as updateVoices() and reset()
+        const double spread = numVoices > 1 ? (double) voice / (double) (numVoices - 1) - 0.5 : 0.0;
+        const double phase = cycles * (1.0 + voiceDetune * spread) + (double) voice / (double) numVoices;
+        phases[voice] = (float) (phase - std::floor (phase));
+    }
+}
+
+void ChorusEnsemble::updateVoices() noexcept
+{
+    // equal-power sum of the voices
+    const float voiceGain = 1.0f / std::sqrt ((float) numVoices);
+
+    for (int voice = 0; voice < maxVoices; ++voice)
+    {
+        // -0.5 .. 0.5 across the voices
+        const float spread = numVoices > 1 ? (float) voice / (float) (numVoices - 1) - 0.5f : 0.0f;
+
+        increments[voice] = voiceRate * (1.0f + voiceDetune * spread) / (float) fs;
+        laneGains[voice] = voice < numVoices ? voiceGain : 0.0f;
+    }
+}
+
+void ChorusEnsemble::advance (int numSamples) noexcept
+{
+    for (int voice = 0; voice < maxVoices; ++voice)
+    {
+        const float phase = phases[voice] + increments[voice] * (float) numSamples;
+        phases[voice] = phase - std::floor (phase);
+    }
+}
+
+template <typename SampleType>
+void ChorusEnsemble::read (DelayInterpolation interpolation, const SampleType* delayData, int mask, int writePosition,
+                           const float* delayTimeMs, const float* depthMs, SampleType* output, int numSamples,
+                           float channelPhaseOffset, float gain, float minDelay, float maxDelay) const
+{
+    switch (interpolation)
+    {
+        case DelayInterpolation::linear:
+            readVoices<DelayInterpolation::linear> (delayData, mask, writePosition, delayTimeMs, depthMs, output,
+                                                    numSamples, channelPhaseOffset, gain, minDelay, maxDelay);
+            break;
+        case DelayInterpolation::hermite:
+            readVoices<DelayInterpolation::hermite> (delayData, mask, writePosition, delayTimeMs, depthMs, output,
+                                                     numSamples, channelPhaseOffset, gain, minDelay, maxDelay);
+            break;
+        case DelayInterpolation::lagrange:
+            readVoices<DelayInterpolation::lagrange> (delayData, mask, writePosition, delayTimeMs, depthMs, output,
+                                                      numSamples, channelPhaseOffset, gain, minDelay, maxDelay);
+            break;
+    }
+}
+
+//==============================================================================
+template <DelayInterpolation Type, typename SampleType>
+void ChorusEnsemble::readVoices (const SampleType* delayData, int mask, int writePosition,
+                                 const float* delayTimeMs, const float* depthMs, SampleType* output, int numSamples,
+                                 float channelPhaseOffset, float gain, float minDelay, float maxDelay) const
+{
+    const float samplesPerMs = (float) fs / 1000.0f;
+    const int numRegisters = (numVoices + lanes - 1) / lanes;
+
+    alignas (32) float whole[lanes];
+    alignas (32) float taps[4][lanes];
+
+    for (int r = 0; r < numRegisters; ++r)
+    {
+        const int firstVoice = r * lanes;
+
+        const Voices startPhase = Voices::fromRawArray (phases + firstVoice) + channelPhaseOffset;
+        const Voices increment = Voices::fromRawArray (increments + firstVoice);
+        const Voices laneGain = Voices::fromRawArray (laneGains + firstVoice) * gain;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            // every voice's LFO at this sample, wrapped into 0..1
+            Voices phase = startPhase + increment * (float) i;
+            phase = phase - Voices::truncate (phase);
+
+            // delay in samples, clamped to the part of the ring that is safe to read
+            Voices delay = (fastSin (phase) * depthMs[i] + delayTimeMs[i]) * samplesPerMs;
+            delay = Voices::min (Voices::max (delay, Voices::expand (minDelay)), Voices::expand (maxDelay));
+
+            const Voices wholeDelay = Voices::truncate (delay);
+            const Voices fraction = Voices::expand (1.0f) - (delay - wholeDelay);
+
+            // the only per-lane step: gather four taps for each voice
+            wholeDelay.copyToRawArray (whole);
+
+            for (int lane = 0; lane < lanes; ++lane)
+            {
+                const SampleType* x = delayData + ((writePosition + i - (int) whole[lane] - 2) & mask);
+
+                taps[0][lane] = (float) x[0];
+                taps[1][lane] = (float) x[1];
+                taps[2][lane] = (float) x[2];
+                taps[3][lane] = (float) x[3];
+            }
+
+            const Voices y = interpolateTaps<Type> (Voices::fromRawArray (taps[0]), Voices::fromRawArray (taps[1]),
+                                                    Voices::fromRawArray (taps[2]), Voices::fromRawArray (taps[3]),
+                                                    fraction);
+
+            output[i] += (SampleType) (y * laneGain).sum();
+        }
+    }
+}
+
+template void ChorusEnsemble::read<float> (DelayInterpolation, const float*, int, int, const float*, const float*,
+                                           float*, int, float, float, float, float) const;
+template void ChorusEnsemble::read<double> (DelayInterpolation, const double*, int, int, const float*, const float*,
+                                            double*, int, float, float, float, float) const;
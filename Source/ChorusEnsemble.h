@@ -0,0 +1,74 @@
+/*
+  ==============================================================================
+
+    ChorusEnsemble.h
+    Multi-voice chorus read, with the voices computed side by side in SIMD lanes.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "DelayInterpolation.h"
+
+//==============================================================================
+/**
+    Up to maxVoices modulated reads of the chorus delay line, each with its own LFO
+    phase offset and a detuned LFO rate. The voices sit in the lanes of
+    juce::dsp::SIMDRegister<float>, so LFO, delay time and interpolation are done
+    for a whole register of voices at once and only the tap gather is per lane.
+*/
+class ChorusEnsemble
+{
+public:
+    static constexpr int maxVoices = 8;
+
+    ChorusEnsemble() = default;
+
+    void prepare (double sampleRate);
+
+    /** Spreads the voices evenly over the LFO cycle. */
+    void reset();
+
+    /** detune: 0 to 1, spreads the voices' LFO rates by up to +/-50 % around rateHz. */
+    void setVoices (int newNumVoices, float detune, float rateHz);
+    int getNumVoices() const noexcept       { return numVoices; }
+
+    /** How far the voice's LFO moves each sample, in cycles. */
+    float getVoiceIncrement (int voice) const noexcept  { return increments[voice]; }
+
+    /** Adds gain * the mix of all voices for one channel into output.
+        channelPhaseOffset shifts every voice's LFO (0.5 = the opposite side of the cycle).
+        The voices are always mixed in float lanes; a double delay line is read into them. */
+    template <typename SampleType>
+    void read (DelayInterpolation interpolation, const SampleType* delayData, int mask, int writePosition,
+               const float* delayTimeMs, const float* depthMs, SampleType* output, int numSamples,
+               float channelPhaseOffset, float gain, float minDelay, float maxDelay) const;
+
+    /** Moves every voice's LFO on by numSamples, once all channels have been read. */
+    void advance (int numSamples) noexcept;
+
+    /** Sets every voice's phase from the position of the main LFO, in cycles since the start
+        of the song: each voice is where it would be had it run from there at its detuned rate
+        with its usual offset, so the same bars always get the same modulation. */
+    void syncPhases (double cycles) noexcept;
+
+private:
+    /** Recomputes every voice's increment and gain from the current settings and rate. */
+    void updateVoices() noexcept;
+
+    template <DelayInterpolation Type, typename SampleType>
+    void readVoices (const SampleType* delayData, int mask, int writePosition,
+                     const float* delayTimeMs, const float* depthMs, SampleType* output, int numSamples,
+                     float channelPhaseOffset, float gain, float minDelay, float maxDelay) const;
+
+    double fs = 48000.0;
+    int numVoices = 1;
+    float voiceDetune = 0.0f, voiceRate = 0.0f;
+
+    // per voice, padded to a whole number of registers; unused lanes are muted
+    alignas (32) float phases[maxVoices] {};
+    alignas (32) float increments[maxVoices] {};
+    alignas (32) float laneGains[maxVoices] {};
+};
@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    DelayInterpolation.h
+    Fractional-delay read kernels for the chorus delay line.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+enum class DelayInterpolation
+{
+    linear = 0,
+    hermite,            // 4-point, 3rd-order (Catmull-Rom)
+    lagrange            // 4-point, 3rd-order
+};
+
+//==============================================================================
+/** Value between x0 and x1 at fraction t (0 to 1), given the taps either side.
+
+    Written with scalars only on the right of an operator so the same kernels run
+    on plain floats, on doubles and on juce::dsp::SIMDRegister<float> lanes.
+*/
+template <DelayInterpolation Type>
+struct TapInterpolator;
+
+template <>
+struct TapInterpolator<DelayInterpolation::linear>
+{
+    template <typename T>
+    static inline T interpolate (T, T x0, T x1, T, T t)
+    {
+        return x0 + (x1 - x0) * t;
+    }
+};
+
+template <>
+struct TapInterpolator<DelayInterpolation::hermite>
+{
+    template <typename T>
+    static inline T interpolate (T xm1, T x0, T x1, T x2, T t)
+    {
+        const T c1 = (x1 - xm1) * 0.5f;
+        const T c2 = xm1 - x0 * 2.5f + x1 * 2.0f - x2 * 0.5f;
+        const T c3 = (x2 - xm1) * 0.5f + (x0 - x1) * 1.5f;
+
+        return ((c3 * t + c2) * t + c1) * t + x0;
+    }
+};
+
+template <>
+struct TapInterpolator<DelayInterpolation::lagrange>
+{
+    template <typename T>
+    static inline T interpolate (T xm1, T x0, T x1, T x2, T t)
+    {
+        const T tp1 = t + 1.0f;
+        const T tm1 = t - 1.0f;
+        const T tm2 = t - 2.0f;
+
+        return xm1 * (t * tm1 * tm2 * (-1.0f / 6.0f))
+             + x0  * (tp1 * tm1 * tm2 * 0.5f)
+             + x1  * (tp1 * t * tm2 * -0.5f)
+             + x2  * (tp1 * t * tm1 * (1.0f / 6.0f));
+    }
+};
+
+template <DelayInterpolation Type, typename T>
+inline T interpolateTaps (T xm1, T x0, T x1, T x2, T t)
+{
+    return TapInterpolator<Type>::interpolate (xm1, x0, x1, x2, t);
+}
+
+//==============================================================================
+/** Adds gain * the interpolated delay line into output.
+
+    readIndex[i] is the first of four taps (x[-1] .. x[2]) and readFraction[i] the
+    position between the middle two. The delay line must mirror its first three
+    samples past its end, so none of the four taps needs a wrap check.
+
+    The audio is float or double; the fractions stay float, they only steer the read.
+*/
+template <DelayInterpolation Type, typename SampleType>
+inline void readDelayLine (const SampleType* delayData, const int* readIndex, const float* readFraction,
+                           SampleType* output, int numSamples, float gain)
+{
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const SampleType* x = delayData + readIndex[i];
+        output[i] += (SampleType) gain * interpolateTaps<Type> (x[0], x[1], x[2], x[3], (SampleType) readFraction[i]);
+    }
+}
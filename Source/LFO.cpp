@@ -12,20 +12,71 @@
 
 Lfo::Lfo(void)
 {
-    ;
+    this->f0 = 0.0;
+    this->fs = 48000;
+    this->phase = 0.0;
+    this->phase_inc = 0.0;
+    this->output = 0.0;
+    this->output_array = nullptr;
+    this->max_block = 0;
 }
 
 Lfo::~Lfo(void)
 {
-    ;
+    delete[] this->output_array;
 }
 
-void Lfo::initLFO(float freq, int sampleRate)
+void Lfo::initLFO(float freq, int sampleRate, int maxBlockSize)
 {
-    this->f0 = freq;
     this->fs = sampleRate;
     this->phase = 0.0;
-    this->phase_inc = 2 * pi * this->f0 / this->fs;
-    this->output = sin(phase);
+    this->output = 0.0;
+    setFrequency(freq);
+    
+    // only reallocate when the block gets bigger
+    if (maxBlockSize > this->max_block)
+    {
+        delete[] this->output_array;
+        this->output_array = new float[maxBlockSize];
+        this->max_block = maxBlockSize;
+    }
+}
+
+void Lfo::setFrequency(float freq)
+{
+    this->f0 = freq;
+    this->phase_inc = this->f0 / this->fs;
 }
 
+/* Fill output_array with the next numSamples (at most max_block) LFO values */
+void Lfo::processBlock(int numSamples)
+{
+    if (numSamples > this->max_block)
+        numSamples = this->max_block;
+    
+    const float start = this->phase;
+    const float inc = this->phase_inc;
+    float* out = this->output_array;
+    
+    // no loop-carried state, so the compiler can vectorize this
+    for (int i = 0; i < numSamples; i++)
+    {
+        float p = start + (float) i * inc;
+        p -= (float) (int) p;
+        out[i] = fastSin(p);
+    }
+    
+    if (numSamples > 0)
+        this->output = out[numSamples - 1];
+    
+    // advance and wrap the phase once per block
+    this->phase = start + (float) numSamples * inc;
+    this->phase -= floorf(this->phase);
+}
+
+/* Move the phase on by numSamples without computing any values, e.g. while the plugin idles */
+void Lfo::advance(int numSamples)
+{
+    this->phase += (float) numSamples * this->phase_inc;
+    this->phase -= floorf(this->phase);
+}
@@ -9,6 +9,9 @@
 #ifndef _LFO_H_
 #define _LFO_H_
 
+#include <math.h>
+#include <cmath>
+
 #define pi                     3.14159265358979323846
 
 class Lfo
@@ -21,13 +24,34 @@ public:
     // member variables:
     float f0;
     int fs;
-    float phase;
-    float phase_inc;
-    float output;
-    float* output_array;
+    float phase;                // position in the cycle, 0 to 1
+    float phase_inc;            // cycles per sample
+    float output;               // last value written to output_array
+    float* output_array;        // one block of LFO samples, filled by processBlock
+    int max_block;              // number of samples output_array can hold
     
     // member functions:
-    void initLFO(float freq, int sampleRate);
+    void initLFO(float freq, int sampleRate, int maxBlockSize);
+    void setFrequency(float freq);
+    void processBlock(int numSamples);
+    void advance(int numSamples);
+    
+    // sin(2 * pi * cycles) for cycles in [0, 1), polynomial approximation, float or double
+    template <typename T>
+    static inline T fastSin(T cycles)
+    {
+        // sin(2 pi p) = -sin(2 pi t) with t = p - 0.5 in [-0.5, 0.5)
+        // fold t into [-0.25, 0.25] using sin(pi - x) = sin(x), without branches
+        const T t = cycles - T (0.5);
+        const T a = std::abs(t);
+        const T x = (T) (2.0 * pi) * (T (0.25) - std::abs(T (0.25) - a));
+        const T x2 = x * x;
+        
+        // odd Taylor polynomial up to x^9, error below 4e-6 on [0, pi/2]
+        const T s = x * (T (1) + x2 * (T (-1.0 / 6.0) + x2 * (T (1.0 / 120.0) + x2 * (T (-1.0 / 5040.0) + x2 * T (1.0 / 362880.0)))));
+        
+        return std::copysign(s, -t);
+    }
 };
 
 #endif /* _LFO_H_ */
@@ -0,0 +1,98 @@
+/*
+  ==============================================================================
+
+    LevelMeter.cpp
+    Input, post-filter and output meters for the editor.
+
+  ==============================================================================
+*/
+
+#include "LevelMeter.h"
+
+namespace
+{
+    constexpr int refreshRateHz = 30;
+    constexpr float releasePerFrame = 0.85f;    // about 20 dB per second at 30 Hz
+    constexpr float minimumDb = -60.0f;
+
+    float toBarFraction (float gain)
+    {
+        return juce::jlimit (0.0f, 1.0f, 1.0f - juce::Decibels::gainToDecibels (gain, minimumDb) / minimumDb);
+    }
+}
+
+//==============================================================================
+LevelMeter::LevelMeter (MeterFifo& fifoToDrain)
+    : fifo (fifoToDrain)
+{
+    setOpaque (true);
+    fifo.addListener();
+    startTimerHz (refreshRateHz);
+}
+
+LevelMeter::~LevelMeter()
+{
+    stopTimer();
+    fifo.removeListener();
+}
+
+void LevelMeter::timerCallback()
+{
+    MeterLevels latest[numTaps];
+    bool anyFrames = false;
+    MeterFrame frame;
+
+    // keep the loudest of everything that arrived since the last tick
+    while (fifo.pop (frame))
+    {
+        anyFrames = true;
+
+        for (int tap = 0; tap < numTaps; ++tap)
+        {
+            latest[tap].peak = juce::jmax (latest[tap].peak, frame.taps[tap].peak);
+            latest[tap].rms = juce::jmax (latest[tap].rms, frame.taps[tap].rms);
+        }
+    }
+
+    bool changed = false;
+
+    for (int tap = 0; tap < numTaps; ++tap)
+    {
+        auto& shown = displayed[tap];
+        const MeterLevels before = shown;
+
+        shown.peak = juce::jmax (latest[tap].peak, shown.peak * releasePerFrame);
+        shown.rms = juce::jmax (latest[tap].rms, shown.rms * releasePerFrame);
+
+        // let the bars fall to nothing instead of creeping for ever
+        if (! anyFrames && shown.peak < 1.0e-4f)
+            shown = MeterLevels();
+
+        changed = changed || toBarFraction (shown.peak) != toBarFraction (before.peak)
+                          || toBarFraction (shown.rms) != toBarFraction (before.rms);
+    }
+
+    if (changed)
+        repaint();
+}
+
+void LevelMeter::paint (juce::Graphics& g)
+{
+    g.fillAll (juce::Colours::black);
+
+    auto area = getLocalBounds().reduced (2);
+    const int barHeight = juce::jmax (1, (area.getHeight() - (numTaps - 1)) / numTaps);
+
+    for (int tap = 0; tap < numTaps; ++tap)
+    {
+        auto bar = area.removeFromTop (barHeight).toFloat();
+        area.removeFromTop (1);
+
+        const float rmsWidth = bar.getWidth() * toBarFraction (displayed[tap].rms);
+        const float peakX = bar.getX() + bar.getWidth() * toBarFraction (displayed[tap].peak);
+
+        g.setColour (displayed[tap].peak >= 1.0f ? juce::Colours::red : juce::Colours::orange);
+        g.fillRect (bar.withWidth (rmsWidth));
+        g.fillRect (juce::jmax (bar.getX(), peakX - 1.0f), bar.getY(), 1.0f, bar.getHeight());
+    }
+}
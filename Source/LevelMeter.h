@@ -0,0 +1,39 @@
+/*
+  ==============================================================================
+
+    LevelMeter.h
+    Input, post-filter and output meters for the editor.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "Metering.h"
+
+//==============================================================================
+/**
+    Drains the processor's MeterFifo on a timer and draws one horizontal bar per
+    tap: RMS filled, peak as a marker that falls back slowly. Switches the
+    processor's metering on while it exists.
+*/
+class LevelMeter  : public juce::Component,
+                    private juce::Timer
+{
+public:
+    explicit LevelMeter (MeterFifo& fifoToDrain);
+    ~LevelMeter() override;
+
+    void paint (juce::Graphics&) override;
+
+private:
+    void timerCallback() override;
+
+    static constexpr int numTaps = (int) MeterTap::numTaps;
+
+    MeterFifo& fifo;
+    MeterLevels displayed[numTaps];         // what is on screen, with release applied
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LevelMeter)
+};
@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    Metering.cpp
+    Block levels measured on the audio thread and handed to the editor.
+
+  ==============================================================================
+*/
+
+#include "Metering.h"
+
+//==============================================================================
+bool MeterFifo::push (const MeterFrame& frame) noexcept
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite (1, start1, size1, start2, size2);
+
+    if (size1 + size2 < 1)
+        return false;
+
+    frames[size1 > 0 ? start1 : start2] = frame;
+    fifo.finishedWrite (1);
+    return true;
+}
+
+bool MeterFifo::pop (MeterFrame& frame) noexcept
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToRead (1, start1, size1, start2, size2);
+
+    if (size1 + size2 < 1)
+        return false;
+
+    frame = frames[size1 > 0 ? start1 : start2];
+    fifo.finishedRead (1);
+    return true;
+}
+
+template <typename SampleType>
+MeterLevels MeterFifo::measure (const juce::AudioBuffer<SampleType>& buffer, int numChannels) noexcept
+{
+    MeterLevels levels;
+    const int numSamples = buffer.getNumSamples();
+    numChannels = juce::jmin (numChannels, buffer.getNumChannels());
+
+    if (numSamples == 0 || numChannels == 0)
+        return levels;
+
+    double sumOfSquares = 0.0;
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        const SampleType* data = buffer.getReadPointer (channel);
+
+        const auto range = juce::FloatVectorOperations::findMinAndMax (data, numSamples);
+        levels.peak = juce::jmax (levels.peak, (float) -range.getStart(), (float) range.getEnd());
+
+        // a sum per channel in the buffer's precision, accumulated in double across channels
+        SampleType sum = 0;
+
+        for (int i = 0; i < numSamples; ++i)
+            sum += data[i] * data[i];
+
+        sumOfSquares += sum;
+    }
+
+    levels.rms = (float) std::sqrt (sumOfSquares / (double) (numSamples * numChannels));
+    return levels;
+}
+
+MeterLevels MeterFifo::combine (const MeterLevels& first, int firstSamples,
+                                const MeterLevels& second, int secondSamples) noexcept
+{
+    const int totalSamples = firstSamples + secondSamples;
+
+    if (totalSamples <= 0)
+        return first;
+
+    MeterLevels levels;
+    levels.peak = juce::jmax (first.peak, second.peak);
+    levels.rms = std::sqrt ((first.rms * first.rms * (float) firstSamples
+                             + second.rms * second.rms * (float) secondSamples) / (float) totalSamples);
+    return levels;
+}
+
+template MeterLevels MeterFifo::measure<float> (const juce::AudioBuffer<float>&, int) noexcept;
+template MeterLevels MeterFifo::measure<double> (const juce::AudioBuffer<double>&, int) noexcept;
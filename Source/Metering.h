@@ -0,0 +1,77 @@
+/*
+  ==============================================================================
+
+    Metering.h
+    Block levels measured on the audio thread and handed to the editor.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/** Where in the chain a level is taken. */
+enum class MeterTap
+{
+    input = 0,
+    postFilter,
+    output,
+    numTaps
+};
+
+struct MeterLevels
+{
+    float peak = 0.0f;                  // largest absolute sample over all channels
+    float rms = 0.0f;                   // over all channels together
+};
+
+/** One block's levels at every tap. */
+struct MeterFrame
+{
+    MeterLevels taps[(int) MeterTap::numTaps];
+};
+
+//==============================================================================
+/**
+    Single-producer, single-consumer queue of MeterFrames. The audio thread
+    push()es one frame per block and the editor pops them on its timer; neither
+    side locks or allocates. When the editor falls behind, new frames are dropped
+    rather than waiting.
+
+    Measuring only happens while isActive(), which the editor's meter turns on
+    for as long as it exists, so a closed editor costs one atomic load per block.
+*/
+class MeterFifo
+{
+public:
+    static constexpr int capacity = 64;
+
+    MeterFifo() = default;
+
+    void addListener() noexcept         { ++numListeners; }
+    void removeListener() noexcept      { --numListeners; }
+    bool isActive() const noexcept      { return numListeners.load (std::memory_order_relaxed) > 0; }
+
+    /** Audio thread. Returns false if the queue was full and the frame was dropped. */
+    bool push (const MeterFrame& frame) noexcept;
+
+    /** Editor thread. Returns false if there was nothing to read. */
+    bool pop (MeterFrame& frame) noexcept;
+
+    /** Peak and RMS over every sample of the first numChannels channels. */
+    template <typename SampleType>
+    static MeterLevels measure (const juce::AudioBuffer<SampleType>& buffer, int numChannels) noexcept;
+
+    /** Levels of two consecutive stretches of samples taken together. */
+    static MeterLevels combine (const MeterLevels& first, int firstSamples,
+                                const MeterLevels& second, int secondSamples) noexcept;
+
+private:
+    juce::AbstractFifo fifo { capacity };
+    MeterFrame frames[capacity];
+    std::atomic<int> numListeners { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE (MeterFifo)
+};
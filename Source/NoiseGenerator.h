@@ -0,0 +1,100 @@
+/*
+  ==============================================================================
+
+    NoiseGenerator.h
+    Deterministic white noise from several xorshift32 generators run side by side.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    numLanes independent xorshift32 generators stepped together, so fill() has no
+    loop-carried dependency across lanes and the inner loop vectorizes. Each lane
+    is seeded from one 32-bit seed, which makes the output identical on every run
+    for the same seed: offline bounces stay bit-identical.
+*/
+class NoiseGenerator
+{
+public:
+    static constexpr int numLanes = 8;
+
+    NoiseGenerator() noexcept           { seed (0); }
+
+    /** Restarts the sequence. A seed of 0 is fine, it is scrambled before use. */
+    void seed (uint32_t newSeed) noexcept
+    {
+        // splitmix32 spreads one seed over the lanes; xorshift must never start at 0
+        uint32_t z = newSeed;
+
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            z += 0x9e3779b9u;
+            uint32_t x = z;
+            x = (x ^ (x >> 16)) * 0x85ebca6bu;
+            x = (x ^ (x >> 13)) * 0xc2b2ae35u;
+            x ^= x >> 16;
+            state[lane] = x != 0 ? x : 0x6d2b79f5u;
+        }
+
+        position = numLanes;
+    }
+
+    /** Writes numSamples uniform values in [-1, 1). */
+    void fill (float* dest, int numSamples) noexcept
+    {
+        int i = 0;
+
+        // use up values left over from the last call first
+        while (position < numLanes && i < numSamples)
+            dest[i++] = lastValues[position++];
+
+        for (; i + numLanes <= numSamples; i += numLanes)
+            step (dest + i);
+
+        if (i < numSamples)
+        {
+            step (lastValues);
+            position = 0;
+
+            while (i < numSamples)
+                dest[i++] = lastValues[position++];
+        }
+    }
+
+    /** Uniform value in [-1, 1), taken from the same sequence as fill(). */
+    float next() noexcept
+    {
+        if (position >= numLanes)
+        {
+            step (lastValues);
+            position = 0;
+        }
+
+        return lastValues[position++];
+    }
+
+private:
+    void step (float* out) noexcept
+    {
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            uint32_t x = state[lane];
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            state[lane] = x;
+
+            // reinterpret as signed and scale by 2^-31
+            out[lane] = (float) (int32_t) x * (1.0f / 2147483648.0f);
+        }
+    }
+
+    alignas (32) uint32_t state[numLanes] {};
+    alignas (32) float lastValues[numLanes] {};
+    int position = numLanes;
+};
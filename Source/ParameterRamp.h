@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    ParameterRamp.h
+    Linear parameter smoothing that writes a whole block of values at once.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Works like juce::SmoothedValue<float, Linear>, but fill() writes one value per
+    sample for a whole block without a loop-carried dependency, so the ramp
+    vectorizes instead of stepping getNextValue() once per sample.
+*/
+class ParameterRamp
+{
+public:
+    ParameterRamp() = default;
+
+    /** Sets the ramp length and jumps to the current target. */
+    void reset (double sampleRate, double rampLengthSeconds)
+    {
+        rampLength = juce::jmax (0, juce::roundToInt (sampleRate * rampLengthSeconds));
+        setCurrentAndTargetValue (target);
+    }
+
+    void setCurrentAndTargetValue (float newValue)
+    {
+        current = target = newValue;
+        countdown = 0;
+    }
+
+    /** Starts a new ramp from wherever the current one has got to. */
+    void setTargetValue (float newValue)
+    {
+        if (newValue == target)
+            return;
+
+        if (rampLength <= 0)
+        {
+            setCurrentAndTargetValue (newValue);
+            return;
+        }
+
+        target = newValue;
+        countdown = rampLength;
+        step = (target - current) / (float) countdown;
+    }
+
+    bool isSmoothing() const noexcept       { return countdown > 0; }
+    float getCurrentValue() const noexcept  { return current; }
+    float getTargetValue() const noexcept   { return target; }
+
+    /** Writes the next numSamples values and advances the ramp. */
+    void fill (float* dest, int numSamples)
+    {
+        const int rampSamples = juce::jmin (numSamples, countdown);
+        const float start = current;
+        const float increment = step;
+
+        for (int i = 0; i < rampSamples; ++i)
+            dest[i] = start + increment * (float) (i + 1);
+
+        skip (rampSamples);
+
+        if (numSamples > rampSamples)
+            juce::FloatVectorOperations::fill (dest + rampSamples, current, numSamples - rampSamples);
+    }
+
+    /** Advances the ramp without writing anything and returns the new current value. */
+    float skip (int numSamples)
+    {
+        if (numSamples >= countdown)
+        {
+            current = target;
+            countdown = 0;
+        }
+        else
+        {
+            current += step * (float) numSamples;
+            countdown -= numSamples;
+        }
+
+        return current;
+    }
+
+private:
+    float current = 0.0f, target = 0.0f, step = 0.0f;
+    int countdown = 0, rampLength = 0;
+};
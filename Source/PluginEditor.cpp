@@ -11,74 +11,134 @@
 
 #define LOFIJUICER_W        200
 #define LOFIJUICER_H        300
-#define MIN_DEPTH           0.1
-#define MAX_DEPTH           1.0
-#define MIN_DEL             10
-#define MAX_DEL             100
-#define MIN_CUTOFF          50
-#define MAX_CUTOFF          1000
-#define MIN_RES             1.0
-#define MAX_RES             10.0
-#define INIT_DEPTH          0.5
-#define INIT_DEL            25
-#define INIT_CUTOFF         250
-#define INIT_RES            2.5
-#define INC_DEPTH           0.01
-#define INC_DEL             1
-#define INC_CUTOFF          1
-#define INC_RES             0.1
+#define LOFIJUICER_MORPH_H  22
+#define LOFIJUICER_METER_H  20
+
+#if LOFIJUICER_ENABLE_STAGE_TIMING
+ #define LOFIJUICER_PROFILER_H 90
+#else
+ #define LOFIJUICER_PROFILER_H 0
+#endif
 
 //==============================================================================
 LofijuicerAudioProcessorEditor::LofijuicerAudioProcessorEditor (LofijuicerAudioProcessor& p)
-    : AudioProcessorEditor (&p), audioProcessor (p)
+    : AudioProcessorEditor (&p), meter (p.meterFifo),
+     #if LOFIJUICER_ENABLE_STAGE_TIMING
+      profilerPanel (p.stageProfiler),
+     #endif
+      audioProcessor (p)
 {
-    setSize (LOFIJUICER_W, LOFIJUICER_H);
+    // the morph controls and the meters sit in strips under the picture, and the stage timings under them in debug builds
+    setSize (LOFIJUICER_W, LOFIJUICER_H + LOFIJUICER_MORPH_H + LOFIJUICER_METER_H + LOFIJUICER_PROFILER_H);
+    
+    // the background layer covers every pixel, so nothing behind the editor needs repainting
+    setOpaque(true);
     
     // define "CutOff" dial properties
     cutOff.setSliderStyle(juce::Slider::SliderStyle::RotaryVerticalDrag);
-    cutOff.setRange(MIN_CUTOFF, MAX_CUTOFF, INC_CUTOFF);
-    cutOff.setValue(INIT_CUTOFF);
     cutOff.setTextBoxStyle(juce::Slider::NoTextBox, true, 0 , 0);
     cutOff.setPopupDisplayEnabled(true, true, this);
     addAndMakeVisible(&cutOff);
     
     // define "Resonance" dial properties
     res.setSliderStyle(juce::Slider::SliderStyle::RotaryVerticalDrag);
-    res.setRange(MIN_RES, MAX_RES, INC_RES);
-    res.setValue(INIT_RES);
     res.setTextBoxStyle(juce::Slider::NoTextBox, true, 0, 0);
     res.setPopupDisplayEnabled(true, true, this);
     addAndMakeVisible(&res);
     
     // define "Depth" dial properties
     depth.setSliderStyle(juce::Slider::SliderStyle::RotaryVerticalDrag);
-    depth.setRange(MIN_DEPTH, MAX_DEPTH, INC_DEPTH);
-    depth.setValue(INIT_DEPTH);
     depth.setTextBoxStyle(juce::Slider::NoTextBox, true, 0, 0);
     depth.setPopupDisplayEnabled(true, true, this);
     addAndMakeVisible(&depth);
     
     // define "Delay Time" dial properties
     delayTime.setSliderStyle(juce::Slider::SliderStyle::RotaryVerticalDrag);
-    delayTime.setRange(MIN_DEL, MAX_DEL, INC_DEL);
-    delayTime.setValue(INIT_DEL);
     delayTime.setTextBoxStyle(juce::Slider::NoTextBox, true, 0, 0);
-    depth.setPopupDisplayEnabled(true, true, this);
+    delayTime.setPopupDisplayEnabled(true, true, this);
     addAndMakeVisible(&delayTime);
     
-    cutOff.addListener(this);
-    res.addListener(this);
-    depth.addListener(this);
-    delayTime.addListener(this);
+    // morph snapshots, blended by the Morph slider once both are stored; "off" hands the dials back
+    storeA.onClick = [this] { audioProcessor.presetMorph.capture(0); timerCallback(); };
+    storeB.onClick = [this] { audioProcessor.presetMorph.capture(1); timerCallback(); };
+    morphOff.onClick = [this] { audioProcessor.presetMorph.clear(); timerCallback(); };
+    addAndMakeVisible(&storeA);
+    addAndMakeVisible(&storeB);
+    addAndMakeVisible(&morphOff);
+    
+    // define "Morph" slider properties
+    morph.setSliderStyle(juce::Slider::SliderStyle::LinearHorizontal);
+    morph.setTextBoxStyle(juce::Slider::NoTextBox, true, 0, 0);
+    morph.setPopupDisplayEnabled(true, true, this);
+    addAndMakeVisible(&morph);
+    
+    addAndMakeVisible(&meter);
+    
+   #if LOFIJUICER_ENABLE_STAGE_TIMING
+    addAndMakeVisible(&profilerPanel);
+   #endif
+    
+    // ranges, defaults and values come from the processor's parameters
+    cutOffAttachment = std::make_unique<SliderAttachment>(audioProcessor.parameters, ParamIDs::cutoff, cutOff);
+    resAttachment = std::make_unique<SliderAttachment>(audioProcessor.parameters, ParamIDs::resonance, res);
+    depthAttachment = std::make_unique<SliderAttachment>(audioProcessor.parameters, ParamIDs::depth, depth);
+    delayTimeAttachment = std::make_unique<SliderAttachment>(audioProcessor.parameters, ParamIDs::delayTime, delayTime);
+    morphAttachment = std::make_unique<SliderAttachment>(audioProcessor.parameters, ParamIDs::morph, morph);
+    
+    // snapshots can also arrive with a loaded state, so keep polling
+    timerCallback();
+    startTimerHz(10);
 }
 
 LofijuicerAudioProcessorEditor::~LofijuicerAudioProcessorEditor()
 {
+    stopTimer();
+}
+
+void LofijuicerAudioProcessorEditor::timerCallback()
+{
+    const bool storedA = audioProcessor.presetMorph.hasSnapshot(0);
+    const bool storedB = audioProcessor.presetMorph.hasSnapshot(1);
+    
+    const bool morphing = storedA && storedB;
+    
+    storeA.setToggleState(storedA, juce::dontSendNotification);
+    storeB.setToggleState(storedB, juce::dontSendNotification);
+    morph.setEnabled(morphing);
+    morphOff.setEnabled(storedA || storedB);
+    
+    // while the morph drives them, the dials' own values are ignored, so grey them out
+    for (auto* dial : { &cutOff, &res, &depth, &delayTime })
+        dial->setEnabled(! morphing);
 }
 
 //==============================================================================
 void LofijuicerAudioProcessorEditor::paint (juce::Graphics& g)
 {
+    // the layer is drawn at the display's pixel density, and redrawn only when that changes
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    
+    if (scale != backgroundScale || backgroundLayer.isNull())
+        renderBackground(scale);
+    
+    // a dial drag only repaints the dial's bounds, so this is clipped to that area
+    g.drawImageTransformed(backgroundLayer, juce::AffineTransform::scale(1.0f / backgroundScale));
+    
+    // the morph strip has no picture behind it
+    g.setColour(juce::Colours::black);
+    g.fillRect(0, LOFIJUICER_H, LOFIJUICER_W, LOFIJUICER_MORPH_H);
+}
+
+void LofijuicerAudioProcessorEditor::renderBackground (float scale)
+{
+    backgroundScale = scale;
+    backgroundLayer = juce::Image(juce::Image::RGB,
+                                  juce::roundToInt(LOFIJUICER_W * scale),
+                                  juce::roundToInt(LOFIJUICER_H * scale), true);
+    
+    juce::Graphics g (backgroundLayer);
+    g.addTransform(juce::AffineTransform::scale(scale));
+    
     // UI title area
     juce::Rectangle<int> titleArea(0, 10, LOFIJUICER_W, 20);
     
@@ -92,20 +152,17 @@ void LofijuicerAudioProcessorEditor::paint (juce::Graphics& g)
     g.setFont (juce::Font("Avenir", 30.0, juce::Font::bold));
     g.drawText("lo-fi JUICER", titleArea, juce::Justification::centredTop);
     
-    // lower-fi text
+    // lower-fi text, and the other labels in the same font
     g.setFont (juce::Font("Avenir", 15.0, juce::Font::plain));
     g.drawText("lower-fi", 32.5, 130, 50, 25, juce::Justification::centredLeft);
     
     // broken text
-    g.setFont (juce::Font("Avenir", 15.0, juce::Font::plain));
     g.drawText("broken", 132.5, 130, 50, 25, juce::Justification::centredLeft);
     
     // cutoff text
-    g.setFont (juce::Font("Avenir", 15.0, juce::Font::plain));
     g.drawText("mood", 35, 180, 50, 25, juce::Justification::centredLeft);
     
     // res text
-    g.setFont (juce::Font("Avenir", 15.0, juce::Font::plain));
     g.drawText("spice", 135, 180, 50, 25, juce::Justification::centredLeft);
     
 }
@@ -116,27 +173,15 @@ void LofijuicerAudioProcessorEditor::resized()
     res.setBounds(LOFIJUICER_W / 2, 180, LOFIJUICER_W / 2, LOFIJUICER_H / 2);
     depth.setBounds(0, 20, LOFIJUICER_W / 2, LOFIJUICER_H / 2);
     delayTime.setBounds(LOFIJUICER_W / 2, 20, LOFIJUICER_W / 2, LOFIJUICER_H / 2);
-}
-
-void LofijuicerAudioProcessorEditor::sliderValueChanged (juce::Slider* slider)
-{
-    if (slider == &depth)
-    {
-        audioProcessor.depth = depth.getValue();
-    }
-    
-    if (slider == &delayTime)
-    {
-        audioProcessor.delayTime = delayTime.getValue();
-    }
-    
-    if (slider == &cutOff)
-    {
-        audioProcessor.cutoff = cutOff.getValue();
-    }
-    
-    if (slider == &res)
-    {
-        audioProcessor.resonance = res.getValue();
-    }
+    meter.setBounds(0, LOFIJUICER_H + LOFIJUICER_MORPH_H, LOFIJUICER_W, LOFIJUICER_METER_H);
+    
+   #if LOFIJUICER_ENABLE_STAGE_TIMING
+    profilerPanel.setBounds(0, LOFIJUICER_H + LOFIJUICER_MORPH_H + LOFIJUICER_METER_H, LOFIJUICER_W, LOFIJUICER_PROFILER_H);
+   #endif
+    
+    // A, the morph slider, B and off, in a row
+    storeA.setBounds(2, LOFIJUICER_H + 2, 20, 18);
+    morph.setBounds(24, LOFIJUICER_H + 2, LOFIJUICER_W - 76, 18);
+    storeB.setBounds(LOFIJUICER_W - 50, LOFIJUICER_H + 2, 20, 18);
+    morphOff.setBounds(LOFIJUICER_W - 28, LOFIJUICER_H + 2, 26, 18);
 }
@@ -10,12 +10,14 @@
 
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
+#include "LevelMeter.h"
+#include "StageProfilerPanel.h"
 
 //==============================================================================
 /**
 */
 class LofijuicerAudioProcessorEditor  : public juce::AudioProcessorEditor,
-                                        public juce::Slider::Listener
+                                        private juce::Timer
 {
 public:
     LofijuicerAudioProcessorEditor (LofijuicerAudioProcessor&);
@@ -24,15 +26,43 @@ public:
     //==============================================================================
     void paint (juce::Graphics&) override;
     void resized() override;
-    void sliderValueChanged (juce::Slider* slider) override;
 
 private:
+    // lights the stored snapshot buttons, and hands the dials over to the morph slider once both are stored
+    void timerCallback() override;
+    
+    // draws the background picture and the labels, which never change, at the given scale
+    void renderBackground (float scale);
+    
+    juce::Image backgroundLayer;                // background and labels, at backgroundScale physical pixels per point
+    float backgroundScale { 0.0f };
+    
     juce::Slider cutOff;
     juce::Slider res;
     
     juce::Slider depth;
     juce::Slider delayTime;
     
+    // store the current settings as morph snapshot A or B, blend between them, or drop both
+    juce::TextButton storeA { "A" };
+    juce::TextButton storeB { "B" };
+    juce::Slider morph;
+    juce::TextButton morphOff { "off" };
+    
+    LevelMeter meter;                           // input, post-filter and output, top to bottom
+    
+   #if LOFIJUICER_ENABLE_STAGE_TIMING
+    StageProfilerPanel profilerPanel;           // under the meters, where stage timing is built in
+   #endif
+    
+    // keep the dials and the processor's parameters in sync, in both directions
+    using SliderAttachment = juce::AudioProcessorValueTreeState::SliderAttachment;
+    std::unique_ptr<SliderAttachment> cutOffAttachment;
+    std::unique_ptr<SliderAttachment> resAttachment;
+    std::unique_ptr<SliderAttachment> depthAttachment;
+    std::unique_ptr<SliderAttachment> delayTimeAttachment;
+    std::unique_ptr<SliderAttachment> morphAttachment;
+    
     // This reference is provided as a quick way for your editor to
     // access the processor object that created it.
     LofijuicerAudioProcessor& audioProcessor;
@@ -24,11 +24,186 @@ LofijuicerAudioProcessor::LofijuicerAudioProcessor()
                      #endif
                        )
 #endif
+     , parameters (*this, nullptr, juce::Identifier ("LofiJuicer"), createParameterLayout())
+     , presetMorph (parameters)
+     , programBank (*this, parameters)
 {
+    depthParameter = parameters.getRawParameterValue (ParamIDs::depth);
+    delayTimeParameter = parameters.getRawParameterValue (ParamIDs::delayTime);
+    cutoffParameter = parameters.getRawParameterValue (ParamIDs::cutoff);
+    resonanceParameter = parameters.getRawParameterValue (ParamIDs::resonance);
+    interpolationParameter = parameters.getRawParameterValue (ParamIDs::interpolation);
+    chorusVoicesParameter = parameters.getRawParameterValue (ParamIDs::chorusVoices);
+    chorusDetuneParameter = parameters.getRawParameterValue (ParamIDs::chorusDetune);
+    oversamplingParameter = parameters.getRawParameterValue (ParamIDs::oversampling);
+    oversamplingQualityParameter = parameters.getRawParameterValue (ParamIDs::oversamplingQuality);
+    crushBitsParameter = parameters.getRawParameterValue (ParamIDs::crushBits);
+    crushDownsampleParameter = parameters.getRawParameterValue (ParamIDs::crushDownsample);
+    crushAntiAliasParameter = parameters.getRawParameterValue (ParamIDs::crushAntiAlias);
+    saturationParameter = parameters.getRawParameterValue (ParamIDs::saturation);
+    saturationDriveParameter = parameters.getRawParameterValue (ParamIDs::saturationDrive);
+    saturationCurveParameter = parameters.getRawParameterValue (ParamIDs::saturationCurve);
+    wowParameter = parameters.getRawParameterValue (ParamIDs::wow);
+    flutterParameter = parameters.getRawParameterValue (ParamIDs::flutter);
+    hissParameter = parameters.getRawParameterValue (ParamIDs::hiss);
+    crackleParameter = parameters.getRawParameterValue (ParamIDs::crackle);
+    morphParameter = parameters.getRawParameterValue (ParamIDs::morph);
+    phaseSpreadParameter = parameters.getRawParameterValue (ParamIDs::phaseSpread);
+    lfoRateParameter = parameters.getRawParameterValue (ParamIDs::lfoRate);
+    lfoSyncParameter = parameters.getRawParameterValue (ParamIDs::lfoSync);
+    lfoDivisionParameter = parameters.getRawParameterValue (ParamIDs::lfoDivision);
+    
+    // any change, from the host or the editor, marks the parameters for the next sub-block
+    for (auto* parameter : getParameters())
+    {
+        auto* withID = dynamic_cast<juce::AudioProcessorParameterWithID*> (parameter);
+        parameterStages.push_back (withID != nullptr ? getParameterStages (withID->paramID) : PresetMorph::allStages);
+        parameter->addListener (this);
+    }
+    
+    startTimerHz (10);
 }
 
 LofijuicerAudioProcessor::~LofijuicerAudioProcessor()
 {
+    stopTimer();
+    
+    for (auto* parameter : getParameters())
+        parameter->removeListener (this);
+}
+
+void LofijuicerAudioProcessor::parameterValueChanged (int parameterIndex, float)
+{
+    if (juce::isPositiveAndBelow (parameterIndex, (int) parameterStages.size()))
+        changedStages.fetch_or(parameterStages[(size_t) parameterIndex]);
+    
+    parametersChanged.store(true);
+}
+
+uint32_t LofijuicerAudioProcessor::getParameterStages (const juce::String& parameterID)
+{
+    if (parameterID == ParamIDs::depth || parameterID == ParamIDs::delayTime || parameterID == ParamIDs::interpolation)
+        return PresetMorph::chorusStage;
+    
+    if (parameterID == ParamIDs::chorusVoices || parameterID == ParamIDs::chorusDetune)
+        return PresetMorph::ensembleStage;
+    
+    if (parameterID == ParamIDs::cutoff || parameterID == ParamIDs::resonance)
+        return PresetMorph::filterStage;
+    
+    if (parameterID == ParamIDs::crushBits || parameterID == ParamIDs::crushDownsample || parameterID == ParamIDs::crushAntiAlias)
+        return PresetMorph::crusherStage;
+    
+    if (parameterID == ParamIDs::saturation || parameterID == ParamIDs::saturationDrive || parameterID == ParamIDs::saturationCurve)
+        return PresetMorph::saturatorStage;
+    
+    if (parameterID == ParamIDs::wow || parameterID == ParamIDs::flutter)
+        return PresetMorph::wowFlutterStage;
+    
+    if (parameterID == ParamIDs::hiss || parameterID == ParamIDs::crackle)
+        return PresetMorph::noiseStage;
+    
+    // the morph sweeps its stages itself, oversampling and the LFO settings are read every block
+    if (parameterID == ParamIDs::morph || parameterID == ParamIDs::oversampling || parameterID == ParamIDs::oversamplingQuality
+         || parameterID == ParamIDs::phaseSpread || parameterID == ParamIDs::lfoRate || parameterID == ParamIDs::lfoSync
+         || parameterID == ParamIDs::lfoDivision)
+        return 0;
+    
+    return PresetMorph::allStages;
+}
+
+void LofijuicerAudioProcessor::setMaxSubBlockSize (int numSamples)
+{
+    maxSubBlockSize.store(juce::jmax(0, numSamples));
+}
+
+template <>
+LofijuicerAudioProcessor::PrecisionState<float>& LofijuicerAudioProcessor::getPrecisionState<float>() noexcept
+{
+    return floatState;
+}
+
+template <>
+LofijuicerAudioProcessor::PrecisionState<double>& LofijuicerAudioProcessor::getPrecisionState<double>() noexcept
+{
+    return doubleState;
+}
+
+juce::AudioProcessorValueTreeState::ParameterLayout LofijuicerAudioProcessor::createParameterLayout()
+{
+    juce::AudioProcessorValueTreeState::ParameterLayout layout;
+    
+    // bitcrusher, off at 24 bits and no downsampling
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::crushBits, "Bit Depth",
+                                                             juce::NormalisableRange<float> (2.0f, 24.0f, 0.01f), 24.0f,
+                                                             "bits"));
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::crushDownsample, "Downsample",
+                                                             juce::NormalisableRange<float> (1.0f, 32.0f, 0.01f, 0.4f), 1.0f,
+                                                             "x"));
+    layout.add (std::make_unique<juce::AudioParameterBool> (ParamIDs::crushAntiAlias, "Downsample Anti-alias", true));
+    
+    // chorus ("lower-fi" / "broken")
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::depth, "Depth",
+                                                             juce::NormalisableRange<float> (0.1f, 1.0f, 0.01f), 0.5f,
+                                                             "ms"));
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::delayTime, "Delay Time",
+                                                             juce::NormalisableRange<float> (10.0f, 100.0f, 1.0f), 25.0f,
+                                                             "ms"));
+    layout.add (std::make_unique<juce::AudioParameterChoice> (ParamIDs::interpolation, "Interpolation",
+                                                              juce::StringArray { "Linear", "Hermite", "Lagrange" }, 1));
+    
+    // LFO phase difference between the first and the last channel, in cycles; the others are spaced evenly
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::phaseSpread, "LFO Phase Spread",
+                                                             juce::NormalisableRange<float> (0.0f, 1.0f, 0.01f), 0.5f));
+    
+    // the chorus LFO, free-running or locked to the host's tempo and song position
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::lfoRate, "LFO Rate",
+                                                             juce::NormalisableRange<float> (0.05f, 10.0f, 0.01f, 0.4f), 1.0f,
+                                                             "Hz"));
+    layout.add (std::make_unique<juce::AudioParameterBool> (ParamIDs::lfoSync, "LFO Tempo Sync", false));
+    layout.add (std::make_unique<juce::AudioParameterChoice> (ParamIDs::lfoDivision, "LFO Sync Rate",
+                                                              TempoSync::getDivisionNames(), TempoSync::quarterNoteDivision));
+    
+    layout.add (std::make_unique<juce::AudioParameterInt> (ParamIDs::chorusVoices, "Voices", 1, ChorusEnsemble::maxVoices, 1));
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::chorusDetune, "Voice Detune",
+                                                             juce::NormalisableRange<float> (0.0f, 1.0f, 0.01f), 0.3f));
+    
+    // low-pass filter ("mood" / "spice")
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::cutoff, "Cutoff",
+                                                             juce::NormalisableRange<float> (50.0f, 1000.0f, 1.0f), 250.0f,
+                                                             "Hz"));
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::resonance, "Resonance",
+                                                             juce::NormalisableRange<float> (1.0f, 10.0f, 0.1f), 2.5f));
+    
+    // saturation after the filter
+    layout.add (std::make_unique<juce::AudioParameterBool> (ParamIDs::saturation, "Saturation", false));
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::saturationDrive, "Drive",
+                                                             juce::NormalisableRange<float> (0.0f, 24.0f, 0.1f), 6.0f,
+                                                             "dB"));
+    layout.add (std::make_unique<juce::AudioParameterChoice> (ParamIDs::saturationCurve, "Saturation Curve",
+                                                              juce::StringArray { "Tanh", "Tape", "Diode" }, 1));
+    
+    // tape transport drift on the chorus read, and record surface noise on the output
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::wow, "Wow",
+                                                             juce::NormalisableRange<float> (0.0f, 1.0f, 0.01f), 0.0f));
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::flutter, "Flutter",
+                                                             juce::NormalisableRange<float> (0.0f, 1.0f, 0.01f), 0.0f));
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::hiss, "Hiss",
+                                                             juce::NormalisableRange<float> (0.0f, 1.0f, 0.01f), 0.0f));
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::crackle, "Crackle",
+                                                             juce::NormalisableRange<float> (0.0f, 1.0f, 0.01f), 0.0f));
+    
+    // blend from snapshot A to B, does nothing until both are stored
+    layout.add (std::make_unique<juce::AudioParameterFloat> (ParamIDs::morph, "Morph",
+                                                             juce::NormalisableRange<float> (0.0f, 1.0f), 0.0f));
+    
+    // oversampling around the filter and saturation: IIR for low latency while tracking, FIR for linear phase at mixdown
+    layout.add (std::make_unique<juce::AudioParameterChoice> (ParamIDs::oversampling, "Oversampling",
+                                                              juce::StringArray { "1x", "2x", "4x", "8x" }, 0));
+    layout.add (std::make_unique<juce::AudioParameterChoice> (ParamIDs::oversamplingQuality, "Oversampling Filter",
+                                                              juce::StringArray { "Polyphase IIR", "Linear-phase FIR" }, 0));
+    
+    return layout;
 }
 
 //==============================================================================
@@ -66,27 +241,85 @@ bool LofijuicerAudioProcessor::isMidiEffect() const
 
 double LofijuicerAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    // hiss and crackle never stop on their own; only JUCE 6.1's VST3 wrapper turns infinity into
+    // kInfiniteTail, older ones and the other formats would convert it to samples
+    if (hissParameter->load() > 0.0f || crackleParameter->load() > 0.0f)
+    {
+       #if JUCE_VERSION >= 0x60100
+        if (wrapperType == wrapperType_VST3)
+            return std::numeric_limits<double>::infinity();
+       #endif
+        return endlessTailSeconds;
+    }
+    
+    // the oversampling delays the last of the tail by its latency
+    const double fs = getSampleRate();
+    const double latencySeconds = fs > 0.0 ? getLatencySamples() / fs : 0.0;
+    
+    return getChainTailSeconds() + latencySeconds;
+}
+
+/* The filter rings down first, then the last of it leaves the chorus delay line */
+double LofijuicerAudioProcessor::getChainTailSeconds() const
+{
+    // the SVF's impulse response decays as exp(-pi * cutoff * t / resonance)
+    const double cutoff = cutoffParameter->load();
+    const double resonance = resonanceParameter->load();
+    const double filterSeconds = (-tailFloorDb / 20.0) * std::log(10.0) * resonance / (pi * cutoff);
+    
+    // the chorus adds nothing back into its delay line, so it is silent after its longest delay
+    const bool wowOrFlutter = wowParameter->load() > 0.0f || flutterParameter->load() > 0.0f;
+    const double delayMs = delayTimeParameter->load() + depthParameter->load()
+                         + (wowOrFlutter ? WowFlutter::maxOffsetMs : 0.0f);
+    
+    return filterSeconds + delayMs / 1000.0;
 }
 
 int LofijuicerAudioProcessor::getNumPrograms()
 {
-    return 1;   // NB: some hosts don't cope very well if you tell them there are 0 programs,
-                // so this should be at least 1, even if you're not really implementing programs.
+    return programBank.getNumPrograms();
 }
 
 int LofijuicerAudioProcessor::getCurrentProgram()
 {
-    return 0;
+    return currentProgram.load();
 }
 
 void LofijuicerAudioProcessor::setCurrentProgram (int index)
 {
+    if (! juce::isPositiveAndBelow (index, programBank.getNumPrograms()))
+        return;
+    
+    currentProgram.store (index);
+    
+    if (juce::MessageManager::existsAndIsCurrentThread())
+    {
+        programBank.applyNotifyingHost (index);
+        return;
+    }
+    
+    // probably the audio thread: store the values without locking, the timer tells everyone later
+    programBank.applySilently (index);
+    programNeedsAnnouncing.store (true);
+}
+
+void LofijuicerAudioProcessor::timerCallback()
+{
+    if (programNeedsAnnouncing.exchange (false))
+    {
+        programBank.announce();
+        updateHostDisplay();
+    }
+    
+    const int latency = pendingLatency.exchange (-1);
+    
+    if (latency >= 0)
+        setLatencySamples (latency);
 }
 
 const juce::String LofijuicerAudioProcessor::getProgramName (int index)
 {
-    return {};
+    return programBank.getName (index);
 }
 
 void LofijuicerAudioProcessor::changeProgramName (int index, const juce::String& newName)
@@ -100,41 +333,353 @@ void LofijuicerAudioProcessor::prepareToPlay (double sampleRate, int samplesPerB
     
     // set local variables
     fs = sampleRate;
+    maxBlockSize = samplesPerBlock;
+    
+    /* initialize the bitcrusher */
+    
+    bitcrusher.prepare(fs, getTotalNumOutputChannels());
     
     /* initialize the filter */
     
-    // set up filter
-    juce::dsp::ProcessSpec spec;
-    spec.sampleRate = fs;
-    spec.maximumBlockSize = samplesPerBlock;
-    spec.numChannels = getMainBusNumOutputChannels();
+    // the filter starts on the current parameter values, ramps only begin once they move
+    cutoffRamp.reset(fs, 0.05);
+    resonanceRamp.reset(fs, 0.05);
+    cutoffRamp.setCurrentAndTargetValue(cutoffParameter->load());
+    resonanceRamp.setCurrentAndTargetValue(resonanceParameter->load());
     
-    stateVariableFilter.reset();             // get rid of potential garbage values
-    stateVariableFilter.prepare(spec);
+    stateVariableFilter.prepare(fs, getTotalNumOutputChannels(), cutoffRamp.getCurrentValue(), resonanceRamp.getCurrentValue());
     
+    // saturation runs next to the filter, at up to 8x the host block
+    saturator.setDrive(saturationDriveParameter->load());
+    saturator.prepare(fs, getTotalNumOutputChannels(), samplesPerBlock * 8);
     
     /* initialize the delay buffer */
     
-    // allow access to audio being played 4 second ago
-    const int delayBufferSize = 4 * (sampleRate + samplesPerBlock);
-    // set the delay buffer size
-    thisDelayBuffer.setSize(numInputChannels, delayBufferSize);
-    thisDelayBuffer.clear();                // get rid of potential garbage values
+    // initialize LFO first, its block size sets how far the chorus writes ahead per chunk;
+    // with tempo sync the first block sets the real rate and phase
+    lfoRate = lfoRateParameter->load();
+    lfo.initLFO(lfoRate, fs, samplesPerBlock);
+    wowFlutter.setDepths(wowParameter->load(), flutterParameter->load());   // prepare jumps straight to these
+    wowFlutter.prepare(fs, lfo.max_block);
+    
+    // longest delay the knobs can reach, plus one block of writes and the interpolation taps
+    const float maxDelayMs = parameters.getParameterRange(ParamIDs::delayTime).end
+                           + parameters.getParameterRange(ParamIDs::depth).end
+                           + WowFlutter::maxOffsetMs;
+    const int maxDelaySamples = (int) std::ceil(maxDelayMs * sampleRate / 1000.0);
+    
+    // round up to a power of two so positions wrap with a mask
+    const int delayBufferSize = juce::nextPowerOfTwo(maxDelaySamples + lfo.max_block + delayGuard + 1);
+    delayBufferMask = delayBufferSize - 1;
+    thisWritePosition = 0;
+    
+    // the delay line and every oversampler, in the precision the host will call us in;
+    // the delay buffer gets the mirrored samples the interpolation reads past the end
+    if (isUsingDoublePrecision())
+    {
+        floatState.release();
+        doubleState.prepare(numInputChannels, delayBufferSize + delayGuard, getTotalNumOutputChannels(), samplesPerBlock);
+    }
+    else
+    {
+        doubleState.release();
+        floatState.prepare(numInputChannels, delayBufferSize + delayGuard, getTotalNumOutputChannels(), samplesPerBlock);
+    }
+    
+    oversamplingFactor = oversamplingQuality = -1;
+    updateOversampling();
+    setLatencySamples(pendingLatency.exchange(-1));
+    
+    // a bypass the host set before preparing takes effect straight away
+    bypassRamp.reset(fs, bypassFadeSeconds);
+    bypassRamp.setCurrentAndTargetValue(bypassed ? 1.0f : 0.0f);
+    bypassTailRemaining = 0;
+    bypassWetGains.allocate(samplesPerBlock, true);
+    bypassDryGains.allocate(samplesPerBlock, true);
+    
+    // start out processing, silence has to be seen again before blocks are skipped
+    silentInputSamples = 0;
+    outputFellSilent = idle = false;
+    
+    // per-sample read positions and parameter values, one LFO block at a time
+    delayReadIndex.allocate(lfo.max_block, true);
+    delayReadFraction.allocate(lfo.max_block, true);
+    depthValues.allocate(lfo.max_block, true);
+    delayTimeValues.allocate(lfo.max_block, true);
+    channelModulation.allocate(lfo.max_block, true);
+    ensemble.prepare(fs);
     
-    // initialize LFO
-    lfo.initLFO(lfoRate, fs);
+    // start the smoothing from wherever the parameters are now
+    depthRamp.reset(fs, 0.05);
+    delayTimeRamp.reset(fs, 0.05);
+    depthRamp.setCurrentAndTargetValue(depthParameter->load());
+    delayTimeRamp.setCurrentAndTargetValue(delayTimeParameter->load());
     
+    morphRamp.reset(fs, 0.05);
+    morphRamp.setCurrentAndTargetValue(morphParameter->load());
+    morphPosition = morphRamp.getCurrentValue();
+    
+    // noise generators are reseeded here, so every bounce starts from the same sequence
+    vinylNoise.prepare(fs, getTotalNumOutputChannels(), samplesPerBlock);
+    
+    // the first block hands every stage its settings
+    changedStages.store(PresetMorph::allStages);
 }
 
-void LofijuicerAudioProcessor::updateFilter()
+/* Only recompute the filter coefficients while cutoff or resonance are moving */
+void LofijuicerAudioProcessor::updateFilter(int numSamples)
 {
-    stateVariableFilter.state->type = juce::dsp::StateVariableFilter::Parameters<float>::Type::lowPass;
-    stateVariableFilter.state->setCutOffFrequency(fs, cutoff, resonance);
+    if (! cutoffRamp.isSmoothing() && ! resonanceRamp.isSmoothing())
+        return;
+    
+    // the filter ramps its coefficients per sample towards the values reached at the end of the block
+    const float cutoff = cutoffRamp.skip(numSamples);
+    const float resonance = resonanceRamp.skip(numSamples);
+    
+    stateVariableFilter.setTargetParameters(cutoff, resonance);
 }
 
+/* Switch to the oversampler the parameters ask for, and queue its latency for the host */
+void LofijuicerAudioProcessor::updateOversampling()
+{
+    const int factor = juce::roundToInt(oversamplingParameter->load());
+    const int quality = juce::roundToInt(oversamplingQualityParameter->load());
+    
+    if (factor == oversamplingFactor && quality == oversamplingQuality)
+        return;
+    
+    oversamplingFactor = factor;
+    oversamplingQuality = quality;
+    floatState.selectOversampler(factor, quality);
+    doubleState.selectOversampler(factor, quality);
+    
+    // the filter and saturation run at the oversampled rate
+    stateVariableFilter.setSampleRate(fs * (1 << factor));
+    saturator.setSampleRate(fs * (1 << factor));
+    
+    // only the state for the current precision is built, the other reports no latency;
+    // setLatencySamples calls into the host's listeners, so outside prepareToPlay the timer does it
+    pendingLatency.store(juce::jmax(floatState.latencySamples, doubleState.latencySamples));
+}
+
+//==============================================================================
+template <typename SampleType>
+void LofijuicerAudioProcessor::PrecisionState<SampleType>::prepare(int numDelayChannels, int delayBufferSamples, int numOversampledChannels, int maxBlockSize)
+{
+    delayBuffer.setSize(numDelayChannels, delayBufferSamples);
+    delayBuffer.clear();                    // get rid of potential garbage values
+    
+    int maxLatency = 0;
+    
+    for (int quality = 0; quality < 2; quality++)
+    {
+        const auto filterType = quality == 0 ? juce::dsp::Oversampling<SampleType>::filterHalfBandPolyphaseIIR
+                                             : juce::dsp::Oversampling<SampleType>::filterHalfBandFIREquiripple;
+        
+        for (int factor = 1; factor <= 3; factor++)
+        {
+            auto& oversampler = oversamplers[quality][factor - 1];
+            oversampler = std::make_unique<juce::dsp::Oversampling<SampleType>>((size_t) numOversampledChannels, (size_t) factor, filterType, true, true);
+            oversampler->initProcessing((size_t) maxBlockSize);
+            
+            maxLatency = juce::jmax(maxLatency, juce::roundToInt(oversampler->getLatencyInSamples()));
+        }
+    }
+    
+    activeOversampler = nullptr;
+    latencySamples = 0;
+    
+    // sized for every oversampler, so a bypass never allocates whatever the setting
+    dryDelay.setSize(numOversampledChannels, juce::nextPowerOfTwo(maxLatency + 1));
+    dryDelay.clear();
+    dryDelayPosition = 0;
+    dryBuffer.setSize(numOversampledChannels, maxBlockSize);
+    noiseBuffer.setSize(numOversampledChannels, maxBlockSize);
+}
+
+template <typename SampleType>
+void LofijuicerAudioProcessor::PrecisionState<SampleType>::release()
+{
+    delayBuffer.setSize(0, 0);
+    dryDelay.setSize(0, 0);
+    dryBuffer.setSize(0, 0);
+    noiseBuffer.setSize(0, 0);
+    
+    for (auto& row : oversamplers)
+        for (auto& oversampler : row)
+            oversampler.reset();
+    
+    activeOversampler = nullptr;
+    latencySamples = 0;
+}
+
+template <typename SampleType>
+void LofijuicerAudioProcessor::PrecisionState<SampleType>::selectOversampler(int factor, int quality)
+{
+    activeOversampler = factor > 0 ? oversamplers[quality][factor - 1].get() : nullptr;
+    latencySamples = 0;
+    
+    if (activeOversampler != nullptr)
+    {
+        activeOversampler->reset();
+        latencySamples = juce::roundToInt(activeOversampler->getLatencyInSamples());
+    }
+}
+
+template <typename SampleType>
+void LofijuicerAudioProcessor::PrecisionState<SampleType>::delayDry(const juce::AudioBuffer<SampleType>& source, int numSamples, bool writeOutput)
+{
+    const int numChannels = juce::jmin(source.getNumChannels(), dryDelay.getNumChannels());
+    const int mask = dryDelay.getNumSamples() - 1;
+    const int position = dryDelayPosition;
+    const int latency = latencySamples;
+    
+    for (int channel = 0; channel < numChannels; channel++)
+    {
+        const SampleType* input = source.getReadPointer(channel);
+        SampleType* ring = dryDelay.getWritePointer(channel);
+        
+        for (int i = 0; i < numSamples; i++)
+            ring[(position + i) & mask] = input[i];
+        
+        if (! writeOutput)
+            continue;
+        
+        SampleType* output = dryBuffer.getWritePointer(channel);
+        
+        for (int i = 0; i < numSamples; i++)
+            output[i] = ring[(position + i - latency) & mask];
+    }
+    
+    dryDelayPosition = (position + numSamples) & mask;
+}
+
+template <typename SampleType>
+size_t LofijuicerAudioProcessor::PrecisionState<SampleType>::getDelayLineBytes() const
+{
+    return (size_t) delayBuffer.getNumChannels() * (size_t) delayBuffer.getNumSamples() * sizeof (SampleType);
+}
+
+/* Take the LFO rate from its parameter, or from the host's tempo. Synced and playing, the
+   phase is worked out from the song position instead of accumulated, so the modulation is
+   the same on every pass over the same bars and never drifts from the beat. Called once per
+   host block, inside it the LFO advances sample by sample as usual */
+void LofijuicerAudioProcessor::updateLfo()
+{
+    float rateHz = lfoRateParameter->load();
+    syncPending = false;
+    
+    if (lfoSyncParameter->load() >= 0.5f)
+    {
+        juce::AudioPlayHead::CurrentPositionInfo position;
+        auto* playHead = getPlayHead();
+        const bool hasPosition = playHead != nullptr && playHead->getCurrentPosition(position);
+        
+        // without a tempo from the host, sync to 120 bpm
+        const double bpm = hasPosition && position.bpm > 0.0 ? position.bpm : 120.0;
+        const double quarterNotesPerCycle = TempoSync::getQuarterNotesPerCycle(juce::roundToInt(lfoDivisionParameter->load()));
+        
+        rateHz = (float) (bpm / (60.0 * quarterNotesPerCycle));
+        
+        if (hasPosition && position.isPlaying)
+        {
+            syncedCycles = position.ppqPosition / quarterNotesPerCycle;
+            syncedSeconds = (double) position.timeInSamples / fs;
+            syncPending = true;
+        }
+    }
+    
+    if (rateHz != lfoRate)
+    {
+        lfoRate = rateHz;
+        lfo.setFrequency(lfoRate);
+        updateStages(PresetMorph::ensembleStage);
+    }
+}
+
+/* Put every modulation source where the song position says it is, once the block's voice
+   settings are in, since a new voice count spreads the ensemble out again */
+void LofijuicerAudioProcessor::syncModulation()
+{
+    if (! syncPending)
+        return;
+    
+    lfo.phase = (float) (syncedCycles - std::floor(syncedCycles));
+    ensemble.syncPhases(syncedCycles);
+    wowFlutter.syncPhases(syncedSeconds);
+    syncPending = false;
+}
+
+/* Pick up the latest parameter values as smoothing targets, at the start of every block
+   and at every sub-block boundary after a parameter has moved; stages nothing changed
+   for are left alone */
 void LofijuicerAudioProcessor::updateParameters()
 {
+    parametersChanged.store(false);
     
+    // snapshots stored or cleared since the last block can move every stage
+    const bool snapshotsChanged = presetMorph.update();
+    
+    if (presetMorph.isActive())
+        morphRamp.setTargetValue(morphParameter->load());
+    else
+        morphRamp.setCurrentAndTargetValue(morphParameter->load());
+    
+    morphPosition = morphRamp.getCurrentValue();
+    
+    // only the stages whose parameters moved
+    updateStages(changedStages.exchange(0) | (snapshotsChanged ? (uint32_t) PresetMorph::allStages : 0));
+    updateOversampling();
+}
+
+/* Hand the parameters of the given stages to the DSP, taking them from the morph while it is active */
+void LofijuicerAudioProcessor::updateStages(uint32_t stages)
+{
+    if (stages & PresetMorph::chorusStage)
+    {
+        depthRamp.setTargetValue(getStageValue(PresetMorph::depth, depthParameter));
+        delayTimeRamp.setTargetValue(getStageValue(PresetMorph::delayTime, delayTimeParameter));
+        delayInterpolation = static_cast<DelayInterpolation>(juce::roundToInt(getStageValue(PresetMorph::interpolation, interpolationParameter)));
+    }
+    
+    if (stages & PresetMorph::filterStage)
+    {
+        cutoffRamp.setTargetValue(getStageValue(PresetMorph::cutoff, cutoffParameter));
+        resonanceRamp.setTargetValue(getStageValue(PresetMorph::resonance, resonanceParameter));
+    }
+    
+    if (stages & PresetMorph::ensembleStage)
+        ensemble.setVoices(juce::roundToInt(getStageValue(PresetMorph::chorusVoices, chorusVoicesParameter)),
+                           getStageValue(PresetMorph::chorusDetune, chorusDetuneParameter), lfoRate);
+    
+    if (stages & PresetMorph::crusherStage)
+        bitcrusher.setParameters(getStageValue(PresetMorph::crushBits, crushBitsParameter),
+                                 getStageValue(PresetMorph::crushDownsample, crushDownsampleParameter),
+                                 getStageValue(PresetMorph::crushAntiAlias, crushAntiAliasParameter) >= 0.5f);
+    
+    if (stages & PresetMorph::saturatorStage)
+    {
+        // start from clean ADAA state whenever saturation is switched on
+        const bool saturationOn = getStageValue(PresetMorph::saturation, saturationParameter) >= 0.5f;
+        
+        if (saturationOn && ! saturationEnabled)
+            saturator.reset();
+        
+        saturationEnabled = saturationOn;
+        saturator.setDrive(getStageValue(PresetMorph::saturationDrive, saturationDriveParameter));
+        saturator.setCurve(static_cast<Saturator::Curve>(juce::roundToInt(getStageValue(PresetMorph::saturationCurve, saturationCurveParameter))));
+    }
+    
+    if (stages & PresetMorph::wowFlutterStage)
+        wowFlutter.setDepths(getStageValue(PresetMorph::wow, wowParameter), getStageValue(PresetMorph::flutter, flutterParameter));
+    
+    if (stages & PresetMorph::noiseStage)
+        vinylNoise.setLevels(getStageValue(PresetMorph::hiss, hissParameter), getStageValue(PresetMorph::crackle, crackleParameter));
+}
+
+float LofijuicerAudioProcessor::getStageValue(PresetMorph::Target target, const std::atomic<float>* parameter) const
+{
+    return presetMorph.isActive() ? presetMorph.getValue(target, morphPosition) : parameter->load();
 }
 
 void LofijuicerAudioProcessor::releaseResources()
@@ -150,12 +695,8 @@ bool LofijuicerAudioProcessor::isBusesLayoutSupported (const BusesLayout& layout
     juce::ignoreUnused (layouts);
     return true;
   #else
-    // This is the place where you check if the layout is supported.
-    // In this template code we only support mono or stereo.
-    // Some plugin hosts, such as certain GarageBand versions, will only
-    // load plugins that support stereo bus layouts.
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // any layout works, from mono to 7.1.4 and beyond: every stage runs per channel
+    if (layouts.getMainOutputChannelSet().isDisabled())
         return false;
 
     // This checks if the input layout matches the output layout
@@ -170,106 +711,573 @@ bool LofijuicerAudioProcessor::isBusesLayoutSupported (const BusesLayout& layout
 #endif
 
 void LofijuicerAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processWithBypass(buffer, false);
+}
+
+void LofijuicerAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processWithBypass(buffer, false);
+}
+
+void LofijuicerAudioProcessor::processBlockBypassed (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processWithBypass(buffer, true);
+}
+
+void LofijuicerAudioProcessor::processBlockBypassed (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processWithBypass(buffer, true);
+}
+
+/* Run the chain, or the dry signal, or a crossfade between them while bypass switches */
+template <typename SampleType>
+void LofijuicerAudioProcessor::processWithBypass (juce::AudioBuffer<SampleType>& buffer, bool shouldBypass)
+{
+    LOFIJUICER_TIME_STAGE(stageProfiler, processBlock);
+    
+    auto& state = getPrecisionState<SampleType>();
+    const int numSamples = buffer.getNumSamples();
+    
+   #if LOFIJUICER_ENABLE_STAGE_TIMING
+    stageProfiler.addBlock(numSamples);
+   #endif
+    
+    if (shouldBypass != bypassed)
+    {
+        bypassed = shouldBypass;
+        bypassRamp.setTargetValue(shouldBypass ? 1.0f : 0.0f);
+        bypassTailRemaining = shouldBypass ? juce::roundToInt((bypassFadeSeconds + getChainTailSeconds()) * fs) : 0;
+    }
+    
+    // once per host block: the song position is where this block starts, so the pieces of a
+    // fade below carry on from it rather than each jumping back to it
+    updateLfo();
+    
+    // the usual case; the dry signal still goes through the latency ring, ready for a fade
+    if (! bypassed && ! bypassRamp.isSmoothing())
+    {
+        if (state.latencySamples > 0)
+            state.delayDry(buffer, numSamples, false);
+        
+        processSamples(buffer);
+        return;
+    }
+    
+    // bypassed and rung out: only the input, delayed by the latency the host compensates for
+    if (bypassed && bypassTailRemaining <= 0)
+    {
+        for (auto i = getTotalNumInputChannels(); i < getTotalNumOutputChannels(); ++i)
+            buffer.clear (i, 0, numSamples);
+        
+        if (state.latencySamples == 0)
+            return;
+    }
+    
+    // the dry scratch holds one prepared block, bigger host blocks go through in pieces
+    for (int startSample = 0; startSample < numSamples; startSample += maxBlockSize)
+    {
+        const int length = juce::jmin(maxBlockSize, numSamples - startSample);
+        juce::AudioBuffer<SampleType> chunk (buffer.getArrayOfWritePointers(), buffer.getNumChannels(), startSample, length);
+        
+        if (bypassed && bypassTailRemaining <= 0)
+        {
+            state.delayDry(chunk, length, true);
+            
+            for (int channel = 0; channel < state.dryBuffer.getNumChannels(); channel++)
+                chunk.copyFrom(channel, 0, state.dryBuffer, channel, 0, length);
+            
+            continue;
+        }
+        
+        processBypassFade(chunk);
+        
+        if (bypassed)
+            bypassTailRemaining -= length;
+    }
+}
+
+/* One block of the crossfade, or of the tail after it: the chain's input fades with an
+   equal-power curve, so whatever is already in the filter and the delay line rings out */
+template <typename SampleType>
+void LofijuicerAudioProcessor::processBypassFade (juce::AudioBuffer<SampleType>& buffer)
+{
+    auto& state = getPrecisionState<SampleType>();
+    const int numSamples = buffer.getNumSamples();
+    const int numChannels = juce::jmin(buffer.getNumChannels(), state.dryBuffer.getNumChannels());
+    const bool fading = bypassRamp.isSmoothing();
+    
+    state.delayDry(buffer, numSamples, true);
+    
+    // quarter sine and cosine of the fade position
+    float* wetGains = bypassWetGains.get();
+    float* dryGains = bypassDryGains.get();
+    bypassRamp.fill(dryGains, numSamples);
+    
+    for (int i = 0; i < numSamples; i++)
+    {
+        const float fade = dryGains[i];
+        wetGains[i] = Lfo::fastSin(0.25f * (1.0f - fade));
+        dryGains[i] = Lfo::fastSin(0.25f * fade);
+    }
+    
+    for (int channel = 0; channel < numChannels; channel++)
+    {
+        SampleType* data = buffer.getWritePointer(channel);
+        
+        for (int i = 0; i < numSamples; i++)
+            data[i] *= (SampleType) wetGains[i];
+    }
+    
+    processSamples(buffer, false);
+    
+    // hiss and crackle belong to the processed signal, they fade with it instead of ringing on
+    if (fading && vinylNoise.isActive())
+    {
+        juce::AudioBuffer<SampleType> noise (state.noiseBuffer.getArrayOfWritePointers(), numChannels, numSamples);
+        noise.clear();
+        processNoise(noise);
+        
+        for (int channel = 0; channel < numChannels; channel++)
+        {
+            SampleType* data = buffer.getWritePointer(channel);
+            const SampleType* noiseData = noise.getReadPointer(channel);
+            
+            for (int i = 0; i < numSamples; i++)
+                data[i] += noiseData[i] * (SampleType) wetGains[i];
+        }
+    }
+    
+    for (int channel = 0; channel < numChannels; channel++)
+    {
+        SampleType* data = buffer.getWritePointer(channel);
+        const SampleType* dryData = state.dryBuffer.getReadPointer(channel);
+        
+        for (int i = 0; i < numSamples; i++)
+            data[i] += dryData[i] * (SampleType) dryGains[i];
+    }
+}
+
+//==============================================================================
+namespace
+{
+    constexpr float silenceThreshold = 1.0e-5f;     // -100 dBFS
+    
+    /* True if the first numChannels channels all stay below the silence threshold */
+    template <typename SampleType>
+    bool isBelowSilence(const juce::AudioBuffer<SampleType>& buffer, int numChannels)
+    {
+        numChannels = juce::jmin(numChannels, buffer.getNumChannels());
+        
+        for (int channel = 0; channel < numChannels; channel++)
+        {
+            const auto range = juce::FloatVectorOperations::findMinAndMax(buffer.getReadPointer(channel), buffer.getNumSamples());
+            
+            if (range.getStart() <= -silenceThreshold || range.getEnd() >= silenceThreshold)
+                return false;
+        }
+        
+        return true;
+    }
+}
+
+/* Decide whether this block can be skipped; the delay ring is cleared on the way into idle,
+   so a longer delay time chosen while idle cannot reach back to audio from before the silence */
+template <typename SampleType>
+bool LofijuicerAudioProcessor::updateSilence(const juce::AudioBuffer<SampleType>& buffer, bool withNoise)
+{
+    if (! isBelowSilence(buffer, getTotalNumInputChannels()))
+    {
+        silentInputSamples = 0;
+        outputFellSilent = false;
+        idle = false;
+        return false;
+    }
+    
+    if (silentInputSamples == 0)
+        silenceTailSamples = juce::roundToInt(getChainTailSeconds() * fs);
+    
+    silentInputSamples += buffer.getNumSamples();
+    
+    // hiss and crackle come out of nothing, so they keep the chain running
+    const bool canIdle = silentInputSamples > silenceTailSamples && outputFellSilent
+                      && ! (withNoise && vinylNoise.isActive());
+    
+    if (canIdle && ! idle)
+        getPrecisionState<SampleType>().delayBuffer.clear();
+    
+    idle = canIdle;
+    return idle;
+}
+
+/* Keep every modulation where it would have been, so processing picks up without a jump */
+void LofijuicerAudioProcessor::skipIdleSamples(int numSamples)
+{
+    if (presetMorph.isActive() && morphRamp.isSmoothing())
+    {
+        morphPosition = morphRamp.skip(numSamples);
+        updateStages(presetMorph.getDifferingStages());
+    }
+    
+    lfo.advance(numSamples);
+    ensemble.advance(numSamples);
+    wowFlutter.advance(numSamples);
+    depthRamp.skip(numSamples);
+    delayTimeRamp.skip(numSamples);
+    updateFilter(numSamples);
+}
+
+double LofijuicerAudioProcessor::getIdleFraction() const
+{
+    const auto total = totalSampleCount.load();
+    return total > 0 ? (double) idleSampleCount.load() / (double) total : 0.0;
+}
+
+void LofijuicerAudioProcessor::resetIdleStatistics()
+{
+    totalSampleCount.store(0);
+    idleSampleCount.store(0);
+}
+
+/* The whole chain, in the precision of the host's buffer */
+template <typename SampleType>
+void LofijuicerAudioProcessor::processSamples (juce::AudioBuffer<SampleType>& buffer, bool withNoise)
 {
     juce::ScopedNoDenormals noDenormals;
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
+    const int numSamples = buffer.getNumSamples();
 
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
-        buffer.clear (i, 0, buffer.getNumSamples());
+        buffer.clear (i, 0, numSamples);
     
-    /* Low-pass Filter Processing */
+    updateParameters();
+    syncModulation();
     
-    // define the audio block for the processor to duplicate the mono channel to stereo
-    juce::dsp::AudioBlock<float> block (buffer);
-    updateFilter();
-    stateVariableFilter.process(juce::dsp::ProcessContextReplacing<float>(block));
+    // levels go to the editor's meters, skipped entirely while no editor is open
+    const bool metering = meterFifo.isActive();
+    MeterFrame meterFrame;
     
+    if (metering)
+        meterFrame.taps[(int) MeterTap::input] = MeterFifo::measure(buffer, totalNumInputChannels);
     
-    /* Chorus Filter Processing */
+    // only the audio thread writes the counters, so no read-modify-write is needed
+    totalSampleCount.store(totalSampleCount.load(std::memory_order_relaxed) + numSamples, std::memory_order_relaxed);
     
-    const int bufferLength = buffer.getNumSamples();
-    const int delayBufferLength = thisDelayBuffer.getNumSamples();
-
-    // Begins writing the original singal into the delay buffer
-    for (int channel = 0; channel < totalNumInputChannels; channel++)
+    if (updateSilence(buffer, withNoise))
+    {
+        idleSampleCount.store(idleSampleCount.load(std::memory_order_relaxed) + numSamples, std::memory_order_relaxed);
+        skipIdleSamples(numSamples);
+        buffer.clear();
+        
+        if (metering)
+            meterFifo.push(meterFrame);
+        
+        return;
+    }
+    
+    // the block goes through in segments of at most maxSubBlockSize samples (0 = the whole
+    // block); a parameter that moved while the previous segment ran is picked up at the next
+    // one, and while the morph moves the stages it changes are re-applied every few samples
+    const int subBlockSize = maxSubBlockSize.load(std::memory_order_relaxed);
+    
+    for (int startSample = 0, length = 0; startSample < numSamples; startSample += length)
+    {
+        if (startSample > 0 && parametersChanged.exchange(false))
+            updateParameters();
+        
+        const bool sweeping = presetMorph.isActive() && morphRamp.isSmoothing();
+        const uint32_t morphedStages = sweeping ? presetMorph.getDifferingStages() : 0;
+        const int segmentLength = morphedStages != 0 ? morphSubBlockSize
+                                                     : (subBlockSize > 0 ? subBlockSize : numSamples);
+        
+        length = juce::jmin(segmentLength, numSamples - startSample);
+        
+        // refers to the host's channels, no copy and no allocation
+        juce::AudioBuffer<SampleType> segment (buffer.getArrayOfWritePointers(), buffer.getNumChannels(), startSample, length);
+        
+        if (morphedStages != 0)
+        {
+            morphPosition = morphRamp.skip(length);
+            updateStages(morphedStages);
+        }
+        
+        /* Bitcrusher Processing */
+        processCrusher(segment);
+        
+        /* Low-pass Filter Processing */
+        processFilter(segment);
+        
+        if (metering)
+            meterFrame.taps[(int) MeterTap::postFilter] = MeterFifo::combine(meterFrame.taps[(int) MeterTap::postFilter], startSample,
+                                                                             MeterFifo::measure(segment, totalNumOutputChannels), length);
+        
+        /* Chorus Filter Processing */
+        processChorus(segment);
+        
+        /* Vinyl Noise Processing */
+        if (withNoise)
+            processNoise(segment);
+    }
+    
+    // while the input is quiet, watch the output ring down to the same threshold
+    if (silentInputSamples > 0)
+        outputFellSilent = isBelowSilence(buffer, totalNumOutputChannels);
+    
+    if (metering)
     {
-        const float* bufferData = buffer.getReadPointer(channel);
-        const float* delayBufferData = thisDelayBuffer.getReadPointer(channel);
+        meterFrame.taps[(int) MeterTap::output] = MeterFifo::measure(buffer, totalNumOutputChannels);
+        meterFifo.push(meterFrame);
+    }
+}
 
-        // copy the delayed signal to the delay buffer
-        writeDelayBuffer(channel, bufferLength, delayBufferLength, bufferData);
+/* Reduce bit depth and sample rate, costs nothing while both are off */
+template <typename SampleType>
+void LofijuicerAudioProcessor::processCrusher(juce::AudioBuffer<SampleType>& buffer)
+{
+    LOFIJUICER_TIME_STAGE(stageProfiler, crusher);
+    bitcrusher.process(juce::dsp::AudioBlock<SampleType>(buffer));
+}
 
-        // read the delayed buffer and add it to the main buffer
-        getFromDelayBuffer(buffer, channel, bufferLength, delayBufferLength, delayBufferData);
+/* Run the low-pass filter and saturation over the whole buffer, oversampled if asked to */
+template <typename SampleType>
+void LofijuicerAudioProcessor::processFilter(juce::AudioBuffer<SampleType>& buffer)
+{
+    LOFIJUICER_TIME_STAGE(stageProfiler, filter);
+    
+    auto* activeOversampler = getPrecisionState<SampleType>().activeOversampler;
+    juce::dsp::AudioBlock<SampleType> block (buffer);
+    const int numSamples = buffer.getNumSamples();
+    
+    // the oversamplers are sized for samplesPerBlock, so bigger host blocks go through in pieces
+    for (int startSample = 0; startSample < numSamples; startSample += maxBlockSize)
+    {
+        const int blockLength = juce::jmin(maxBlockSize, numSamples - startSample);
+        auto subBlock = block.getSubBlock((size_t) startSample, (size_t) blockLength);
+        
+        // parameter ramps advance in host samples, whatever rate the filter runs at
+        updateFilter(blockLength);
+        
+        if (activeOversampler == nullptr)
+        {
+            processNonlinearStages(subBlock);
+            continue;
+        }
+        
+        auto oversampledBlock = activeOversampler->processSamplesUp(subBlock);
+        processNonlinearStages(oversampledBlock);
+        activeOversampler->processSamplesDown(subBlock);
     }
+}
 
-    // update the buffer and advance the position
-    thisWritePosition += bufferLength;
-    thisWritePosition %= delayBufferLength;
+/* The stages inside the oversampled section: filter, then saturation */
+template <typename SampleType>
+void LofijuicerAudioProcessor::processNonlinearStages(const juce::dsp::AudioBlock<SampleType>& block)
+{
+    stateVariableFilter.process(block);
+    
+    if (saturationEnabled)
+        saturator.process(block);
+}
 
-    // update the LFO
-    lfo.phase += lfo.phase_inc / 4.0;
-    lfo.output = sin(lfo.phase);
+/* Feed the delay buffer and add the modulated delayed signal back in */
+template <typename SampleType>
+void LofijuicerAudioProcessor::processChorus(juce::AudioBuffer<SampleType>& buffer)
+{
+    const int totalNumInputChannels = getTotalNumInputChannels();
+    const int numSamples = buffer.getNumSamples();
+    const int delayBufferLength = getPrecisionState<SampleType>().delayBuffer.getNumSamples() - delayGuard;
+
+    // hosts may send more than samplesPerBlock, so work in chunks the LFO can hold
+    for (int startSample = 0; startSample < numSamples; startSample += lfo.max_block)
+    {
+        const int bufferLength = juce::jmin(lfo.max_block, numSamples - startSample);
+        
+        // one LFO, delay time and depth value per sample of this chunk
+        {
+            LOFIJUICER_TIME_STAGE(stageProfiler, lfo);
+            chunkLfoPhase = lfo.phase;
+            lfo.processBlock(bufferLength);
+            delayTimeRamp.fill(delayTimeValues.get(), bufferLength);
+            depthRamp.fill(depthValues.get(), bufferLength);
+            wowFlutter.process(delayTimeValues.get(), bufferLength);
+        }
+        
+        // mono and stereo get loops with the channel count built in, so stereo is no slower than before
+        switch (totalNumInputChannels)
+        {
+            case 1:  processChorusChannels<1>(buffer, 1, startSample, bufferLength, delayBufferLength); break;
+            case 2:  processChorusChannels<2>(buffer, 2, startSample, bufferLength, delayBufferLength); break;
+            default: processChorusChannels<0>(buffer, totalNumInputChannels, startSample, bufferLength, delayBufferLength); break;
+        }
+
+        // every channel has read this chunk, move the ensemble's LFOs on
+        ensemble.advance(bufferLength);
+        
+        // update the buffer and advance the position
+        thisWritePosition = (thisWritePosition + bufferLength) & delayBufferMask;
+    }
 }
 
-//==============================================================================
+/* Add hiss and crackle on top of everything, costs nothing while both are off */
+template <typename SampleType>
+void LofijuicerAudioProcessor::processNoise(juce::AudioBuffer<SampleType>& buffer)
+{
+    LOFIJUICER_TIME_STAGE(stageProfiler, noise);
+    vinylNoise.process(juce::dsp::AudioBlock<SampleType>(buffer));
+}
 
-/* Copy the data from the main buffer to the delay buffer */
-void LofijuicerAudioProcessor::writeDelayBuffer(int channel, const int bufferLength, const int delayBufferLength, const float* bufferData)
+/* Write and read the delay line of every channel for one chunk */
+template <int NumChannels, typename SampleType>
+void LofijuicerAudioProcessor::processChorusChannels(juce::AudioBuffer<SampleType>& buffer, int numChannels, int startSample, int bufferLength, int delayBufferLength)
 {
+    const int channels = NumChannels > 0 ? NumChannels : numChannels;
     
-    if (delayBufferLength > bufferLength + thisWritePosition)
-    {
-        thisDelayBuffer.copyFromWithRamp(channel, thisWritePosition, bufferData, bufferLength, 0.75, 0.75);
-    }
-    else
+    // channels are spread evenly from no offset to the full spread; stereo at 0.5 is the classic L/R opposition
+    const float spread = phaseSpreadParameter->load();
+    const float offsetPerChannel = channels > 1 ? spread / (float) (channels - 1) : 0.0f;
+    
+    // Begins writing the original singal into the delay buffer
+    for (int channel = 0; channel < channels; channel++)
     {
-        // fill up the remaining values
-        const int bufferRemaining = delayBufferLength - thisWritePosition;
-        thisDelayBuffer.copyFromWithRamp(channel, thisWritePosition, bufferData, bufferRemaining, 0.75, 0.75);
-        // prepare to go to the next buffer (and thus back to 0)
-        thisDelayBuffer.copyFromWithRamp(channel, 0, bufferData + bufferRemaining, bufferLength - bufferRemaining, 0.75, 0.75);
+        const SampleType* bufferData = buffer.getReadPointer(channel, startSample);
+        const SampleType* delayBufferData = getPrecisionState<SampleType>().delayBuffer.getReadPointer(channel);
+        
+        // copy the delayed signal to the delay buffer
+        {
+            LOFIJUICER_TIME_STAGE(stageProfiler, delayWrite);
+            writeDelayBuffer(channel, bufferLength, delayBufferLength, bufferData);
+        }
+        
+        // read the delayed buffer and add it to the main buffer
+        {
+            LOFIJUICER_TIME_STAGE(stageProfiler, delayRead);
+            getFromDelayBuffer(buffer, channel, startSample, bufferLength, delayBufferLength, delayBufferData, offsetPerChannel * (float) channel);
+        }
     }
 }
 
-/* Add the delay buffer delayed by t milliseconds to the main buffer */
-void LofijuicerAudioProcessor::getFromDelayBuffer(juce::AudioBuffer<float>& buffer, int channel, const int bufferLength, const int delayBufferLength, const float* delayBufferData)
+/* LFO values for a channel whose phase is offset from the shared LFO */
+const float* LofijuicerAudioProcessor::getChannelModulation(float phaseOffset, int numSamples, float& sign)
 {
-    // delay time in ms
-    float t_left = delayTime + ( depth * lfo.output );
-    float t_right = delayTime - ( depth * lfo.output );
-    float t;
+    sign = 1.0f;
     
-    // create different delay time in L/R
-    if (channel == 0) {
-        t = t_left;
+    // the common cases reuse the shared block as it is
+    if (phaseOffset == 0.0f || phaseOffset == 1.0f)
+        return lfo.output_array;
+    
+    if (phaseOffset == 0.5f)
+    {
+        sign = -1.0f;
+        return lfo.output_array;
     }
-    else
+    
+    // same loop as Lfo::processBlock, from a shifted start
+    const float start = chunkLfoPhase + phaseOffset;
+    const float inc = lfo.phase_inc;
+    float* values = channelModulation.get();
+    
+    for (int i = 0; i < numSamples; i++)
     {
-        t = t_right;
+        float p = start + (float) i * inc;
+        p -= (float) (int) p;
+        values[i] = Lfo::fastSin(p);
     }
+    
+    return values;
+}
+
+//==============================================================================
+
+/* Copy the data from the main buffer to the delay buffer */
+template <typename SampleType>
+void LofijuicerAudioProcessor::writeDelayBuffer(int channel, const int bufferLength, const int delayBufferLength, const SampleType* bufferData)
+{
+    SampleType* delayData = getPrecisionState<SampleType>().delayBuffer.getWritePointer(channel);
+    const int mask = delayBufferMask;
+    
+    // the ring is a power of two long, so the position wraps with a mask
+    for (int i = 0; i < bufferLength; i++)
+        delayData[(thisWritePosition + i) & mask] = SampleType (0.75) * bufferData[i];
+    
+    // mirror the start of the ring past its end so interpolation taps never wrap
+    juce::FloatVectorOperations::copy(delayData + delayBufferLength, delayData, delayGuard);
+}
 
-    // next lowest integer (floor and ceil)
-    auto readPosition = juce::roundToInt(delayBufferLength + thisWritePosition - (fs * t / 1000.0)) % delayBufferLength;
+/* Add the delay buffer, delayed by t milliseconds modulated per sample by the LFO, to the main buffer */
+template <typename SampleType>
+void LofijuicerAudioProcessor::getFromDelayBuffer(juce::AudioBuffer<SampleType>& buffer, int channel, const int startSample, const int bufferLength, const int delayBufferLength, const SampleType* delayBufferData, float phaseOffset)
+{
+    SampleType* outputData = buffer.getWritePointer(channel, startSample);
+    int* readIndex = delayReadIndex.get();
+    float* readFraction = delayReadFraction.get();
+    
+    const float samplesPerMs = fs / 1000.0f;
+    
+    // keep the newest tap behind the write position and the oldest ahead of this block's writes
+    const float minDelay = 2.0f;
+    const float maxDelay = (float) (delayBufferLength - lfo.max_block - delayGuard);
     
-//    if (readPosition < 0)
-//        readPosition += delayBufferLength;
+    const int mask = delayBufferMask;
     
-    // add delay buffer
-    if (delayBufferLength > bufferLength + readPosition)
+    // several voices: the ensemble reads them all at once, at this channel's phase
+    if (ensemble.getNumVoices() > 1)
     {
-        // buffer.addFrom(channel, 0, delayBufferData + readPosition, bufferLength);
-        buffer.addFromWithRamp(channel, 0, delayBufferData + readPosition, bufferLength, 0.8, 0.8);
+        ensemble.read(delayInterpolation, delayBufferData, mask, thisWritePosition,
+                      delayTimeValues.get(), depthValues.get(), outputData, bufferLength,
+                      phaseOffset, 0.8f, minDelay, maxDelay);
+        return;
     }
-    else
+    
+    // each channel reads the LFO at its own phase, so the channels are delayed differently
+    float lfoSign;
+    const float* modulation = getChannelModulation(phaseOffset, bufferLength, lfoSign);
+    
+    // first pass: delay in samples -> first tap and fraction, wrapped with the ring mask
+    for (int i = 0; i < bufferLength; i++)
     {
-        const int bufferRemaining = delayBufferLength - readPosition;
-        buffer.addFromWithRamp(channel, 0, delayBufferData + readPosition, bufferRemaining, 0.8, 0.8);
-        buffer.addFromWithRamp(channel, bufferRemaining, delayBufferData, bufferLength - bufferRemaining, 0.8, 0.8);
+        // delay time in ms
+        const float t = delayTimeValues[i] + lfoSign * depthValues[i] * modulation[i];
+        const float d = juce::jlimit(minDelay, maxDelay, samplesPerMs * t);
+        
+        const int wholeDelay = (int) d;
+        readFraction[i] = 1.0f - (d - (float) wholeDelay);
+        
+        // taps start one sample before the sample just older than the delay point
+        readIndex[i] = (thisWritePosition + i - wholeDelay - 2) & mask;
+    }
+    
+    // second pass: gather the taps and interpolate
+    switch (delayInterpolation)
+    {
+        case DelayInterpolation::linear:
+            readDelayLine<DelayInterpolation::linear>(delayBufferData, readIndex, readFraction, outputData, bufferLength, 0.8f);
+            break;
+        case DelayInterpolation::hermite:
+            readDelayLine<DelayInterpolation::hermite>(delayBufferData, readIndex, readFraction, outputData, bufferLength, 0.8f);
+            break;
+        case DelayInterpolation::lagrange:
+            readDelayLine<DelayInterpolation::lagrange>(delayBufferData, readIndex, readFraction, outputData, bufferLength, 0.8f);
+            break;
     }
 }
 
+/* Memory held by the chorus delay line, for the render harness */
+size_t LofijuicerAudioProcessor::getDelayLineBytes() const
+{
+    return floatState.getDelayLineBytes() + doubleState.getDelayLineBytes();
+}
+
+// the stages are public for the render harness, which drives them in both precisions
+template void LofijuicerAudioProcessor::processCrusher<float>(juce::AudioBuffer<float>&);
+template void LofijuicerAudioProcessor::processCrusher<double>(juce::AudioBuffer<double>&);
+template void LofijuicerAudioProcessor::processFilter<float>(juce::AudioBuffer<float>&);
+template void LofijuicerAudioProcessor::processFilter<double>(juce::AudioBuffer<double>&);
+template void LofijuicerAudioProcessor::processChorus<float>(juce::AudioBuffer<float>&);
+template void LofijuicerAudioProcessor::processChorus<double>(juce::AudioBuffer<double>&);
+template void LofijuicerAudioProcessor::processNoise<float>(juce::AudioBuffer<float>&);
+template void LofijuicerAudioProcessor::processNoise<double>(juce::AudioBuffer<double>&);
+
 //==============================================================================
 bool LofijuicerAudioProcessor::hasEditor() const
 {
@@ -282,17 +1290,129 @@ juce::AudioProcessorEditor* LofijuicerAudioProcessor::createEditor()
 }
 
 //==============================================================================
+// State layout, all little-endian:
+//   int32 magic, int32 version, int32 current program, int32 parameter count,
+//   then per parameter: int32 hash of its ID, float normalised value.
+// Version 2 adds the morph snapshots: int32 flags (bit 0 = A stored, bit 1 = B),
+//   int32 target count, then A's and B's plain values, one float per target.
+// Loading matches parameters by ID hash, so adding or reordering parameters in
+// later versions still restores everything that was saved.
+namespace
+{
+    constexpr int stateMagic = 0x4c464a53;      // "LFJS"
+    constexpr int stateVersion = 2;
+    constexpr int stateHeaderBytes = 16;
+    constexpr int stateEntryBytes = 8;
+}
+
 void LofijuicerAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
-    // You should use this method to store your parameters in the memory block.
-    // You could do that either as raw data, or use the XML or ValueTree classes
-    // as intermediaries to make it easy to save and load complex data.
+    const auto& allParameters = getParameters();
+    
+    destData.setSize ((size_t) (stateHeaderBytes + stateEntryBytes * allParameters.size()
+                                + 8 + 2 * 4 * PresetMorph::numTargets));
+    juce::MemoryOutputStream stream (destData, false);
+    
+    stream.writeInt (stateMagic);
+    stream.writeInt (stateVersion);
+    stream.writeInt (currentProgram.load());
+    stream.writeInt (allParameters.size());
+    
+    for (auto* parameter : allParameters)
+    {
+        auto* ranged = dynamic_cast<juce::RangedAudioParameter*> (parameter);
+        stream.writeInt (ranged != nullptr ? ranged->paramID.hashCode() : 0);
+        stream.writeFloat (parameter->getValue());
+    }
+    
+    stream.writeInt ((presetMorph.hasSnapshot (0) ? 1 : 0) | (presetMorph.hasSnapshot (1) ? 2 : 0));
+    stream.writeInt (PresetMorph::numTargets);
+    
+    for (int slot = 0; slot < 2; slot++)
+    {
+        float values[PresetMorph::numTargets];
+        presetMorph.getSnapshot (slot, values);
+        
+        for (auto value : values)
+            stream.writeFloat (value);
+    }
 }
 
 void LofijuicerAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
 {
-    // You should use this method to restore your parameters from this memory block,
-    // whose contents will have been created by the getStateInformation() call.
+    if (data == nullptr || sizeInBytes < stateHeaderBytes)
+        return;
+    
+    juce::MemoryInputStream stream (data, (size_t) sizeInBytes, false);
+    
+    if (stream.readInt() != stateMagic)
+        return;
+    
+    const int version = stream.readInt();
+    
+    if (version > stateVersion)
+        return;
+    
+    const int program = stream.readInt();
+    const int numEntries = juce::jmin (stream.readInt(), (sizeInBytes - stateHeaderBytes) / stateEntryBytes);
+    const auto& allParameters = getParameters();
+    
+    for (int entry = 0; entry < numEntries; entry++)
+    {
+        const int idHash = stream.readInt();
+        const float value = stream.readFloat();
+        
+        // saved in the same order as now unless parameters were added since, so try that slot first
+        auto matches = [idHash] (juce::AudioProcessorParameter* parameter)
+        {
+            auto* ranged = dynamic_cast<juce::RangedAudioParameter*> (parameter);
+            return ranged != nullptr && ranged->paramID.hashCode() == idHash;
+        };
+        
+        juce::AudioProcessorParameter* target = nullptr;
+        
+        if (entry < allParameters.size() && matches (allParameters[entry]))
+            target = allParameters[entry];
+        else
+            for (auto* parameter : allParameters)
+                if (matches (parameter))
+                    target = parameter;
+        
+        if (target != nullptr && std::isfinite (value))
+            target->setValueNotifyingHost (juce::jlimit (0.0f, 1.0f, value));
+    }
+    
+    if (juce::isPositiveAndBelow (program, programBank.getNumPrograms()))
+        currentProgram.store (program);
+    
+    presetMorph.clear();
+    
+    if (version < 2 || stream.getNumBytesRemaining() < 8)
+        return;
+    
+    // targets added after the state was saved keep the live parameter's value
+    const int flags = stream.readInt();
+    const int numSavedTargets = stream.readInt();
+    
+    if (numSavedTargets < 0 || stream.getNumBytesRemaining() < 2 * 4 * (juce::int64) numSavedTargets)
+        return;
+    
+    for (int slot = 0; slot < 2; slot++)
+    {
+        float values[PresetMorph::numTargets];
+        presetMorph.getLiveValues (values);
+        
+        for (int target = 0; target < numSavedTargets; target++)
+        {
+            const float value = stream.readFloat();
+            
+            if (target < PresetMorph::numTargets && std::isfinite (value))
+                values[target] = value;
+        }
+        
+        if ((flags & (1 << slot)) != 0)
+            presetMorph.setSnapshot (slot, values);
+    }
 }
 
 //==============================================================================
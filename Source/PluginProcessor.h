@@ -10,13 +10,58 @@
 
 #include <JuceHeader.h>
 #include "LFO.h"
+#include "DelayInterpolation.h"
+#include "ChorusEnsemble.h"
+#include "ParameterRamp.h"
+#include "SvfLowpass.h"
+#include "Bitcrusher.h"
+#include "Saturator.h"
+#include "WowFlutter.h"
+#include "VinylNoise.h"
+#include "Metering.h"
+#include "ProgramBank.h"
+#include "PresetMorph.h"
+#include "TempoSync.h"
+#include "StageProfiler.h"
 #define pi                     3.14159265358979323846
 
+//==============================================================================
+// parameter IDs shared by the processor, the editor and saved state
+namespace ParamIDs
+{
+    constexpr const char* depth         = "depth";
+    constexpr const char* delayTime     = "delayTime";
+    constexpr const char* cutoff        = "cutoff";
+    constexpr const char* resonance     = "resonance";
+    constexpr const char* interpolation = "interpolation";
+    constexpr const char* chorusVoices  = "chorusVoices";
+    constexpr const char* chorusDetune  = "chorusDetune";
+    constexpr const char* oversampling  = "oversampling";
+    constexpr const char* oversamplingQuality = "oversamplingQuality";
+    constexpr const char* crushBits     = "crushBits";
+    constexpr const char* crushDownsample = "crushDownsample";
+    constexpr const char* crushAntiAlias = "crushAntiAlias";
+    constexpr const char* saturation    = "saturation";
+    constexpr const char* saturationDrive = "saturationDrive";
+    constexpr const char* saturationCurve = "saturationCurve";
+    constexpr const char* wow             = "wow";
+    constexpr const char* flutter         = "flutter";
+    constexpr const char* hiss            = "hiss";
+    constexpr const char* crackle         = "crackle";
+    constexpr const char* morph           = "morph";
+    constexpr const char* phaseSpread     = "phaseSpread";
+    constexpr const char* lfoRate         = "lfoRate";
+    constexpr const char* lfoSync         = "lfoSync";
+    constexpr const char* lfoDivision     = "lfoDivision";
+}
+
 
 //==============================================================================
 /**
 */
-class LofijuicerAudioProcessor  : public juce::AudioProcessor
+class LofijuicerAudioProcessor  : public juce::AudioProcessor,
+                                  private juce::Timer,
+                                  private juce::AudioProcessorParameter::Listener
 {
 public:
     //==============================================================================
@@ -32,6 +77,12 @@ public:
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override   { return true; }
+    
+    // crossfades to the dry signal and lets the delay line ring out instead of cutting it
+    void processBlockBypassed (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlockBypassed (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -44,6 +95,13 @@ public:
     bool producesMidi() const override;
     bool isMidiEffect() const override;
     double getTailLengthSeconds() const override;
+    
+    // reported as the tail while hiss or crackle is on, where the wrapper has no way to say "endless"
+    static constexpr double endlessTailSeconds = 60.0;
+    
+    // how long the filter and the chorus keep sounding once the input stops, without the noise
+    // and without the latency
+    double getChainTailSeconds() const;
 
     //==============================================================================
     int getNumPrograms() override;
@@ -57,30 +115,211 @@ public:
     void setStateInformation (const void* data, int sizeInBytes) override;
     
     //==============================================================================
-    void updateFilter();
+    static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    
+    void updateFilter(int numSamples);
     void updateParameters();
+    void updateStages(uint32_t stages);
+    void updateOversampling();
+    
+    // longest stretch processed with one set of parameter values, 0 = whole host blocks (the default);
+    // a smaller size picks up a parameter moved mid-block sooner, at the cost of the extra segments
+    void setMaxSubBlockSize(int numSamples);
+    int getMaxSubBlockSize() const noexcept     { return maxSubBlockSize.load(); }
+    
+    //==============================================================================
+    // the stages of processBlock, public so the render harness can time them separately;
+    // each runs in float or double, whichever precision the processor was prepared for
+    template <typename SampleType> void processCrusher(juce::AudioBuffer<SampleType>& buffer);
+    template <typename SampleType> void processFilter(juce::AudioBuffer<SampleType>& buffer);
+    template <typename SampleType> void processChorus(juce::AudioBuffer<SampleType>& buffer);
+    template <typename SampleType> void processNoise(juce::AudioBuffer<SampleType>& buffer);
+    template <typename SampleType> void processNonlinearStages(const juce::dsp::AudioBlock<SampleType>& block);
     
     //==============================================================================
-    void writeDelayBuffer(int channel, const int bufferLength, const int delayBufferLength, const float* bufferData);
-    void getFromDelayBuffer(juce::AudioBuffer<float>& buffer, int channel, const int bufferLength, const int delayBufferLength, const float* delayBufferData);
+    template <typename SampleType>
+    void writeDelayBuffer(int channel, const int bufferLength, const int delayBufferLength, const SampleType* bufferData);
+    template <typename SampleType>
+    void getFromDelayBuffer(juce::AudioBuffer<SampleType>& buffer, int channel, const int startSample, const int bufferLength, const int delayBufferLength, const SampleType* delayBufferData, float phaseOffset);
+    size_t getDelayLineBytes() const;
+    
+    // share of samples processBlock skipped as silence since the last reset, for the render harness
+    double getIdleFraction() const;
+    void resetIdleStatistics();
     
     //==============================================================================
+    // host-automatable parameters, written by the editor and the host, read atomically here
+    juce::AudioProcessorValueTreeState parameters;
+    MeterFifo meterFifo;                        // levels for the editor, only measured while it is open
+    StageProfiler stageProfiler;                // per-stage timing for the debug panel and the render harness
+    PresetMorph presetMorph;                    // snapshots A and B, blended by the morph parameter
+    
     Lfo lfo;
-    // LFO values accessible with knobs
-    float delayTime { 30.0 };                   // in ms
-    float lfoRate { 2000.0 };                   // in Hz
-    float depth { 0.5 };
-    // filter values accessible with knobs
-    float cutoff = 600.0;
-    float resonance = 2.5;
+    float lfoRate { 1.0 };                      // in Hz, from the rate parameter or the host's tempo
+    DelayInterpolation delayInterpolation { DelayInterpolation::hermite };
 
 private:
-    juce::AudioBuffer<float> thisDelayBuffer;
-    juce::dsp::ProcessorDuplicator<juce::dsp::StateVariableFilter::Filter<float>, juce::dsp::StateVariableFilter::Parameters<float>> stateVariableFilter;
+    // tells listeners about a program the host switched to on the audio thread,
+    // and the host about a latency change made there
+    void timerCallback() override;
+    
+    // flags a parameter change for the audio thread, from whichever thread made it,
+    // along with the processing stages that parameter feeds
+    void parameterValueChanged(int parameterIndex, float newValue) override;
+    void parameterGestureChanged(int, bool) override {}
+    
+    // the PresetMorph::Stage bits a parameter is applied through, 0 for those read elsewhere
+    static uint32_t getParameterStages(const juce::String& parameterID);
+    
+    std::atomic<bool> parametersChanged { false };
+    std::atomic<uint32_t> changedStages { PresetMorph::allStages };
+    std::vector<uint32_t> parameterStages;          // by parameter index, filled in the constructor
+    std::atomic<int> maxSubBlockSize { 0 };
+    
+    // the chain itself, in either precision; the noise can be left out for the bypass fade
+    template <typename SampleType>
+    void processSamples(juce::AudioBuffer<SampleType>& buffer, bool withNoise = true);
+    
+    // processBlock and processBlockBypassed, with the crossfade whenever the two switch over
+    template <typename SampleType>
+    void processWithBypass(juce::AudioBuffer<SampleType>& buffer, bool shouldBypass);
+    template <typename SampleType>
+    void processBypassFade(juce::AudioBuffer<SampleType>& buffer);
+    
+    ParameterRamp bypassRamp;                   // 0 = processing, 1 = bypassed
+    juce::HeapBlock<float> bypassWetGains, bypassDryGains;
+    bool bypassed { false };
+    int bypassTailRemaining { 0 };              // samples the chain keeps running after a bypass
+    static constexpr double bypassFadeSeconds = 0.02;
+    static constexpr double tailFloorDb = -80.0;    // the tail ends this far below the last input
+    
+    // silence detection: once the input has been quiet for longer than the tail and the
+    // output has followed it down, a block only moves the LFOs and the ramps on
+    template <typename SampleType>
+    bool updateSilence(const juce::AudioBuffer<SampleType>& buffer, bool withNoise);
+    void skipIdleSamples(int numSamples);
+    
+    juce::int64 silentInputSamples { 0 };       // how long the input has been below the threshold
+    juce::int64 silenceTailSamples { 0 };       // the chain's tail when the input went quiet
+    bool outputFellSilent { false };            // the last processed block came out below the threshold too
+    bool idle { false };
+    std::atomic<juce::int64> totalSampleCount { 0 }, idleSampleCount { 0 };
+    
+    ProgramBank programBank;
+    std::atomic<int> currentProgram { 0 };
+    std::atomic<bool> programNeedsAnnouncing { false };
+    std::atomic<int> pendingLatency { -1 };     // latency to report from the timer, -1 if unchanged
+    
+    // raw parameter values, safe to read from the audio thread
+    std::atomic<float>* depthParameter = nullptr;
+    std::atomic<float>* delayTimeParameter = nullptr;
+    std::atomic<float>* cutoffParameter = nullptr;
+    std::atomic<float>* resonanceParameter = nullptr;
+    std::atomic<float>* interpolationParameter = nullptr;
+    std::atomic<float>* chorusVoicesParameter = nullptr;
+    std::atomic<float>* chorusDetuneParameter = nullptr;
+    std::atomic<float>* oversamplingParameter = nullptr;
+    std::atomic<float>* oversamplingQualityParameter = nullptr;
+    std::atomic<float>* crushBitsParameter = nullptr;
+    std::atomic<float>* crushDownsampleParameter = nullptr;
+    std::atomic<float>* crushAntiAliasParameter = nullptr;
+    std::atomic<float>* saturationParameter = nullptr;
+    std::atomic<float>* saturationDriveParameter = nullptr;
+    std::atomic<float>* saturationCurveParameter = nullptr;
+    std::atomic<float>* wowParameter = nullptr;
+    std::atomic<float>* flutterParameter = nullptr;
+    std::atomic<float>* hissParameter = nullptr;
+    std::atomic<float>* crackleParameter = nullptr;
+    std::atomic<float>* morphParameter = nullptr;
+    std::atomic<float>* phaseSpreadParameter = nullptr;
+    std::atomic<float>* lfoRateParameter = nullptr;
+    std::atomic<float>* lfoSyncParameter = nullptr;
+    std::atomic<float>* lfoDivisionParameter = nullptr;
+    
+    // the chorus LFO's rate for this host block; synced to the host, its phase too
+    void updateLfo();
+    
+    // applies the position updateLfo() read to the LFO, the ensemble voices and wow and flutter,
+    // at the first processSamples() of the host block
+    void syncModulation();
+    double syncedCycles { 0.0 };                // main LFO cycles since the start of the song
+    double syncedSeconds { 0.0 };
+    bool syncPending { false };
+    
+    // the live parameter, or its morphed value while both snapshots are stored
+    float getStageValue(PresetMorph::Target target, const std::atomic<float>* parameter) const;
+    
+    ParameterRamp morphRamp;
+    float morphPosition { 0.0f };
+    static constexpr int morphSubBlockSize = 32;    // how often a moving morph is re-applied
+    
+    // per-sample smoothing of the parameters, filled one block at a time
+    ParameterRamp depthRamp, delayTimeRamp, cutoffRamp, resonanceRamp;
+    juce::HeapBlock<float> depthValues;         // depth per sample, in ms
+    juce::HeapBlock<float> delayTimeValues;     // delay time per sample, in ms
+    
+    // the parts of the chain that hold audio, one set per precision; only the one
+    // matching isUsingDoublePrecision() is allocated in prepareToPlay
+    template <typename SampleType>
+    struct PrecisionState
+    {
+        void prepare(int numDelayChannels, int delayBufferSamples, int numOversampledChannels, int maxBlockSize);
+        void release();
+        void selectOversampler(int factor, int quality);
+        size_t getDelayLineBytes() const;
+        
+        // the input delayed by the oversampler's latency, into dryBuffer if writeOutput is set
+        void delayDry(const juce::AudioBuffer<SampleType>& source, int numSamples, bool writeOutput);
+        
+        juce::AudioBuffer<SampleType> delayBuffer;
+        
+        // every oversampling setting is built in prepareToPlay, so switching never allocates
+        // [quality: polyphase IIR, linear-phase FIR][factor: 2x, 4x, 8x]
+        std::unique_ptr<juce::dsp::Oversampling<SampleType>> oversamplers[2][3];
+        juce::dsp::Oversampling<SampleType>* activeOversampler = nullptr;
+        int latencySamples = 0;
+        
+        // the bypass crossfade: a ring long enough for the slowest oversampler, and one block
+        // each of the dry signal and of the noise that fades out with the processed signal
+        juce::AudioBuffer<SampleType> dryDelay, dryBuffer, noiseBuffer;
+        int dryDelayPosition = 0;
+    };
+    
+    template <typename SampleType>
+    PrecisionState<SampleType>& getPrecisionState() noexcept;
+    
+    PrecisionState<float> floatState;
+    PrecisionState<double> doubleState;
+    
+    juce::HeapBlock<int> delayReadIndex;
+    juce::HeapBlock<float> delayReadFraction;
+    
+    // the chorus for a channel count fixed at compile time, 0 = any count
+    template <int NumChannels, typename SampleType>
+    void processChorusChannels(juce::AudioBuffer<SampleType>& buffer, int numChannels, int startSample, int bufferLength, int delayBufferLength);
+    
+    // the LFO shifted by phaseOffset cycles for one channel; sign becomes -1 for exactly half a cycle
+    const float* getChannelModulation(float phaseOffset, int numSamples, float& sign);
+    
+    juce::HeapBlock<float> channelModulation;   // one LFO block, for channels at other phases
+    float chunkLfoPhase { 0.0f };               // LFO phase at the start of the current chunk
+    ChorusEnsemble ensemble;                    // takes over the read when more than one voice is asked for
+    WowFlutter wowFlutter;                      // moves the delay read like an unsteady tape transport
+    static constexpr int delayGuard = 3;        // samples mirrored past the end of the delay ring
+    Bitcrusher bitcrusher;
+    SvfLowpass stateVariableFilter;
+    Saturator saturator;
+    bool saturationEnabled { false };
+    VinylNoise vinylNoise;
+    
+    int oversamplingFactor { -1 };              // power of two, 0 = off
+    int oversamplingQuality { -1 };
     
     int thisWritePosition { 0 };
+    int delayBufferMask { 0 };                  // delay ring length - 1, the length is a power of two
     
     int fs { 48000 };
+    int maxBlockSize { 512 };                   // samplesPerBlock from prepareToPlay
     
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LofijuicerAudioProcessor)
@@ -0,0 +1,142 @@
+/*
+  ==============================================================================
+
+    PresetMorph.cpp
+    Two stored parameter snapshots and the blend between them.
+
+  ==============================================================================
+*/
+
+#include "PresetMorph.h"
+#include "PluginProcessor.h"
+
+//==============================================================================
+PresetMorph::PresetMorph (juce::AudioProcessorValueTreeState& state)
+{
+    const char* ids[numTargets] =
+    {
+        ParamIDs::depth, ParamIDs::delayTime, ParamIDs::cutoff, ParamIDs::resonance, ParamIDs::interpolation,
+        ParamIDs::chorusVoices, ParamIDs::chorusDetune,
+        ParamIDs::crushBits, ParamIDs::crushDownsample, ParamIDs::crushAntiAlias,
+        ParamIDs::saturation, ParamIDs::saturationDrive, ParamIDs::saturationCurve,
+        ParamIDs::wow, ParamIDs::flutter, ParamIDs::hiss, ParamIDs::crackle
+    };
+
+    for (int target = 0; target < numTargets; ++target)
+    {
+        rawValues[target] = state.getRawParameterValue (ids[target]);
+        jassert (rawValues[target] != nullptr);
+    }
+
+    clear();
+}
+
+void PresetMorph::capture (int slot)
+{
+    float values[numTargets];
+    getLiveValues (values);
+
+    for (int target = 0; target < numTargets; ++target)
+        snapshots[slot][target].store (values[target]);
+
+    captured[slot].store (true);
+    ++generation;
+}
+
+void PresetMorph::clear()
+{
+    for (int slot = 0; slot < 2; ++slot)
+    {
+        for (auto& value : snapshots[slot])
+            value.store (0.0f);
+
+        captured[slot].store (false);
+    }
+
+    ++generation;
+}
+
+void PresetMorph::getSnapshot (int slot, float* values) const noexcept
+{
+    for (int target = 0; target < numTargets; ++target)
+        values[target] = snapshots[slot][target].load();
+}
+
+void PresetMorph::setSnapshot (int slot, const float* values) noexcept
+{
+    for (int target = 0; target < numTargets; ++target)
+        snapshots[slot][target].store (values[target]);
+
+    captured[slot].store (true);
+    ++generation;
+}
+
+void PresetMorph::getLiveValues (float* values) const noexcept
+{
+    for (int target = 0; target < numTargets; ++target)
+        values[target] = rawValues[target]->load();
+}
+
+//==============================================================================
+bool PresetMorph::update() noexcept
+{
+    const int latest = generation.load();
+
+    if (latest == seenGeneration)
+        return false;
+
+    seenGeneration = latest;
+    active = captured[0].load() && captured[1].load();
+    differingStages = 0;
+
+    for (int target = 0; target < numTargets; ++target)
+    {
+        snapshotA[target] = snapshots[0][target].load();
+        snapshotB[target] = snapshots[1][target].load();
+
+        if (snapshotA[target] != snapshotB[target])
+            differingStages |= getStage ((Target) target);
+    }
+
+    return true;
+}
+
+float PresetMorph::getValue (Target target, float position) const noexcept
+{
+    const float a = snapshotA[target], b = snapshotB[target];
+
+    if (isContinuous (target))
+        return a + position * (b - a);
+
+    return position < 0.5f ? a : b;
+}
+
+uint32_t PresetMorph::getStage (Target target) noexcept
+{
+    switch (target)
+    {
+        case depth: case delayTime: case interpolation:         return chorusStage;
+        case chorusVoices: case chorusDetune:                   return ensembleStage;
+        case cutoff: case resonance:                            return filterStage;
+        case crushBits: case crushDownsample: case crushAntiAlias: return crusherStage;
+        case saturation: case saturationDrive: case saturationCurve: return saturatorStage;
+        case wow: case flutter:                                 return wowFlutterStage;
+        case hiss: case crackle:                                return noiseStage;
+        case numTargets:                                        break;
+    }
+
+    return 0;
+}
+
+bool PresetMorph::isContinuous (Target target) noexcept
+{
+    switch (target)
+    {
+        case interpolation: case chorusVoices: case crushAntiAlias:
+        case saturation: case saturationCurve:
+            return false;
+
+        default:
+            return true;
+    }
+}
@@ -0,0 +1,96 @@
+/*
+  ==============================================================================
+
+    PresetMorph.h
+    Two stored parameter snapshots and the blend between them.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Snapshot A and B each hold a value for every morphable parameter. Continuous
+    parameters are blended linearly, switches and choices flip at the halfway
+    point. Once both snapshots are stored the morph drives those parameters
+    instead of their own controls.
+
+    capture() runs on the message thread and only writes atomics. update() is
+    called at the top of every block on the audio thread. It copies the
+    snapshots locally when they have changed, and works out which processing
+    stages have any parameter that differs between A and B. Only those stages
+    need updating while the morph moves.
+*/
+class PresetMorph
+{
+public:
+    /** Morphable parameters. Saved state relies on this order, so only ever add at the end. */
+    enum Target
+    {
+        depth = 0, delayTime, cutoff, resonance, interpolation,
+        chorusVoices, chorusDetune,
+        crushBits, crushDownsample, crushAntiAlias,
+        saturation, saturationDrive, saturationCurve,
+        wow, flutter, hiss, crackle,
+        numTargets
+    };
+
+    /** Groups of targets that are applied to the DSP together. */
+    enum Stage : uint32_t
+    {
+        chorusStage     = 1 << 0,       // depth, delay time, interpolation
+        ensembleStage   = 1 << 1,
+        filterStage     = 1 << 2,
+        crusherStage    = 1 << 3,
+        saturatorStage  = 1 << 4,
+        wowFlutterStage = 1 << 5,
+        noiseStage      = 1 << 6,
+        allStages       = (1 << 7) - 1
+    };
+
+    explicit PresetMorph (juce::AudioProcessorValueTreeState& state);
+
+    /** Message thread: stores the parameters' current values as snapshot 0 (A) or 1 (B). */
+    void capture (int slot);
+    void clear();
+
+    /** For saved state. values holds numTargets plain parameter values. */
+    bool hasSnapshot (int slot) const noexcept      { return captured[slot].load(); }
+    void getSnapshot (int slot, float* values) const noexcept;
+    void setSnapshot (int slot, const float* values) noexcept;
+
+    /** The parameters' current values, in snapshot layout. */
+    void getLiveValues (float* values) const noexcept;
+
+    /** Audio thread, once per block. Returns true if the snapshots were stored or cleared since the last call. */
+    bool update() noexcept;
+
+    /** Audio thread: both snapshots are stored, so the morph is in charge. */
+    bool isActive() const noexcept                  { return active; }
+    uint32_t getDifferingStages() const noexcept    { return differingStages; }
+
+    /** Audio thread: the target's value at a morph position from 0 (A) to 1 (B). */
+    float getValue (Target target, float position) const noexcept;
+
+private:
+    static uint32_t getStage (Target target) noexcept;
+    static bool isContinuous (Target target) noexcept;
+
+    std::atomic<float>* rawValues[numTargets] {};
+
+    // written by the message thread
+    std::atomic<float> snapshots[2][numTargets];
+    std::atomic<bool> captured[2];
+    std::atomic<int> generation { 0 };
+
+    // audio thread copies
+    float snapshotA[numTargets] {}, snapshotB[numTargets] {};
+    int seenGeneration = -1;
+    bool active = false;
+    uint32_t differingStages = 0;
+
+    JUCE_DECLARE_NON_COPYABLE (PresetMorph)
+};
@@ -0,0 +1,123 @@
+/*
+  ==============================================================================
+
+    ProgramBank.cpp
+    Factory programs, resolved to parameter values once at construction.
+
+  ==============================================================================
+*/
+
+#include "ProgramBank.h"
+#include "PluginProcessor.h"
+
+namespace
+{
+    struct FactoryValue
+    {
+        const char* parameterID;
+        float value;                        // in the parameter's own units
+    };
+
+    struct FactoryProgram
+    {
+        const char* name;
+        FactoryValue values[12];            // ends at the first null ID; anything not listed keeps its default
+    };
+
+    const FactoryProgram factoryPrograms[] =
+    {
+        { "Init", {} },
+
+        { "Dusty Tape", { { ParamIDs::cutoff, 600.0f }, { ParamIDs::resonance, 1.5f },
+                          { ParamIDs::depth, 0.3f }, { ParamIDs::delayTime, 20.0f },
+                          { ParamIDs::saturation, 1.0f }, { ParamIDs::saturationCurve, 1.0f }, { ParamIDs::saturationDrive, 9.0f },
+                          { ParamIDs::wow, 0.35f }, { ParamIDs::flutter, 0.25f }, { ParamIDs::hiss, 0.3f } } },
+
+        { "Worn Vinyl", { { ParamIDs::cutoff, 400.0f },
+                          { ParamIDs::saturation, 1.0f }, { ParamIDs::saturationCurve, 0.0f }, { ParamIDs::saturationDrive, 4.0f },
+                          { ParamIDs::wow, 0.15f }, { ParamIDs::hiss, 0.45f }, { ParamIDs::crackle, 0.6f } } },
+
+        { "Broken Radio", { { ParamIDs::crushBits, 6.0f }, { ParamIDs::crushDownsample, 6.0f },
+                            { ParamIDs::cutoff, 900.0f }, { ParamIDs::resonance, 6.0f },
+                            { ParamIDs::saturation, 1.0f }, { ParamIDs::saturationCurve, 2.0f }, { ParamIDs::saturationDrive, 12.0f },
+                            { ParamIDs::hiss, 0.5f } } },
+
+        { "Cassette Chorus", { { ParamIDs::chorusVoices, 4.0f }, { ParamIDs::chorusDetune, 0.4f },
+                               { ParamIDs::depth, 0.8f }, { ParamIDs::delayTime, 30.0f },
+                               { ParamIDs::wow, 0.5f }, { ParamIDs::flutter, 0.4f } } },
+
+        { "Crushed Beat", { { ParamIDs::crushBits, 8.0f }, { ParamIDs::crushDownsample, 3.0f }, { ParamIDs::crushAntiAlias, 0.0f },
+                            { ParamIDs::cutoff, 1000.0f }, { ParamIDs::resonance, 1.0f } } },
+    };
+}
+
+//==============================================================================
+ProgramBank::ProgramBank (juce::AudioProcessor& processor, juce::AudioProcessorValueTreeState& state)
+{
+    for (auto* parameter : processor.getParameters())
+    {
+        if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*> (parameter))
+        {
+            parameterList.push_back (ranged);
+            rawValues.push_back (state.getRawParameterValue (ranged->paramID));
+        }
+    }
+
+    for (const auto& factory : factoryPrograms)
+    {
+        Program program { factory.name, {} };
+
+        for (auto* parameter : parameterList)
+            program.values.push_back (parameter->getDefaultValue());
+
+        for (const auto& value : factory.values)
+        {
+            if (value.parameterID == nullptr)
+                break;
+
+            for (size_t i = 0; i < parameterList.size(); ++i)
+                if (parameterList[i]->paramID == value.parameterID)
+                    program.values[i] = parameterList[i]->convertTo0to1 (value.value);
+        }
+
+        programs.push_back (std::move (program));
+    }
+}
+
+juce::String ProgramBank::getName (int index) const
+{
+    return juce::isPositiveAndBelow (index, getNumPrograms()) ? programs[(size_t) index].name : juce::String();
+}
+
+void ProgramBank::applyNotifyingHost (int index) const
+{
+    if (! juce::isPositiveAndBelow (index, getNumPrograms()))
+        return;
+
+    const auto& values = programs[(size_t) index].values;
+
+    for (size_t i = 0; i < parameterList.size(); ++i)
+        parameterList[i]->setValueNotifyingHost (values[i]);
+}
+
+void ProgramBank::applySilently (int index) const noexcept
+{
+    if (! juce::isPositiveAndBelow (index, getNumPrograms()))
+        return;
+
+    const auto& values = programs[(size_t) index].values;
+
+    for (size_t i = 0; i < parameterList.size(); ++i)
+    {
+        parameterList[i]->setValue (values[i]);
+
+        if (rawValues[i] != nullptr)
+            rawValues[i]->store (parameterList[i]->convertFrom0to1 (values[i]));
+    }
+}
+
+void ProgramBank::announce() const
+{
+    for (auto* parameter : parameterList)
+        parameter->sendValueChangedMessageToListeners (parameter->getValue());
+}
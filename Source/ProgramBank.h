@@ -0,0 +1,50 @@
+/*
+  ==============================================================================
+
+    ProgramBank.h
+    Factory programs, resolved to parameter values once at construction.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Every factory program is turned into one normalised value per parameter when
+    the bank is built, in the order of AudioProcessor::getParameters(), so
+    switching programs later only copies floats.
+
+    applyNotifyingHost() is the normal message thread path. applySilently() is
+    for hosts that switch programs on the audio thread: it only stores the new
+    values, in the parameters and in the raw values processBlock reads, without
+    taking locks or allocating. announce() then tells the listeners from the
+    message thread.
+*/
+class ProgramBank
+{
+public:
+    ProgramBank (juce::AudioProcessor& processor, juce::AudioProcessorValueTreeState& state);
+
+    int getNumPrograms() const noexcept                 { return (int) programs.size(); }
+    juce::String getName (int index) const;
+
+    void applyNotifyingHost (int index) const;
+    void applySilently (int index) const noexcept;
+    void announce() const;
+
+private:
+    struct Program
+    {
+        juce::String name;
+        std::vector<float> values;          // normalised, one per parameter
+    };
+
+    std::vector<juce::RangedAudioParameter*> parameterList;
+    std::vector<std::atomic<float>*> rawValues;
+    std::vector<Program> programs;
+
+    JUCE_DECLARE_NON_COPYABLE (ProgramBank)
+};
@@ -0,0 +1,231 @@
+/*
+  ==============================================================================
+
+    Saturator.cpp
+    Table-based saturation with first-order antiderivative anti-aliasing.
+
+  ==============================================================================
+*/
+
+#include "Saturator.h"
+
+//==============================================================================
+/** f and F sampled over [-range, range]; outside it f is held and F continues linearly. */
+struct Saturator::Table
+{
+    static constexpr int size = 4097;
+    static constexpr float range = 16.0f;
+    static constexpr float scale = (float) (size - 1) / (2.0f * range);
+
+    float f[size];
+    double F[size];
+
+    template <typename Function>
+    explicit Table (Function transfer)
+    {
+        const double step = 2.0 * range / (size - 1);
+
+        for (int i = 0; i < size; ++i)
+            f[i] = (float) transfer (-range + step * i);
+
+        // F is the exact integral of the piecewise-linear f, zero at x = 0, so the
+        // ADAA difference quotient has no table error of its own to amplify
+        double integral = 0.0;
+        F[0] = 0.0;
+
+        for (int i = 1; i < size; ++i)
+        {
+            integral += 0.5 * ((double) f[i - 1] + (double) f[i]) * step;
+            F[i] = integral;
+        }
+
+        const double atZero = F[(size - 1) / 2];
+
+        for (int i = 0; i < size; ++i)
+            F[i] -= atZero;
+    }
+
+    /** f by linear interpolation, x already clamped to the range. */
+    inline float lookupTransfer (float clampedX) const noexcept
+    {
+        const float position = (clampedX + range) * scale;
+        const int index = juce::jmin ((int) position, size - 2);
+        const float fraction = position - (float) index;
+        return f[index] + fraction * (f[index + 1] - f[index]);
+    }
+
+    /** F integrated from the same linear segments, x already clamped to the range.
+        In double, since the ADAA quotient divides differences of it by small steps. */
+    inline double lookupAntiderivative (double clampedX) const noexcept
+    {
+        const double position = (clampedX + range) * scale;
+        const int index = juce::jmin ((int) position, size - 2);
+        const double fraction = position - (double) index;
+        const double slope = (double) f[index + 1] - (double) f[index];
+        return F[index] + (fraction * ((double) f[index] + 0.5 * fraction * slope)) / scale;
+    }
+};
+
+const Saturator::Table& Saturator::getTable (Curve curve)
+{
+    static const Table tanhTable ([] (double x) { return std::tanh (x); });
+
+    static const Table tapeTable ([] (double x)
+    {
+        constexpr double bias = 0.25;
+        return std::tanh (x + bias) - std::tanh (bias);
+    });
+
+    static const Table diodeTable ([] (double x)
+    {
+        return x >= 0.0 ? 1.0 - std::exp (-x) : -0.6 * (1.0 - std::exp (x / 0.6));
+    });
+
+    switch (curve)
+    {
+        case Curve::tape:   return tapeTable;
+        case Curve::diode:  return diodeTable;
+        case Curve::tanh:
+        default:            return tanhTable;
+    }
+}
+
+//==============================================================================
+void Saturator::prepare (double sampleRate, int numChannels, int maxBlockSize)
+{
+    // build the tables here, never on the audio thread
+    getTable (Curve::tanh);
+    getTable (Curve::tape);
+    getTable (Curve::diode);
+
+    numPreparedChannels = numChannels;
+    maxSamples = maxBlockSize;
+
+    for (auto* state : { &lastInput, &lastAntiderivative, &dcInput, &dcOutput })
+        state->allocate ((size_t) numChannels, true);
+
+    antiderivatives.allocate ((size_t) maxBlockSize, true);
+    shaped.allocate ((size_t) maxBlockSize, true);
+
+    fs = 0.0;
+    setSampleRate (sampleRate);
+    drive = targetDrive;
+}
+
+void Saturator::reset()
+{
+    for (auto* state : { &lastInput, &lastAntiderivative, &dcInput, &dcOutput })
+        juce::FloatVectorOperations::clear (state->get(), numPreparedChannels);
+}
+
+void Saturator::setSampleRate (double newSampleRate)
+{
+    if (newSampleRate == fs)
+        return;
+
+    fs = newSampleRate;
+
+    // 5 Hz one-pole DC blocker for the asymmetric curves
+    dcCoefficient = (float) (1.0 - juce::MathConstants<double>::twoPi * 5.0 / fs);
+    reset();
+}
+
+void Saturator::setDrive (float newDriveDecibels)
+{
+    targetDrive = juce::Decibels::decibelsToGain (newDriveDecibels);
+}
+
+template <typename SampleType>
+void Saturator::process (const juce::dsp::AudioBlock<SampleType>& block)
+{
+    const int numChannels = juce::jmin ((int) block.getNumChannels(), numPreparedChannels);
+    const int numSamples = juce::jmin ((int) block.getNumSamples(), maxSamples);
+    jassert ((int) block.getNumSamples() <= maxSamples);
+
+    if (numSamples <= 0)
+        return;
+
+    const Table& table = getTable (curve);
+    const SampleType gainStep = (SampleType) ((targetDrive - drive) / (float) numSamples);
+
+    // the makeup gain moves with the drive, so a drive change doesn't step the level
+    const float startMakeup = 1.0f / std::sqrt (drive);
+    const float endMakeup = drive == targetDrive ? startMakeup : 1.0f / std::sqrt (targetDrive);
+    const SampleType makeupStep = (SampleType) ((endMakeup - startMakeup) / (float) numSamples);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+        processChannel (block.getChannelPointer ((size_t) channel), channel, numSamples, table,
+                        (SampleType) drive, gainStep, (SampleType) startMakeup, makeupStep);
+
+    drive = targetDrive;
+}
+
+//==============================================================================
+template <typename SampleType>
+void Saturator::processChannel (SampleType* data, int channel, int numSamples, const Table& table,
+                                SampleType startGain, SampleType gainStep,
+                                SampleType startMakeup, SampleType makeupStep) noexcept
+{
+    double* F = antiderivatives.get();
+    SampleType* y = reinterpret_cast<SampleType*> (shaped.get());
+
+    const SampleType lowEdge = table.f[0];
+    const SampleType highEdge = table.f[Table::size - 1];
+    const SampleType range = Table::range;
+
+    // drive, then F(x) for every sample
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const SampleType x = data[i] * (startGain + gainStep * (SampleType) (i + 1));
+        const SampleType clamped = juce::jlimit (-range, range, x);
+        const SampleType excess = x - clamped;
+
+        data[i] = x;
+        F[i] = table.lookupAntiderivative ((double) clamped) + (double) (excess * (excess > SampleType (0) ? highEdge : lowEdge));
+    }
+
+    // F is in double, so the quotient only loses to cancellation once the step is about
+    // this small; below it f(midpoint) is closer to the true average anyway
+    const double eps = std::is_same<SampleType, float>::value ? 1.0e-5 : 1.0e-8;
+    const auto adaa = [&] (SampleType x, SampleType xPrev, double Fx, double FPrev)
+    {
+        const double dx = (double) x - (double) xPrev;
+        const bool close = std::abs (dx) < eps;
+        const SampleType midpoint = table.lookupTransfer ((float) juce::jlimit (-range, range, SampleType (0.5) * (x + xPrev)));
+        return close ? midpoint : (SampleType) ((Fx - FPrev) / (close ? 1.0 : dx));
+    };
+
+    // first sample against the last one of the previous block
+    y[0] = adaa (data[0], (SampleType) lastInput[channel], F[0], lastAntiderivative[channel]);
+
+    for (int i = 1; i < numSamples; ++i)
+        y[i] = adaa (data[i], data[i - 1], F[i], F[i - 1]);
+
+    lastInput[channel] = data[numSamples - 1];
+    lastAntiderivative[channel] = F[numSamples - 1];
+
+    for (int i = 0; i < numSamples; ++i)
+        data[i] = y[i] * (startMakeup + makeupStep * (SampleType) (i + 1));
+
+    // the asymmetric curves add DC, take it out again
+    if (curve != Curve::tanh)
+    {
+        const SampleType R = dcCoefficient;
+        SampleType x1 = (SampleType) dcInput[channel];
+        SampleType y1 = (SampleType) dcOutput[channel];
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const SampleType x = data[i];
+            y1 = x - x1 + R * y1;
+            x1 = x;
+            data[i] = y1;
+        }
+
+        dcInput[channel] = x1;
+        dcOutput[channel] = y1;
+    }
+}
+
+template void Saturator::process<float> (const juce::dsp::AudioBlock<float>&);
+template void Saturator::process<double> (const juce::dsp::AudioBlock<double>&);
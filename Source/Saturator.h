@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    Saturator.h
+    Table-based saturation with first-order antiderivative anti-aliasing.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Waveshaper with first-order antiderivative anti-aliasing (ADAA):
+
+        y[n] = (F(x[n]) - F(x[n-1])) / (x[n] - x[n-1])
+
+    falling back to f of the midpoint when consecutive inputs are too close.
+    Both the transfer curve f and its antiderivative F come from lookup tables
+    built once per process, so the audio thread never calls into libm. Each pass
+    over the block is written without loop-carried state so it vectorizes.
+
+    process() runs in float or double. f is a float table in both; F, the
+    difference quotient and the per-channel state are kept in double, so the
+    quotient stays accurate for steps far smaller than audio moves by and the
+    midpoint fallback only catches near-constant input.
+*/
+class Saturator
+{
+public:
+    enum class Curve
+    {
+        tanh = 0,
+        tape,           // tanh with a bias, asymmetric, even harmonics
+        diode           // hard on the positive side, soft and lower on the negative
+    };
+
+    Saturator() = default;
+
+    void prepare (double sampleRate, int numChannels, int maxBlockSize);
+    void reset();
+
+    /** Call when the stage moves to an oversampled rate; only the DC blocker depends on it. */
+    void setSampleRate (double newSampleRate);
+
+    void setCurve (Curve newCurve)          { curve = newCurve; }
+    void setDrive (float newDriveDecibels);
+
+    template <typename SampleType>
+    void process (const juce::dsp::AudioBlock<SampleType>& block);
+
+private:
+    struct Table;
+    static const Table& getTable (Curve curve);
+
+    template <typename SampleType>
+    void processChannel (SampleType* data, int channel, int numSamples, const Table& table,
+                         SampleType startGain, SampleType gainStep,
+                         SampleType startMakeup, SampleType makeupStep) noexcept;
+
+    double fs = 48000.0;
+    Curve curve = Curve::tanh;
+    int numPreparedChannels = 0, maxSamples = 0;
+
+    // drive, and the makeup gain that follows it, are ramped over each block when it changes
+    float drive = 1.0f, targetDrive = 1.0f;
+
+    // per channel: previous input and its antiderivative, DC blocker state
+    juce::HeapBlock<double> lastInput, lastAntiderivative, dcInput, dcOutput;
+    float dcCoefficient = 0.999f;
+
+    // scratch, maxSamples doubles each: F always in double, the shaped block in either precision
+    juce::HeapBlock<double> antiderivatives, shaped;
+};
@@ -0,0 +1,75 @@
+/*
+  ==============================================================================
+
+    StageProfiler.cpp
+    Time spent in each stage of processBlock, counted on the audio thread and
+    read by the editor's debug panel and the render harness.
+
+  ==============================================================================
+*/
+
+#include "StageProfiler.h"
+
+//==============================================================================
+StageTotals StageTotals::operator- (const StageTotals& earlier) const noexcept
+{
+    StageTotals difference;
+
+    for (int stage = 0; stage < (int) ProfiledStage::numStages; ++stage)
+        difference.ticks[stage] = ticks[stage] - earlier.ticks[stage];
+
+    difference.numSamples = numSamples - earlier.numSamples;
+    difference.numBlocks = numBlocks - earlier.numBlocks;
+    return difference;
+}
+
+double StageTotals::getSeconds (ProfiledStage stage) const noexcept
+{
+    return juce::Time::highResolutionTicksToSeconds (ticks[(int) stage]);
+}
+
+//==============================================================================
+void StageProfiler::add (ProfiledStage stage, juce::int64 numTicks) noexcept
+{
+    // single writer, so a load and a store are enough
+    auto& total = ticks[(int) stage];
+    total.store (total.load (std::memory_order_relaxed) + numTicks, std::memory_order_relaxed);
+}
+
+void StageProfiler::addBlock (int numSamplesInBlock) noexcept
+{
+    if (! isActive())
+        return;
+
+    numSamples.store (numSamples.load (std::memory_order_relaxed) + numSamplesInBlock, std::memory_order_relaxed);
+    numBlocks.store (numBlocks.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+StageTotals StageProfiler::getTotals() const noexcept
+{
+    StageTotals totals;
+
+    for (int stage = 0; stage < numStages; ++stage)
+        totals.ticks[stage] = ticks[stage].load (std::memory_order_relaxed);
+
+    totals.numSamples = numSamples.load (std::memory_order_relaxed);
+    totals.numBlocks = numBlocks.load (std::memory_order_relaxed);
+    return totals;
+}
+
+const char* StageProfiler::getStageName (ProfiledStage stage) noexcept
+{
+    switch (stage)
+    {
+        case ProfiledStage::processBlock:   return "processBlock";
+        case ProfiledStage::crusher:        return "crusher";
+        case ProfiledStage::filter:         return "filter";
+        case ProfiledStage::lfo:            return "lfo";
+        case ProfiledStage::delayWrite:     return "delay write";
+        case ProfiledStage::delayRead:      return "delay read";
+        case ProfiledStage::noise:          return "noise";
+        case ProfiledStage::numStages:      break;
+    }
+
+    return "";
+}
@@ -0,0 +1,121 @@
+/*
+  ==============================================================================
+
+    StageProfiler.h
+    Time spent in each stage of processBlock, counted on the audio thread and
+    read by the editor's debug panel and the render harness.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+// the timers are built into debug builds; define this as 1 to have them in a release build too
+#ifndef LOFIJUICER_ENABLE_STAGE_TIMING
+ #if JUCE_DEBUG
+  #define LOFIJUICER_ENABLE_STAGE_TIMING 1
+ #else
+  #define LOFIJUICER_ENABLE_STAGE_TIMING 0
+ #endif
+#endif
+
+//==============================================================================
+/** The parts of processBlock that are timed separately. */
+enum class ProfiledStage
+{
+    processBlock = 0,       // the whole callback, every stage below included
+    crusher,
+    filter,                 // filter and saturation, with the oversampling around them
+    lfo,                    // LFO, delay time and depth ramps, wow and flutter
+    delayWrite,
+    delayRead,
+    noise,
+    numStages
+};
+
+/** Counts since the profiler was created; subtract two of them for the time in between. */
+struct StageTotals
+{
+    juce::int64 ticks[(int) ProfiledStage::numStages] = {};    // Time::getHighResolutionTicks units
+    juce::int64 numSamples = 0;         // host samples processed while timing was on
+    juce::int64 numBlocks = 0;
+
+    StageTotals operator- (const StageTotals& earlier) const noexcept;
+
+    double getSeconds (ProfiledStage stage) const noexcept;
+};
+
+//==============================================================================
+/**
+    Per-instance stage timing. Only the audio thread writes the counters, so it
+    stores to them without locking or read-modify-writes, and any thread can take
+    a snapshot with getTotals() at any time.
+
+    Timing only happens while isActive(), which the editor's debug panel and the
+    render harness turn on for as long as they need it, so otherwise a timed scope
+    costs one atomic load. With LOFIJUICER_ENABLE_STAGE_TIMING at 0 the scopes
+    compile to nothing.
+*/
+class StageProfiler
+{
+public:
+    StageProfiler() = default;
+
+    static constexpr bool isCompiledIn() noexcept   { return LOFIJUICER_ENABLE_STAGE_TIMING != 0; }
+
+    void addListener() noexcept         { ++numListeners; }
+    void removeListener() noexcept      { --numListeners; }
+    bool isActive() const noexcept      { return numListeners.load (std::memory_order_relaxed) > 0; }
+
+    /** Audio thread. */
+    void add (ProfiledStage stage, juce::int64 ticks) noexcept;
+    void addBlock (int numSamples) noexcept;
+
+    /** Any thread. */
+    StageTotals getTotals() const noexcept;
+
+    static const char* getStageName (ProfiledStage stage) noexcept;
+
+    /** Times the enclosing scope into one stage, if the profiler was active when it began. */
+    class ScopedTimer
+    {
+    public:
+        ScopedTimer (StageProfiler& profilerToUse, ProfiledStage stageToTime) noexcept
+            : profiler (profilerToUse), stage (stageToTime), timing (profilerToUse.isActive()),
+              start (timing ? juce::Time::getHighResolutionTicks() : 0)
+        {
+        }
+
+        ~ScopedTimer() noexcept
+        {
+            if (timing)
+                profiler.add (stage, juce::Time::getHighResolutionTicks() - start);
+        }
+
+    private:
+        StageProfiler& profiler;
+        const ProfiledStage stage;
+        const bool timing;
+        const juce::int64 start;
+
+        JUCE_DECLARE_NON_COPYABLE (ScopedTimer)
+    };
+
+private:
+    static constexpr int numStages = (int) ProfiledStage::numStages;
+
+    std::atomic<juce::int64> ticks[numStages] {};
+    std::atomic<juce::int64> numSamples { 0 }, numBlocks { 0 };
+    std::atomic<int> numListeners { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE (StageProfiler)
+};
+
+#if LOFIJUICER_ENABLE_STAGE_TIMING
+ #define LOFIJUICER_TIME_STAGE(profiler, stage) \
+    const StageProfiler::ScopedTimer JUCE_JOIN_MACRO (stageTimer, __LINE__) (profiler, ProfiledStage::stage)
+#else
+ #define LOFIJUICER_TIME_STAGE(profiler, stage)
+#endif
@@ -0,0 +1,70 @@
+/*
+  ==============================================================================
+
+    StageProfilerPanel.cpp
+    Debug panel showing where processBlock's time goes.
+
+  ==============================================================================
+*/
+
+#include "StageProfilerPanel.h"
+
+namespace
+{
+    constexpr int refreshIntervalMs = 500;
+}
+
+//==============================================================================
+StageProfilerPanel::StageProfilerPanel (StageProfiler& profilerToRead)
+    : profiler (profilerToRead)
+{
+    setOpaque (true);
+    profiler.addListener();
+    previous = profiler.getTotals();
+    startTimer (refreshIntervalMs);
+}
+
+StageProfilerPanel::~StageProfilerPanel()
+{
+    stopTimer();
+    profiler.removeListener();
+}
+
+void StageProfilerPanel::timerCallback()
+{
+    const auto latest = profiler.getTotals();
+    shown = latest - previous;
+    previous = latest;
+    repaint();
+}
+
+void StageProfilerPanel::paint (juce::Graphics& g)
+{
+    g.fillAll (juce::Colours::black);
+    g.setColour (juce::Colours::limegreen);
+    g.setFont (juce::Font (juce::Font::getDefaultMonospacedFontName(), 11.0f, juce::Font::plain));
+
+    auto area = getLocalBounds().reduced (4, 2);
+    const int rowHeight = area.getHeight() / (int) ProfiledStage::numStages;
+
+    if (shown.numBlocks == 0)
+    {
+        g.drawText ("no blocks processed", area, juce::Justification::centred);
+        return;
+    }
+
+    const double wholeBlock = shown.getSeconds (ProfiledStage::processBlock);
+
+    for (int stage = 0; stage < (int) ProfiledStage::numStages; ++stage)
+    {
+        auto row = area.removeFromTop (rowHeight);
+        const double seconds = shown.getSeconds ((ProfiledStage) stage);
+        const double usPerBlock = seconds * 1.0e6 / (double) shown.numBlocks;
+        const double share = wholeBlock > 0.0 ? seconds / wholeBlock * 100.0 : 0.0;
+
+        g.drawText (StageProfiler::getStageName ((ProfiledStage) stage), row.removeFromLeft (row.getWidth() / 2),
+                    juce::Justification::centredLeft);
+        g.drawText (juce::String (usPerBlock, 1) + " us " + juce::String (share, 0) + "%", row,
+                    juce::Justification::centredRight);
+    }
+}
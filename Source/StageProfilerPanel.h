@@ -0,0 +1,38 @@
+/*
+  ==============================================================================
+
+    StageProfilerPanel.h
+    Debug panel showing where processBlock's time goes.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "StageProfiler.h"
+
+//==============================================================================
+/**
+    Reads the processor's StageProfiler twice a second and lists, for the time
+    in between, each stage's average cost per block and its share of the whole
+    processBlock. Switches the profiler on while it exists.
+*/
+class StageProfilerPanel  : public juce::Component,
+                            private juce::Timer
+{
+public:
+    explicit StageProfilerPanel (StageProfiler& profilerToRead);
+    ~StageProfilerPanel() override;
+
+    void paint (juce::Graphics&) override;
+
+private:
+    void timerCallback() override;
+
+    StageProfiler& profiler;
+    StageTotals previous;                   // totals at the last tick
+    StageTotals shown;                      // what happened between the last two ticks
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (StageProfilerPanel)
+};
@@ -0,0 +1,155 @@
+/*
+  ==============================================================================
+
+    SvfLowpass.cpp
+    Topology-preserving (TPT) state variable low-pass filter with coefficient
+    ramps, replacing juce::dsp::StateVariableFilter in the processor.
+
+  ==============================================================================
+*/
+
+#include "SvfLowpass.h"
+
+//==============================================================================
+void SvfLowpass::prepare (double sampleRate, int numChannels, float cutoff, float resonance)
+{
+    fs = sampleRate;
+
+    s1.allocate ((size_t) numChannels, true);
+    s2.allocate ((size_t) numChannels, true);
+    numPreparedChannels = numChannels;
+
+    // jump straight to the settings, there is nothing to ramp from yet
+    lastCutoff = lastResonance = -1.0f;
+    setTargetParameters (cutoff, resonance);
+    g = targetG;
+    R2 = targetR2;
+}
+
+void SvfLowpass::reset()
+{
+    juce::FloatVectorOperations::clear (s1.get(), numPreparedChannels);
+    juce::FloatVectorOperations::clear (s2.get(), numPreparedChannels);
+}
+
+void SvfLowpass::setSampleRate (double newSampleRate)
+{
+    if (newSampleRate == fs)
+        return;
+
+    fs = newSampleRate;
+
+    const float cutoff = lastCutoff;
+    const float resonance = lastResonance;
+    lastCutoff = lastResonance = -1.0f;
+
+    setTargetParameters (cutoff, resonance);
+    g = targetG;
+    R2 = targetR2;
+    reset();
+}
+
+void SvfLowpass::setTargetParameters (float cutoff, float resonance)
+{
+    if (cutoff == lastCutoff && resonance == lastResonance)
+        return;
+
+    lastCutoff = cutoff;
+    lastResonance = resonance;
+
+    // keep the prewarped cutoff below Nyquist
+    const double safeCutoff = juce::jmin ((double) cutoff, 0.49 * fs);
+
+    targetG = (float) std::tan (juce::MathConstants<double>::pi * safeCutoff / fs);
+    targetR2 = 1.0f / resonance;
+}
+
+template <typename SampleType>
+void SvfLowpass::process (const juce::dsp::AudioBlock<SampleType>& block)
+{
+    jassert ((int) block.getNumChannels() <= numPreparedChannels);
+    const int numChannels = juce::jmin ((int) block.getNumChannels(), numPreparedChannels);
+    const int numSamples = (int) block.getNumSamples();
+
+    if (numSamples <= 0)
+        return;
+
+    if (! isRamping())
+    {
+        for (int channel = 0; channel < numChannels; ++channel)
+            processChannel (block.getChannelPointer ((size_t) channel), channel, numSamples);
+
+        return;
+    }
+
+    for (int channel = 0; channel < numChannels; ++channel)
+        processChannelRamped (block.getChannelPointer ((size_t) channel), channel, numSamples);
+
+    // every channel ramped from the same start, so the target is reached now
+    g = targetG;
+    R2 = targetR2;
+}
+
+//==============================================================================
+template <typename SampleType>
+void SvfLowpass::processChannel (SampleType* data, int channel, int numSamples) noexcept
+{
+    const SampleType gain = g;
+    const SampleType r2 = R2;
+    const SampleType damping = r2 + gain;
+    const SampleType h = SampleType (1) / (SampleType (1) + r2 * gain + gain * gain);
+
+    SampleType z1 = (SampleType) s1[channel];
+    SampleType z2 = (SampleType) s2[channel];
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const SampleType yHP = h * (data[i] - damping * z1 - z2);
+
+        const SampleType yBP = yHP * gain + z1;
+        z1 = yHP * gain + yBP;
+
+        const SampleType yLP = yBP * gain + z2;
+        z2 = yBP * gain + yLP;
+
+        data[i] = yLP;
+    }
+
+    s1[channel] = z1;
+    s2[channel] = z2;
+}
+
+template <typename SampleType>
+void SvfLowpass::processChannelRamped (SampleType* data, int channel, int numSamples) noexcept
+{
+    // linear steps in g and R2; h is exact per sample so the structure stays a TPT SVF
+    const SampleType startG = g, startR2 = R2;
+    const SampleType gStep = ((SampleType) targetG - startG) / (SampleType) numSamples;
+    const SampleType R2Step = ((SampleType) targetR2 - startR2) / (SampleType) numSamples;
+
+    SampleType z1 = (SampleType) s1[channel];
+    SampleType z2 = (SampleType) s2[channel];
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const SampleType gain = startG + gStep * (SampleType) (i + 1);
+        const SampleType r2 = startR2 + R2Step * (SampleType) (i + 1);
+        const SampleType h = SampleType (1) / (SampleType (1) + r2 * gain + gain * gain);
+
+        const SampleType yHP = h * (data[i] - (r2 + gain) * z1 - z2);
+
+        const SampleType yBP = yHP * gain + z1;
+        z1 = yHP * gain + yBP;
+
+        const SampleType yLP = yBP * gain + z2;
+        z2 = yBP * gain + yLP;
+
+        data[i] = yLP;
+    }
+
+    s1[channel] = z1;
+    s2[channel] = z2;
+}
+
+template void SvfLowpass::process<float> (const juce::dsp::AudioBlock<float>&);
+template void SvfLowpass::process<double> (const juce::dsp::AudioBlock<double>&);
@@ -0,0 +1,71 @@
+/*
+  ==============================================================================
+
+    SvfLowpass.h
+    Topology-preserving (TPT) state variable low-pass filter with coefficient
+    ramps, replacing juce::dsp::StateVariableFilter in the processor.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Same response as juce::dsp::StateVariableFilter's low-pass (g = tan(pi fc / fs),
+    R2 = 1 / resonance), but coefficients are only recomputed when cutoff or
+    resonance change, and a change is spread over the next block by ramping g and
+    R2 per sample instead of jumping at the block boundary.
+
+    process() runs in float or double. The state is kept in double so either
+    precision can follow the other; the float path still computes in float.
+*/
+class SvfLowpass
+{
+public:
+    SvfLowpass() = default;
+
+    /** Allocates the per-channel state and jumps to the given settings. */
+    void prepare (double sampleRate, int numChannels, float cutoff, float resonance);
+
+    /** Clears the filter state without touching the coefficients. */
+    void reset();
+
+    /** Moves to a new sample rate (e.g. when oversampling changes), jumping to the
+        coefficients for the current settings and clearing the state. */
+    void setSampleRate (double newSampleRate);
+
+    /** Sets the coefficients the next process() call ramps towards.
+        Does nothing (not even the tan()) if neither value has changed. */
+    void setTargetParameters (float cutoff, float resonance);
+
+    /** True while the last target has not been reached yet. */
+    bool isRamping() const noexcept     { return g != targetG || R2 != targetR2; }
+
+    /** The cutoff last set, in Hz. */
+    float getCutoff() const noexcept    { return lastCutoff; }
+
+    /** Filters every channel of the block in place. */
+    template <typename SampleType>
+    void process (const juce::dsp::AudioBlock<SampleType>& block);
+
+private:
+    template <typename SampleType>
+    void processChannel (SampleType* data, int channel, int numSamples) noexcept;
+
+    template <typename SampleType>
+    void processChannelRamped (SampleType* data, int channel, int numSamples) noexcept;
+
+    double fs = 48000.0;
+    float lastCutoff = -1.0f, lastResonance = -1.0f;
+
+    // current and target coefficients
+    float g = 0.0f, R2 = 1.0f;
+    float targetG = 0.0f, targetR2 = 1.0f;
+
+    // two integrator states per channel
+    juce::HeapBlock<double> s1, s2;
+    int numPreparedChannels = 0;
+};
@@ -0,0 +1,51 @@
+/*
+  ==============================================================================
+
+    TempoSync.h
+    Note values for LFOs locked to the host's tempo.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    The note values a tempo-synced LFO cycle can last, from a whole note down to
+    a thirty-second, each straight, dotted and as a triplet. The index of a name
+    in getDivisionNames() is the index getQuarterNotesPerCycle() takes, so a
+    choice parameter built from the names maps straight onto the lengths.
+*/
+namespace TempoSync
+{
+    constexpr int numNoteValues = 6;                // 1/1, 1/2, 1/4, 1/8, 1/16, 1/32
+    constexpr int numDivisions = numNoteValues * 3;
+    constexpr int quarterNoteDivision = 6;          // "1/4", the default
+
+    inline juce::StringArray getDivisionNames()
+    {
+        juce::StringArray names;
+
+        for (int note = 0; note < numNoteValues; ++note)
+        {
+            const auto name = "1/" + juce::String (1 << note);
+            names.add (name);
+            names.add (name + " D");
+            names.add (name + " T");
+        }
+
+        return names;
+    }
+
+    /** Length of one cycle in quarter notes; dotted is half as long again, a triplet two thirds. */
+    inline double getQuarterNotesPerCycle (int division)
+    {
+        division = juce::jlimit (0, numDivisions - 1, division);
+
+        const double straight = 4.0 / (double) (1 << (division / 3));
+        const double scale[] = { 1.0, 1.5, 2.0 / 3.0 };
+        return straight * scale[division % 3];
+    }
+}
@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    VinylNoise.cpp
+    Record surface hiss and crackle, added on top of the processed signal.
+
+  ==============================================================================
+*/
+
+#include "VinylNoise.h"
+
+namespace
+{
+    constexpr float maxHissGain = 0.05f;           // about -26 dBFS at full level
+    constexpr float maxClicksPerSecond = 40.0f;
+    constexpr float maxClickHeight = 0.5f;
+    constexpr double hissCutoffHz = 7000.0;
+    constexpr double clickDecaySeconds = 0.0003;
+
+    constexpr uint32_t hissSeed = 0x5eed0000u;
+    constexpr uint32_t crackleSeed = 0xc4ac0000u;
+}
+
+//==============================================================================
+void VinylNoise::prepare (double sampleRate, int numChannels, int maxBlockSize)
+{
+    fs = sampleRate;
+    numPreparedChannels = numChannels;
+    maxBlock = maxBlockSize;
+
+    hissGenerators.resize ((size_t) numChannels);
+    crackleGenerators.resize ((size_t) numChannels);
+    hissState.allocate ((size_t) numChannels, true);
+    clickState.allocate ((size_t) numChannels, true);
+    hissValues.allocate ((size_t) maxBlockSize, true);
+    crackleValues.allocate ((size_t) maxBlockSize, true);
+
+    hissCoeff = (float) (1.0 - std::exp (-juce::MathConstants<double>::twoPi * juce::jmin (hissCutoffHz, 0.45 * fs) / fs));
+    clickDecay = (float) std::exp (-1.0 / (clickDecaySeconds * fs));
+
+    // the click rate is per second, so it depends on the sample rate
+    const float hiss = juce::jmax (0.0f, hissLevel), crackle = juce::jmax (0.0f, crackleLevel);
+    hissLevel = crackleLevel = -1.0f;
+    setLevels (hiss, crackle);
+    reset();
+}
+
+void VinylNoise::reset()
+{
+    for (size_t channel = 0; channel < hissGenerators.size(); ++channel)
+    {
+        hissGenerators[channel].seed (hissSeed + (uint32_t) channel);
+        crackleGenerators[channel].seed (crackleSeed + (uint32_t) channel);
+    }
+
+    juce::FloatVectorOperations::clear (hissState.get(), numPreparedChannels);
+    juce::FloatVectorOperations::clear (clickState.get(), numPreparedChannels);
+}
+
+void VinylNoise::setLevels (float hiss, float crackle)
+{
+    if (hiss == hissLevel && crackle == crackleLevel)
+        return;
+
+    hissLevel = hiss;
+    crackleLevel = crackle;
+
+    // squared, so the lower half of each knob stays subtle
+    hissGain = maxHissGain * hiss * hiss;
+
+    // a uniform value in [-1, 1) is above 1 - 2p with probability p
+    crackleProbability = juce::jmin (1.0f, maxClicksPerSecond * crackle * crackle / (float) fs);
+    crackleThreshold = 1.0f - 2.0f * crackleProbability;
+    clickScale = crackleProbability > 0.0f ? maxClickHeight * crackle / (2.0f * crackleProbability) : 0.0f;
+}
+
+template <typename SampleType>
+void VinylNoise::process (const juce::dsp::AudioBlock<SampleType>& block)
+{
+    if (! isActive())
+        return;
+
+    const int numChannels = juce::jmin ((int) block.getNumChannels(), numPreparedChannels);
+    const int numSamples = (int) block.getNumSamples();
+
+    // the scratch holds one prepared block, bigger host blocks go through in pieces
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        SampleType* data = block.getChannelPointer ((size_t) channel);
+
+        for (int startSample = 0; startSample < numSamples; startSample += maxBlock)
+            processChannel (data + startSample, channel, juce::jmin (maxBlock, numSamples - startSample));
+    }
+}
+
+template <typename SampleType>
+void VinylNoise::processChannel (SampleType* data, int channel, int numSamples) noexcept
+{
+    float* hiss = hissValues.get();
+    float* crackle = crackleValues.get();
+
+    hissGenerators[(size_t) channel].fill (hiss, numSamples);
+    crackleGenerators[(size_t) channel].fill (crackle, numSamples);
+
+    // pick the clicks; a select, so this loop vectorizes. The click takes the
+    // sign of the hiss sample next to it, which is independent of its height.
+    const float threshold = crackleThreshold;
+    const float scale = clickScale;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float overshoot = crackle[i] - threshold;
+        crackle[i] = overshoot > 0.0f ? std::copysign (overshoot * scale, hiss[i]) : 0.0f;
+    }
+
+    // colour the hiss and ring out the clicks
+    const float coeff = hissCoeff, decay = clickDecay, gain = hissGain;
+    float hissY = hissState[channel], clickY = clickState[channel];
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        hissY += coeff * (hiss[i] - hissY);
+        clickY = crackle[i] + decay * clickY;
+        data[i] += (SampleType) (gain * hissY + clickY);
+    }
+
+    hissState[channel] = hissY;
+    clickState[channel] = clickY;
+}
+
+template void VinylNoise::process<float> (const juce::dsp::AudioBlock<float>&);
+template void VinylNoise::process<double> (const juce::dsp::AudioBlock<double>&);
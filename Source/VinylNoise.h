@@ -0,0 +1,58 @@
+/*
+  ==============================================================================
+
+    VinylNoise.h
+    Record surface hiss and crackle, added on top of the processed signal.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "NoiseGenerator.h"
+
+//==============================================================================
+/**
+    Hiss is white noise through a gentle one-pole low-pass. Crackle is a sparse
+    train of clicks: a sample becomes a click when its uniform noise value lands
+    in the top slice of the range, with the amount it overshoots as the click
+    height, and each click rings out through a short decay.
+
+    Every channel has its own pair of NoiseGenerators, one for hiss and one for
+    crackle, seeded from its index in reset(). The noise is decorrelated between
+    channels but the same on every run, and since hiss and crackle never share a
+    sequence, each sample gets the same values whatever the block size.
+*/
+class VinylNoise
+{
+public:
+    VinylNoise() = default;
+
+    void prepare (double sampleRate, int numChannels, int maxBlockSize);
+    void reset();
+
+    /** Both 0 to 1. */
+    void setLevels (float hiss, float crackle);
+
+    bool isActive() const noexcept      { return hissGain > 0.0f || crackleProbability > 0.0f; }
+
+    /** Adds the noise to the block. The noise itself is always made in float. */
+    template <typename SampleType>
+    void process (const juce::dsp::AudioBlock<SampleType>& block);
+
+private:
+    template <typename SampleType>
+    void processChannel (SampleType* data, int channel, int numSamples) noexcept;
+
+    double fs = 48000.0;
+    int numPreparedChannels = 0, maxBlock = 0;
+
+    float hissLevel = -1.0f, crackleLevel = -1.0f;
+    float hissGain = 0.0f, hissCoeff = 1.0f;
+    float crackleProbability = 0.0f, crackleThreshold = 1.0f, clickScale = 0.0f, clickDecay = 0.0f;
+
+    std::vector<NoiseGenerator> hissGenerators, crackleGenerators;     // one per channel
+    juce::HeapBlock<float> hissState, clickState;          // one per channel
+    juce::HeapBlock<float> hissValues, crackleValues;      // one block of scratch
+};
@@ -0,0 +1,134 @@
+/*
+  ==============================================================================
+
+    WowFlutter.cpp
+    Slow and fast random tape speed drift, applied to the chorus delay read.
+
+  ==============================================================================
+*/
+
+#include "WowFlutter.h"
+
+namespace
+{
+    constexpr float wowRateHz = 0.55f;
+    constexpr float flutterRateHz = 6.5f;
+    constexpr double wowNoiseCutoffHz = 2.0;
+    constexpr double flutterNoiseCutoffHz = 15.0;
+
+    constexpr uint32_t noiseSeed = 0x7a9e0001u;
+}
+
+//==============================================================================
+float WowFlutter::onePoleCoefficient (double cutoffHz, double sampleRate)
+{
+    return (float) (1.0 - std::exp (-juce::MathConstants<double>::twoPi * cutoffHz / sampleRate));
+}
+
+void WowFlutter::prepare (double sampleRate, int maxBlockSize)
+{
+    fs = sampleRate;
+    maxBlock = maxBlockSize;
+
+    wowLfo.initLFO (wowRateHz, (int) sampleRate, maxBlockSize);
+    flutterLfo.initLFO (flutterRateHz, (int) sampleRate, maxBlockSize);
+
+    wowValues.allocate ((size_t) maxBlockSize, true);
+    flutterValues.allocate ((size_t) maxBlockSize, true);
+    wowDepths.allocate ((size_t) maxBlockSize, true);
+    flutterDepths.allocate ((size_t) maxBlockSize, true);
+
+    // uniform noise has a deviation of 1/sqrt(3); a one-pole with coefficient a
+    // scales that by sqrt(a / (2 - a))
+    wowCoeff = onePoleCoefficient (wowNoiseCutoffHz, fs);
+    flutterCoeff = onePoleCoefficient (flutterNoiseCutoffHz, fs);
+    wowNoiseGain = std::sqrt (3.0f * (2.0f - wowCoeff) / wowCoeff);
+    flutterNoiseGain = std::sqrt (3.0f * (2.0f - flutterCoeff) / flutterCoeff);
+
+    wowRamp.reset (fs, 0.05);
+    flutterRamp.reset (fs, 0.05);
+
+    reset();
+}
+
+void WowFlutter::reset()
+{
+    wowLfo.phase = 0.0f;
+    flutterLfo.phase = 0.25f;
+    noise.seed (noiseSeed);
+    wowState = flutterState = 0.0f;
+}
+
+void WowFlutter::setDepths (float wow, float flutter)
+{
+    wowRamp.setTargetValue (wow);
+    flutterRamp.setTargetValue (flutter);
+}
+
+bool WowFlutter::isActive() const noexcept
+{
+    return wowRamp.getCurrentValue() > 0.0f || wowRamp.getTargetValue() > 0.0f
+        || flutterRamp.getCurrentValue() > 0.0f || flutterRamp.getTargetValue() > 0.0f;
+}
+
+void WowFlutter::advance (int numSamples)
+{
+    if (! isActive())
+        return;
+
+    wowLfo.advance (numSamples);
+    flutterLfo.advance (numSamples);
+    wowRamp.skip (numSamples);
+    flutterRamp.skip (numSamples);
+}
+
+void WowFlutter::syncPhases (double seconds) noexcept
+{
+    // the same starting phases as reset()
+    const double wowCycles = seconds * wowRateHz;
+    const double flutterCycles = seconds * flutterRateHz + 0.25;
+
+    wowLfo.phase = (float) (wowCycles - std::floor (wowCycles));
+    flutterLfo.phase = (float) (flutterCycles - std::floor (flutterCycles));
+}
+
+void WowFlutter::process (float* delayTimeMs, int numSamples)
+{
+    if (! isActive())
+        return;
+
+    numSamples = juce::jmin (numSamples, maxBlock);
+
+    wowLfo.processBlock (numSamples);
+    flutterLfo.processBlock (numSamples);
+    noise.fill (wowValues.get(), numSamples);
+    noise.fill (flutterValues.get(), numSamples);
+    wowRamp.fill (wowDepths.get(), numSamples);
+    flutterRamp.fill (flutterDepths.get(), numSamples);
+
+    // the recursive low-passes are the only serial part
+    float wowY = wowState, flutterY = flutterState;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        wowY += wowCoeff * (wowValues[i] - wowY);
+        flutterY += flutterCoeff * (flutterValues[i] - flutterY);
+        wowValues[i] = wowY;
+        flutterValues[i] = flutterY;
+    }
+
+    wowState = wowY;
+    flutterState = flutterY;
+
+    // mix periodic and random drift and keep each within its range
+    const float* wowSine = wowLfo.output_array;
+    const float* flutterSine = flutterLfo.output_array;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float wow = juce::jlimit (-1.0f, 1.0f, 0.6f * wowSine[i] + 0.4f * wowNoiseGain * wowValues[i]);
+        const float flutter = juce::jlimit (-1.0f, 1.0f, 0.5f * flutterSine[i] + 0.5f * flutterNoiseGain * flutterValues[i]);
+
+        delayTimeMs[i] += maxWowMs * wowDepths[i] * wow + maxFlutterMs * flutterDepths[i] * flutter;
+    }
+}
@@ -0,0 +1,70 @@
+/*
+  ==============================================================================
+
+    WowFlutter.h
+    Slow and fast random tape speed drift, applied to the chorus delay read.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "LFO.h"
+#include "NoiseGenerator.h"
+#include "ParameterRamp.h"
+
+//==============================================================================
+/**
+    Tape speed deviation as a delay time offset: moving the read point changes
+    the pitch of what is read. Wow is a slow Lfo mixed with noise low-passed at a
+    couple of hertz, flutter a faster Lfo mixed with noise low-passed around 15 Hz,
+    so neither repeats exactly. The noise is seeded in reset(), so the same
+    settings always give the same drift.
+*/
+class WowFlutter
+{
+public:
+    static constexpr float maxWowMs = 2.0f;
+    static constexpr float maxFlutterMs = 0.2f;
+
+    /** Largest offset process() can add, either way. */
+    static constexpr float maxOffsetMs = maxWowMs + maxFlutterMs;
+
+    WowFlutter() = default;
+
+    void prepare (double sampleRate, int maxBlockSize);
+    void reset();
+
+    /** Both 0 to 1. */
+    void setDepths (float wow, float flutter);
+
+    bool isActive() const noexcept;
+
+    /** Adds the speed deviation, in ms, to numSamples (at most maxBlockSize) delay times. */
+    void process (float* delayTimeMs, int numSamples);
+
+    /** Moves the Lfos and depth ramps on by numSamples without computing anything.
+        The filtered noise simply carries on from where it was. */
+    void advance (int numSamples);
+
+    /** Sets both Lfos' phases from the song position, so the periodic part of the drift is
+        the same on every pass over it. The filtered noise carries on as it is. */
+    void syncPhases (double seconds) noexcept;
+
+private:
+    static float onePoleCoefficient (double cutoffHz, double sampleRate);
+
+    double fs = 48000.0;
+    int maxBlock = 0;
+
+    Lfo wowLfo, flutterLfo;
+    NoiseGenerator noise;
+
+    float wowCoeff = 0.0f, flutterCoeff = 0.0f;
+    float wowNoiseGain = 1.0f, flutterNoiseGain = 1.0f;     // bring the filtered noise back to unit deviation
+    float wowState = 0.0f, flutterState = 0.0f;
+
+    ParameterRamp wowRamp, flutterRamp;
+    juce::HeapBlock<float> wowValues, flutterValues, wowDepths, flutterDepths;
+};